@@ -0,0 +1,60 @@
+/*************************************************************************\
+* Copyright (c) 2008 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Author:
+ * Jeffrey O. Hill
+ * johill@lanl.gov
+ */
+
+#ifndef compilerSpecific_h
+#define compilerSpecific_h
+
+#ifndef __GNUC__
+#   error compiler/gcc/compilerSpecific.h is only for use with the gnu compiler
+#endif
+
+#define EPICS_ALWAYS_INLINE __inline__ __attribute__((always_inline))
+
+/* Expands to a 'const char*' which describes the name of the current function scope */
+#define EPICS_FUNCTION __PRETTY_FUNCTION__
+
+#ifdef __cplusplus
+
+/*
+ * in general we don't like ifdefs but they do allow us to check the
+ * compiler version and make the optimistic assumption that
+ * standards incompliance issues will be fixed by future compiler
+ * releases
+ */
+
+/*
+ * CXX_PLACEMENT_DELETE - defined if compiler supports placement delete
+ */
+#define CXX_PLACEMENT_DELETE
+
+#endif /* __cplusplus */
+
+/*
+ * Enable format-string checking if possible
+ */
+#define EPICS_PRINTF_STYLE(f,a) __attribute__((format(__printf__,f,a)))
+
+/*
+ * Deprecation marker
+ */
+#define EPICS_DEPRECATED __attribute__((deprecated))
+
+/*
+ * Unused marker
+ */
+#define EPICS_UNUSED __attribute__((unused))
+
+#endif  /* ifndef compilerSpecific_h */
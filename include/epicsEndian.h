@@ -0,0 +1,70 @@
+/*************************************************************************\
+* Copyright (c) 2007 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#ifndef INC_epicsEndian_H
+#define INC_epicsEndian_H
+
+/* This file must be usable from both C and C++ */
+
+#define EPICS_ENDIAN_LITTLE   1234
+#define EPICS_ENDIAN_BIG      4321
+
+
+/* The following OS Dependent file defines the macros
+ * EPICS_BYTE_ORDER  and  EPICS_FLOAT_WORD_ORDER  to be
+ * one of the above  EPICS_ENDIAN_  values.
+ */
+
+#include "osdWireConfig.h"
+
+#ifndef EPICS_BYTE_ORDER
+#error osdWireConfig.h didnt define EPICS_BYTE_ORDER
+#endif
+
+#ifndef EPICS_FLOAT_WORD_ORDER
+#error osdWireConfig.h didnt define EPICS_FLOAT_WORD_ORDER
+#endif
+
+#include <stddef.h>
+
+#include "libComAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Defined when the epicsSwapNNArray() routines are available
+ * \since UNRELEASED
+ */
+#define EPICS_SWAP_ARRAY
+
+/** \brief Copy an array of 16-bit values, reversing the bytes of each.
+ *
+ * Uses SIMD instructions where the target has them.
+ * \param dst Destination, may be the same as src but not otherwise overlap it.
+ * \param src Source values, neither needs to be aligned.
+ * \param count Number of elements.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap16Array(void *dst, const void *src, size_t count);
+/** \brief Like epicsSwap16Array() for 32-bit values, including epicsFloat32.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap32Array(void *dst, const void *src, size_t count);
+/** \brief Like epicsSwap16Array() for 64-bit values, including epicsFloat64.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap64Array(void *dst, const void *src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_epicsEndian_H */
@@ -0,0 +1,17 @@
+/*factory.h*/
+/*
+ * Copyright information and license terms for this software can be
+ * found in the file LICENSE that is included with the distribution
+ */
+/**
+ *  @author mrk
+ */
+#ifndef FACTORY_H
+#define FACTORY_H
+
+namespace epics { namespace pvData {
+
+    enum DebugLevel{noDebug,lowDebug,highDebug};
+
+}}
+#endif /*FACTORY_H */
@@ -0,0 +1,12 @@
+#ifndef IOCREFTRACK_H
+#define IOCREFTRACK_H
+
+#include <shareLib.h>
+
+namespace epics {namespace pvAccess {
+
+epicsShareExtern void refTrackRegistrar();
+
+}}
+
+#endif // IOCREFTRACK_H
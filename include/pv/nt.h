@@ -0,0 +1,37 @@
+/* nt.h */
+/*
+ * Copyright information and license terms for this software can be
+ * found in the file LICENSE that is included with the distribution
+ */
+#ifndef NT_H
+#define NT_H
+
+/*
+ * Include all the normative types here.
+ */
+#include <pv/ntfield.h>
+#include <pv/ntscalar.h>
+#include <pv/ntscalarArray.h>
+#include <pv/ntnameValue.h>
+#include <pv/nttable.h>
+#include <pv/ntndarray.h>
+#include <pv/ntmultiChannel.h>
+#include <pv/ntscalarMultiChannel.h>
+#include <pv/ntmatrix.h>
+#include <pv/ntenum.h>
+#include <pv/ntunion.h>
+#include <pv/ntaggregate.h>
+#include <pv/ntattribute.h>
+#include <pv/ntcontinuum.h>
+#include <pv/nthistogram.h>
+#include <pv/nturi.h>
+#include <pv/ntndarrayAttribute.h>
+
+#endif  /* NT_H */
+
+/** @page Overview Documentation
+ *
+ * <a href = "../ntCPP.html">Normative Types (C++) Reference</a>
+ *
+ */
+
@@ -0,0 +1,7 @@
+#ifndef VERSION_H_
+#  error include pvaVersion.h, not this header
+#endif
+#define EPICS_PVA_MAJOR_VERSION 7
+#define EPICS_PVA_MINOR_VERSION 1
+#define EPICS_PVA_MAINTENANCE_VERSION 7
+#define EPICS_PVA_DEVELOPMENT_FLAG 0
@@ -0,0 +1,7 @@
+#ifndef PVDVERSION_H
+#  error include pvdVersion.h, not this header
+#endif
+#define EPICS_PVD_MAJOR_VERSION 8
+#define EPICS_PVD_MINOR_VERSION 0
+#define EPICS_PVD_MAINTENANCE_VERSION 6
+#define EPICS_PVD_DEVELOPMENT_FLAG 0
@@ -0,0 +1,9 @@
+#ifndef PV_QSRV_H
+#  error qsrvVersionNum.h should never be included directly.  Include <pv/qsrv.h>
+#endif
+#define EPICS_QSRV_MAJOR_VERSION 1
+#define EPICS_QSRV_MINOR_VERSION 4
+#define EPICS_QSRV_MAINTENANCE_VERSION 1
+#define EPICS_QSRV_DEVELOPMENT_FLAG 0
+#define EPICS_QSRV_ABI_MAJOR_VERSION 1
+#define EPICS_QSRV_ABI_MINOR_VERSION 2
@@ -72,7 +72,7 @@ public:
     void * allocate ( size_t );
     void release ( void * );
 private:
-    tsFreeList < comBuf, 0x20 > freeList;
+    tsThreadFreeList < comBuf, 0x20 > freeList;
     cacComBufMemoryManager ( const cacComBufMemoryManager & );
     cacComBufMemoryManager & operator = ( const cacComBufMemoryManager & );
 };
@@ -240,7 +240,7 @@ private:
     tsFreeList
         < class nciu, 1024, epicsMutexNOOP >
             channelFreeList;
-    tsFreeList
+    tsThreadFreeList
         < class msgForMultiplyDefinedPV, 16 >
             mdpvFreeList;
     cacComBufMemoryManager comBufMemMgr;
@@ -39,6 +39,16 @@
  */
 #ifdef EPICS_CONVERSION_REQUIRED
 
+/*
+ * Where integers and floating point are both little endian the arrays
+ * only need the bytes of each element reversed, which is done for the
+ * whole array at once
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+#   define CVRT_SWAP_ARRAYS
+#endif
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -134,6 +144,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CVRT_SWAP_ARRAYS
+    epicsSwap16Array ( d, s, num );
+#else
     dbr_short_t         *pSrc = (dbr_short_t *) s;
     dbr_short_t         *pDest = (dbr_short_t *) d;
 
@@ -147,6 +160,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -184,6 +198,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CVRT_SWAP_ARRAYS
+    epicsSwap32Array ( d, s, num );
+#else
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
@@ -197,6 +214,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohl( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -213,6 +231,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CVRT_SWAP_ARRAYS
+    epicsSwap16Array ( d, s, num );
+#else
     dbr_enum_t          *pSrc = (dbr_enum_t *) s;
     dbr_enum_t          *pDest = (dbr_enum_t *) d;
 
@@ -226,6 +247,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs ( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -244,6 +266,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CVRT_SWAP_ARRAYS
+    epicsSwap32Array ( d, s, num );
+#else
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
@@ -257,6 +282,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohf ( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /*
@@ -269,6 +295,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CVRT_SWAP_ARRAYS
+    epicsSwap64Array ( d, s, num );
+#else
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
@@ -282,6 +311,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohd( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /****************************************************************************
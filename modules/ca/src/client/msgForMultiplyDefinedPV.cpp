@@ -61,14 +61,14 @@ void msgForMultiplyDefinedPV::transactionComplete ( const char * pHostNameRej )
 }
 
 void * msgForMultiplyDefinedPV::operator new ( size_t size,
-    tsFreeList < class msgForMultiplyDefinedPV, 16 > & freeList )
+    tsThreadFreeList < class msgForMultiplyDefinedPV, 16 > & freeList )
 {
     return freeList.allocate ( size );
 }
 
 #ifdef CXX_PLACEMENT_DELETE
 void msgForMultiplyDefinedPV::operator delete ( void *pCadaver,
-    tsFreeList < class msgForMultiplyDefinedPV, 16 > & freeList )
+    tsThreadFreeList < class msgForMultiplyDefinedPV, 16 > & freeList )
 {
     freeList.release ( pCadaver, sizeof ( msgForMultiplyDefinedPV ) );
 }
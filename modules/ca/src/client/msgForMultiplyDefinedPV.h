@@ -48,8 +48,8 @@ public:
         const char * pAcc );
     virtual ~msgForMultiplyDefinedPV ();
     void ioInitiate ( const osiSockAddr & rej );
-    void * operator new ( size_t size, tsFreeList < class msgForMultiplyDefinedPV, 16 > & );
-    epicsPlacementDeleteOperator (( void *, tsFreeList < class msgForMultiplyDefinedPV, 16 > & ))
+    void * operator new ( size_t size, tsThreadFreeList < class msgForMultiplyDefinedPV, 16 > & );
+    epicsPlacementDeleteOperator (( void *, tsThreadFreeList < class msgForMultiplyDefinedPV, 16 > & ))
 private:
     char acc[64];
     char channel[64];
@@ -0,0 +1,10 @@
+/* Generated file, do not edit! */
+
+/* Version determined from Git */
+
+#ifndef EPICS_VCS_VERSION
+  #define EPICS_VCS_VERSION "b1423e146ce85f41749c-dirty"
+#endif
+#ifndef EPICS_VCS_VERSION_DATE
+  #define EPICS_VCS_VERSION_DATE "Git: 2026-10-17 10:43:50 +0000"
+#endif
@@ -26,7 +26,7 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
-#include "epicsRingPointer.h"
+#include "epicsRingMPMC.h"
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsTimer.h"
@@ -51,8 +51,7 @@
 static int callbackQueueSize = 2000;
 
 typedef struct cbQueueSet {
-    epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    epicsRingMPMCId queue;
     int queueOverflow;
     int queueOverflows;
     int shutdown; // use atomic
@@ -114,11 +113,11 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
     if (result) {
         int prio;
-        result->size = callbackQueueSize;
+        result->size = epicsRingMPMCGetSize(callbackQueue[0].queue);
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
+            epicsRingMPMCId qId = callbackQueue[prio].queue;
+            result->numUsed[prio] = epicsRingMPMCGetUsed(qId);
+            result->maxUsed[prio] = epicsRingMPMCGetHighWaterMark(qId);
             result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
         }
         ret = 0;
@@ -128,7 +127,7 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            epicsRingMPMCResetHighWaterMark(callbackQueue[prio].queue);
         }
     }
     return ret;
@@ -150,6 +149,18 @@ void callbackQueueShow(const int reset)
                    stats.numUsed[prio], stats.size, qusage,
                    stats.numOverflow[prio]);
         }
+        printf("\nPRIORITY        REQUESTS     RETRIES     WAKEUPS  WAKEUPS SAVED\n");
+        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+            epicsRingMPMCStats qstats;
+
+            epicsRingMPMCGetStats(callbackQueue[prio].queue, &qstats);
+            printf("%8s  %14lu  %10lu  %10lu  %13lu\n",
+                   threadNamePrefix[prio], (unsigned long)qstats.puts,
+                   (unsigned long)qstats.retries,
+                   (unsigned long)qstats.wakeups,
+                   qstats.puts > qstats.wakeups ?
+                       (unsigned long)(qstats.puts - qstats.wakeups) : 0ul);
+        }
     }
 }
 
@@ -212,14 +223,12 @@ static void callbackTask(void *arg)
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
-        void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
-            epicsEventMustWait(mySet->semWakeUp);
-
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
-            epicsCallback *pcallback = (epicsCallback *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
-                epicsEventMustTrigger(mySet->semWakeUp);
+        epicsCallback *pcallback;
+
+        /* Producers only signal while some worker is sleeping here */
+        epicsRingMPMCWait(mySet->queue);
+
+        while (epicsRingMPMCGet(mySet->queue, &pcallback)) {
             mySet->queueOverflow = FALSE;
             (*pcallback->callback)(pcallback);
         }
@@ -238,7 +247,7 @@ void callbackStop(void)
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         epicsAtomicSetIntT(&callbackQueue[i].shutdown, 1);
-        epicsEventSignal(callbackQueue[i].semWakeUp);
+        epicsRingMPMCWakeup(callbackQueue[i].queue);
     }
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
@@ -246,7 +255,7 @@ void callbackStop(void)
         int j;
 
         while (epicsAtomicGetIntT(&mySet->threadsRunning)) {
-            epicsEventSignal(mySet->semWakeUp);
+            epicsRingMPMCWakeup(mySet->queue);
             epicsEventWaitWithTimeout(startStopEvent, 0.1);
         }
         for(j=0; j<mySet->threadsConfigured; j++) {
@@ -267,9 +276,7 @@ void callbackCleanup(void)
         cbQueueSet *mySet = &callbackQueue[i];
 
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
-        epicsEventDestroy(mySet->semWakeUp);
-        mySet->semWakeUp = NULL;
-        epicsRingPointerDelete(mySet->queue);
+        epicsRingMPMCDelete(mySet->queue);
         mySet->queue = NULL;
         free(mySet->threads);
         mySet->threads = NULL;
@@ -298,10 +305,10 @@ void callbackInit(void)
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         epicsThreadId tid;
 
-        callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
+        callbackQueue[i].queue = epicsRingMPMCCreate(callbackQueueSize,
+                                                     sizeof(epicsCallback *));
         if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
+            cantProceed("epicsRingMPMCCreate failed for %s\n",
                 threadNamePrefix[i]);
         callbackQueue[i].queueOverflow = FALSE;
 
@@ -360,7 +367,7 @@ int callbackRequest(epicsCallback *pcallback)
     }
     if (mySet->queueOverflow) return S_db_bufFull;
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    pushOK = epicsRingMPMCPut(mySet->queue, &pcallback);
 
     if (!pushOK) {
         epicsInterruptContextMessage(fullMessage[priority]);
@@ -368,7 +375,6 @@ int callbackRequest(epicsCallback *pcallback)
         epicsAtomicIncrIntT(&mySet->queueOverflows);
         return S_db_bufFull;
     }
-    epicsEventSignal(mySet->semWakeUp);
     return 0;
 }
 
@@ -54,12 +54,14 @@ struct evSubscrip {
     void              * user_arg;
     /* associated queue, may be shared with other evSubscrip */
     struct event_que  * ev_que;
-    /* NULL if !npend.  if npend!=0, pointer to last event added to event_que::valque */
+    /* NULL if !npend.  if npend!=0, pointer to last event added to event_que::ring */
     db_field_log     ** pLastLog;
     /* n times this event is on the queue */
     unsigned long       npend;
     /* n times replacing event on the queue */
     unsigned long       nreplace;
+    /* n event_que entries reserved for this subscription */
+    unsigned            nentries;
     /* DBE mask */
     unsigned char       select;
     /* if set, subscription will yield dbfl_type_val */
@@ -597,20 +597,19 @@ static long getLongString(const dbAddr *paddr,
 {
     epicsInt32 *psrc = (epicsInt32 *) paddr->pfield;
     char *pdst = (char *) pto;
+    long n;
 
     if (nRequest==1 && offset==0) {
         cvtLongToString(*psrc, pdst);
         return 0;
     }
-    psrc += offset;
-    while (nRequest--) {
-        cvtLongToString(*psrc, pdst);
-        pdst += MAX_STRING_SIZE;
-        if (++offset == no_elements)
-            psrc = (epicsInt32 *) paddr->pfield;
-        else
-            psrc++;
-    }
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    cvtInt32ArrayToStrings(psrc + offset, n, pdst, MAX_STRING_SIZE);
+    cvtInt32ArrayToStrings(psrc, nRequest - n, pdst + n * MAX_STRING_SIZE,
+        MAX_STRING_SIZE);
     return 0;
 }
 
@@ -777,6 +776,7 @@ static long getDoubleString(const dbAddr *paddr,
     long status = 0;
     long precision = 6;
     rset *prset = 0;
+    long n;
 
     if (paddr)
         prset = dbGetRset(paddr);
@@ -786,15 +786,14 @@ static long getDoubleString(const dbAddr *paddr,
         cvtDoubleToString(*psrc, pdst, precision);
         return(status);
     }
-    psrc += offset;
-    while (nRequest--) {
-        cvtDoubleToString(*psrc, pdst, precision);
-        pdst += MAX_STRING_SIZE;
-        if (++offset == no_elements)
-            psrc = (epicsFloat64 *) paddr->pfield;
-        else
-            psrc++;
-    }
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    cvtDoubleArrayToStrings(psrc + offset, n, pdst, MAX_STRING_SIZE,
+        precision);
+    cvtDoubleArrayToStrings(psrc, nRequest - n, pdst + n * MAX_STRING_SIZE,
+        MAX_STRING_SIZE, precision);
     return(status);
 }
 
@@ -1018,19 +1017,19 @@ static long putStringLong(dbAddr *paddr,
     const void *pfrom, long nRequest, long no_elements, long offset)
 {
     const char *psrc = pfrom;
-    epicsInt32 *pdst = (epicsInt32 *) paddr->pfield + offset;
-
-    while (nRequest--) {
-        char *end;
-        long status = epicsParseInt32(psrc, pdst++, 10, &end);
-
-        if (status)
-            return status;
-        psrc += MAX_STRING_SIZE;
-        if (++offset == no_elements)
-            pdst = paddr->pfield;
-    }
-    return 0;
+    epicsInt32 *pdst = (epicsInt32 *) paddr->pfield;
+    long status;
+    long n;
+
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    status = epicsParseInt32Array(psrc, MAX_STRING_SIZE, n, pdst + offset, 10);
+    if (!status)
+        status = epicsParseInt32Array(psrc + n * MAX_STRING_SIZE,
+            MAX_STRING_SIZE, nRequest - n, pdst, 10);
+    return status;
 }
 
 static long putStringUlong(dbAddr *paddr,
@@ -1131,19 +1130,19 @@ static long putStringDouble(dbAddr *paddr,
     const void *pfrom, long nRequest, long no_elements, long offset)
 {
     const char *psrc = pfrom;
-    epicsFloat64 *pdst = (epicsFloat64 *) paddr->pfield + offset;
-
-    while (nRequest--) {
-        char *end;
-        long status = epicsParseFloat64(psrc, pdst++, &end);
-
-        if (status)
-            return status;
-        psrc += MAX_STRING_SIZE;
-        if (++offset == no_elements)
-            pdst = paddr->pfield;
-    }
-    return 0;
+    epicsFloat64 *pdst = (epicsFloat64 *) paddr->pfield;
+    long status;
+    long n;
+
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    status = epicsParseDoubleArray(psrc, MAX_STRING_SIZE, n, pdst + offset);
+    if (!status)
+        status = epicsParseDoubleArray(psrc + n * MAX_STRING_SIZE,
+            MAX_STRING_SIZE, nRequest - n, pdst);
+    return status;
 }
 
 static long putStringEnum(dbAddr *paddr,
@@ -1417,21 +1416,18 @@ static long putLongString(dbAddr *paddr,
     const epicsInt32 *psrc = (const epicsInt32 *) pfrom;
     char *pdst = (char *) paddr->pfield;
     short size = paddr->field_size;
-
+    long n;
 
     if (nRequest==1 && offset==0) {
         cvtLongToString(*psrc, pdst);
         return 0;
     }
-    pdst += (size*offset);
-    while (nRequest--) {
-        cvtLongToString(*psrc, pdst);
-        psrc++;
-        if (++offset == no_elements)
-            pdst = (char *) paddr->pfield;
-        else
-            pdst += size;
-    }
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    cvtInt32ArrayToStrings(psrc, n, pdst + size * offset, size);
+    cvtInt32ArrayToStrings(psrc + n, nRequest - n, pdst, size);
     return 0;
 }
 
@@ -1606,6 +1602,7 @@ static long putDoubleString(dbAddr *paddr,
     long precision = 6;
     rset *prset = 0;
     short size = paddr->field_size;
+    long n;
 
     if (paddr)
         prset = dbGetRset(paddr);
@@ -1615,15 +1612,12 @@ static long putDoubleString(dbAddr *paddr,
         cvtDoubleToString(*psrc, pdst, precision);
         return status;
     }
-    pdst += (size*offset);
-    while (nRequest--) {
-        cvtDoubleToString(*psrc, pdst, precision);
-        psrc++;
-        if (++offset == no_elements)
-            pdst = (char *) paddr->pfield;
-        else
-            pdst += size;
-    }
+    /* convert up to the end of the array, then any wrapped part */
+    n = no_elements - offset;
+    if (n <= 0 || n > nRequest)
+        n = nRequest;
+    cvtDoubleArrayToStrings(psrc, n, pdst + size * offset, size, precision);
+    cvtDoubleArrayToStrings(psrc + n, nRequest - n, pdst, size, precision);
     return status;
 }
 
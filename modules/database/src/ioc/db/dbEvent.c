@@ -29,9 +29,12 @@
 #include "cantProceed.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsExit.h"
 #include "epicsMutex.h"
 #include "epicsThread.h"
+#include "epicsExport.h"
 #include "errlog.h"
 #include "freeList.h"
 #include "taskwd.h"
@@ -44,43 +47,58 @@
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
+#include "dbExtractArray.h"
 #include "db_field_log.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
 #include "link.h"
 #include "special.h"
 
-/* Queue size based on Ethernet MTU of 1500 bytes.
+/* Initial queue size based on Ethernet MTU of 1500 bytes.
  * Assume <=66 bytes of ethernet+IP+TCP overhead
  * and 40 byte CA messages (DBF_TIME_DOUBLE).
  *
  * (1500-66)/40 -> 35
  */
 #define EVENTSPERQUE    36
-#define EVENTENTRIES    4      /* the number of que entries for each event */
+#define EVENTENTRIES    4      /* default que entries for each event */
 #define EVENTQUESIZE    (EVENTENTRIES  * EVENTSPERQUE)
-#define EVENTQEMPTY     ((struct evSubscrip *)NULL)
+
+/* Number of queue entries reserved for each subscription */
+int dbEventEntriesPerSubscription = EVENTENTRIES;
+epicsExportAddress(int, dbEventEntriesPerSubscription);
+
+struct event_entry {
+    struct evSubscrip       *pevent;
+    db_field_log            *pfl;
+};
 
 /*
- * really a ring buffer
+ * really a ring buffer, grown when subscriptions are added so that
+ * each subscription has dbEventEntriesPerSubscription entries
  */
 struct event_que {
     /* lock writers to the ring buffer only */
     /* readers must never slow up writers */
     epicsMutexId            writelock;
-    db_field_log            *valque[EVENTQUESIZE];
-    struct evSubscrip       *evque[EVENTQUESIZE];
-    struct event_que        *nextque;       /* in case que quota exceeded */
+    struct event_entry      *ring;
     struct event_user       *evUser;        /* event user parent struct */
-    unsigned short          putix;
-    unsigned short          getix;
-    unsigned short          quota;          /* the number of assigned entries*/
-    unsigned short          nDuplicates;    /* N events duplicated on this q */
+    unsigned                size;           /* allocated entries */
+    unsigned                nInUse;         /* entries holding an event */
+    unsigned                putix;
+    unsigned                getix;
+    unsigned                quota;          /* the number of assigned entries*/
+    unsigned                nSubscriptions;
+    unsigned                nDuplicates;    /* N events duplicated on this q */
+    unsigned                highWaterMark;
+    unsigned long           nReplaced;      /* events replaced by a newer one */
+    unsigned long           nDiscarded;     /* duplicate events ignored */
     unsigned                possibleStall;
 };
 
 struct event_user {
-    struct event_que    firstque;       /* the first event que */
+    ELLNODE             node;           /* on evUserList */
+    struct event_que    que;
 
     ELLLIST             waiters;        /* event_waiter::node */
 
@@ -93,7 +111,6 @@ struct event_user {
 
     epicsThreadId       taskid;         /* event handler task id */
     epicsUInt32         pflush_seq;     /* worker cycle count for synchronization */
-    unsigned            queovr;         /* event que overflow count */
     unsigned char       pendexit;       /* exit pend task */
     unsigned char       extra_labor;    /* if set call extra labor func */
     unsigned char       flowCtrlMode;   /* replace existing monitor */
@@ -113,8 +130,8 @@ typedef struct {
  * into only 10 or 20 total steps part of the time.
  */
 
-#define RNGINC(OLD)\
-( (unsigned short) ( (OLD) >= (EVENTQUESIZE-1) ? 0 : (OLD)+1 ) )
+#define RNGINC(EV_QUE, OLD)\
+( (OLD) >= (EV_QUE)->size - 1u ? 0u : (OLD) + 1u )
 
 #define LOCKEVQUE(EV_QUE)   epicsMutexMustLock((EV_QUE)->writelock)
 #define UNLOCKEVQUE(EV_QUE) epicsMutexUnlock((EV_QUE)->writelock)
@@ -122,7 +139,6 @@ typedef struct {
 #define UNLOCKREC(RECPTR)   epicsMutexUnlock((RECPTR)->mlok)
 
 static void *dbevEventUserFreeList;
-static void *dbevEventQueueFreeList;
 static void *dbevEventSubscriptionFreeList;
 static void *dbevFieldLogFreeList;
 
@@ -130,17 +146,90 @@ static char *EVENT_PEND_NAME = "eventTask";
 
 static epicsMutexId stopSync;
 
-/* unused space in queue (EVENTQUESIZE when empty) */
-static unsigned short ringSpace ( const struct event_que *pevq )
+/*
+ * Events posted by one thread between db_post_events_begin() and
+ * db_post_events_commit() for the same record are collected here.
+ * Each thread keeps its batch for the next record it processes, and
+ * frees it when it exits.
+ */
+#define EVENT_BATCH_SIZE 32
+
+struct event_batch {
+    struct dbCommon     *prec;          /* NULL when not in use */
+    unsigned            depth;          /* nested begin calls */
+    unsigned            count;
+    int                 kept;           /* freed at thread exit */
+    struct event_entry  entries[EVENT_BATCH_SIZE];
+};
+
+static epicsThreadPrivateId dbevBatchId;
+
+/*
+ * Array snapshot shared by the event logs of all subscriptions to a field,
+ * taken once per db_post_events() call.  The data is never modified after
+ * the copy, and is freed when the last field log referencing it is deleted.
+ */
+typedef struct shared_array {
+    int                 refcount;
+    void                *encoded;   /* shared_encoding, see below */
+    union {
+        epicsFloat64    d;
+        epicsInt64      i;
+        void            *p;
+    } data[1];
+} shared_array;
+
+/*
+ * Set to 1 to have array subscriptions share a snapshot of the field when
+ * two or more of them take the same event, instead of referencing it
+ */
+int dbEventArraySnapshot = 0;
+epicsExportAddress(int, dbEventArraySnapshot);
+
+/* all event users, for dbEventQueueShow() */
+static ELLLIST evUserList = ELLLIST_INIT;
+static epicsMutexId evUserListLock;
+
+/* unused space in queue */
+static unsigned ringSpace ( const struct event_que *pevq )
 {
-    if ( pevq->evque[pevq->putix] == EVENTQEMPTY ) {
-        if ( pevq->getix > pevq->putix ) {
-            return ( unsigned short ) ( pevq->getix - pevq->putix );
-        }
-        else {
-            return ( unsigned short ) ( ( EVENTQUESIZE + pevq->getix ) - pevq->putix );
-        }
+    return pevq->size - pevq->nInUse;
+}
+
+/*
+ * Make room for at least quota entries, event queue lock _must_ be applied.
+ * The pending entries are moved to the start of the new ring, and
+ * pevent->pLastLog is updated to point at their new location.
+ */
+static int ringGrow ( struct event_que *ev_que, unsigned quota )
+{
+    struct event_entry *ring;
+    unsigned size = ev_que->size ? ev_que->size : EVENTQUESIZE;
+    unsigned i, ix;
+
+    while ( size < quota ) {
+        if ( size > UINT_MAX / 2u / sizeof(*ring) )
+            return -1;
+        size *= 2u;
     }
+    if ( size == ev_que->size )
+        return 0;
+
+    ring = calloc ( size, sizeof(*ring) );
+    if ( ! ring )
+        return -1;
+
+    for ( i = 0u, ix = ev_que->getix; i < ev_que->nInUse;
+            i++, ix = RNGINC ( ev_que, ix ) ) {
+        ring[i] = ev_que->ring[ix];
+        /* later entries for the same subscription override earlier ones */
+        ring[i].pevent->pLastLog = &ring[i].pfl;
+    }
+    free ( ev_que->ring );
+    ev_que->ring = ring;
+    ev_que->size = size;
+    ev_que->getix = 0u;
+    ev_que->putix = ev_que->nInUse;
     return 0;
 }
 
@@ -194,17 +283,18 @@ int dbel ( const char *pname, unsigned level )
             }
 
             if ( level > 1 ) {
-                unsigned nEntriesFree;
+                unsigned nEntriesFree, nEntries;
                 const void * taskId;
                 LOCKEVQUE(pevent->ev_que);
                 nEntriesFree = ringSpace ( pevent->ev_que );
+                nEntries = pevent->ev_que->size;
                 taskId = ( void * ) pevent->ev_que->evUser->taskid;
                 UNLOCKEVQUE(pevent->ev_que);
                 if ( nEntriesFree == 0u ) {
                     printf ( ", thread=%p, queue full",
                         (void *) taskId );
                 }
-                else if ( nEntriesFree == EVENTQUESIZE ) {
+                else if ( nEntriesFree == nEntries ) {
                     printf ( ", thread=%p, queue empty",
                         (void *) taskId );
                 }
@@ -248,6 +338,48 @@ int dbel ( const char *pname, unsigned level )
     return DB_EVENT_OK;
 }
 
+void dbEventQueueShow ( const int reset )
+{
+    ELLNODE *cur;
+
+    if ( ! evUserListLock ) {
+        printf ( "Event facility not initialized.\n" );
+        return;
+    }
+
+    epicsMutexMustLock ( evUserListLock );
+    printf ( "EVENT TASK        SUBSCRIPTIONS  Q SIZE  ITEMS IN Q"
+        "  HIGH-WATER MARK    REPLACED   DISCARDED\n" );
+    for ( cur = ellFirst ( &evUserList ); cur; cur = ellNext ( cur ) ) {
+        struct event_user *evUser = CONTAINER ( cur, struct event_user, node );
+        struct event_que *ev_que = &evUser->que;
+        char name[16] = "<not started>";
+        unsigned nSubs, size, nInUse, hwm;
+        unsigned long nReplaced, nDiscarded;
+
+        if ( evUser->taskid )
+            epicsThreadGetName ( evUser->taskid, name, sizeof(name) );
+
+        LOCKEVQUE ( ev_que );
+        nSubs = ev_que->nSubscriptions;
+        size = ev_que->size;
+        nInUse = ev_que->nInUse;
+        hwm = ev_que->highWaterMark;
+        nReplaced = ev_que->nReplaced;
+        nDiscarded = ev_que->nDiscarded;
+        if ( reset ) {
+            ev_que->highWaterMark = nInUse;
+            ev_que->nReplaced = 0ul;
+            ev_que->nDiscarded = 0ul;
+        }
+        UNLOCKEVQUE ( ev_que );
+
+        printf ( "%-16s  %13u  %6u  %10u  %15u  %10lu  %10lu\n",
+            name, nSubs, size, nInUse, hwm, nReplaced, nDiscarded );
+    }
+    epicsMutexUnlock ( evUserListLock );
+}
+
 /*
  * DB_INIT_EVENT_FREELISTS()
  *
@@ -261,15 +393,17 @@ void db_init_event_freelists (void)
     if (!stopSync) {
         stopSync = epicsMutexMustCreate();
     }
+    if (!evUserListLock) {
+        evUserListLock = epicsMutexMustCreate();
+    }
+    if (!dbevBatchId) {
+        dbevBatchId = epicsThreadPrivateCreate();
+    }
 
     if (!dbevEventUserFreeList) {
         freeListInitPvt(&dbevEventUserFreeList,
             sizeof(struct event_user),8);
     }
-    if (!dbevEventQueueFreeList) {
-        freeListInitPvt(&dbevEventQueueFreeList,
-            sizeof(struct event_que),8);
-    }
     if (!dbevEventSubscriptionFreeList) {
         freeListInitPvt(&dbevEventSubscriptionFreeList,
             sizeof(struct evSubscrip),256);
@@ -304,9 +438,9 @@ dbEventCtx db_init_events (void)
     /* Flag will be cleared when event task starts */
     evUser->pendexit = TRUE;
 
-    evUser->firstque.evUser = evUser;
-    evUser->firstque.writelock = epicsMutexCreate();
-    if (!evUser->firstque.writelock)
+    evUser->que.evUser = evUser;
+    evUser->que.writelock = epicsMutexCreate();
+    if (!evUser->que.writelock)
         goto fail;
 
     evUser->ppendsem = epicsEventCreate(epicsEventEmpty);
@@ -321,12 +455,16 @@ dbEventCtx db_init_events (void)
 
     evUser->flowCtrlMode = FALSE;
     evUser->extraLaborBusy = FALSE;
+
+    epicsMutexMustLock (evUserListLock);
+    ellAdd (&evUserList, &evUser->node);
+    epicsMutexUnlock (evUserListLock);
     return (dbEventCtx) evUser;
 fail:
     if(evUser->lock)
         epicsMutexDestroy (evUser->lock);
-    if(evUser->firstque.writelock)
-        epicsMutexDestroy (evUser->firstque.writelock);
+    if(evUser->que.writelock)
+        epicsMutexDestroy (evUser->que.writelock);
     if(evUser->ppendsem)
         epicsEventDestroy (evUser->ppendsem);
     if(evUser->pexitsem)
@@ -341,9 +479,6 @@ DBCORE_API void db_cleanup_events(void)
     if(dbevEventUserFreeList) freeListCleanup(dbevEventUserFreeList);
     dbevEventUserFreeList = NULL;
 
-    if(dbevEventQueueFreeList) freeListCleanup(dbevEventQueueFreeList);
-    dbevEventQueueFreeList = NULL;
-
     if(dbevEventSubscriptionFreeList) freeListCleanup(dbevEventSubscriptionFreeList);
     dbevEventSubscriptionFreeList = NULL;
 
@@ -355,7 +490,7 @@ DBCORE_API void db_cleanup_events(void)
 /*
  *  DB_CLOSE_EVENTS()
  *
- *  evUser block and additional event queues
+ *  evUser block and its event queue
  *  deallocated when the event thread terminates
  *  itself
  *
@@ -388,6 +523,14 @@ void db_close_events (dbEventCtx ctx)
 
     epicsMutexUnlock ( evUser->lock );
 
+    /* dbEventQueueShow() may look at the queue until it is off the list */
+    epicsMutexMustLock (evUserListLock);
+    ellDelete (&evUserList, &evUser->node);
+    epicsMutexUnlock (evUserListLock);
+
+    epicsMutexDestroy(evUser->que.writelock);
+    free(evUser->que.ring);
+
     epicsMutexMustLock (stopSync);
 
     epicsEventDestroy(evUser->pexitsem);
@@ -399,25 +542,6 @@ void db_close_events (dbEventCtx ctx)
     freeListFree(dbevEventUserFreeList, evUser);
 }
 
-/*
- * create_ev_que()
- */
-static struct event_que * create_ev_que ( struct event_user * const evUser )
-{
-    struct event_que * const ev_que = (struct event_que *)
-        freeListCalloc ( dbevEventQueueFreeList );
-    if ( ! ev_que ) {
-        return NULL;
-    }
-    ev_que->writelock = epicsMutexCreate();
-    if ( ! ev_que->writelock ) {
-        freeListFree ( dbevEventQueueFreeList, ev_que );
-        return NULL;
-    }
-    ev_que->evUser = evUser;
-    return ev_que;
-}
-
 /*
  * DB_ADD_EVENT()
  */
@@ -426,8 +550,11 @@ dbEventSubscription db_add_event (
     EVENTFUNC *user_sub, void *user_arg, unsigned select)
 {
     struct event_user * const evUser = (struct event_user *) ctx;
-    struct event_que * ev_que;
+    struct event_que * const ev_que = &evUser->que;
     struct evSubscrip * pevent;
+    unsigned entries = dbEventEntriesPerSubscription > 0 ?
+        (unsigned) dbEventEntriesPerSubscription : 1u;
+    int status;
 
     /*
      * Don't add events which will not be triggered
@@ -441,33 +568,19 @@ dbEventSubscription db_add_event (
         return NULL;
     }
 
-    /* find an event que block with enough quota */
-    /* otherwise add a new one to the list */
-    epicsMutexMustLock ( evUser->lock );
-    ev_que = & evUser->firstque;
-    while ( TRUE ) {
-        int success = 0;
-        LOCKEVQUE ( ev_que );
-        success = ( ev_que->quota < EVENTQUESIZE - EVENTENTRIES );
-        if ( success ) {
-            ev_que->quota += EVENTENTRIES;
-        }
-        UNLOCKEVQUE ( ev_que );
-        if ( success ) {
-            break;
-        }
-        if ( ! ev_que->nextque ) {
-            ev_que->nextque = create_ev_que ( evUser );
-            if ( ! ev_que->nextque ) {
-                ev_que = NULL;
-                break;
-            }
-        }
-        ev_que = ev_que->nextque;
+    /* grow the event que to hold the quota of the new subscription */
+    LOCKEVQUE ( ev_que );
+    status = -1;
+    if ( ev_que->quota <= UINT_MAX - entries ) {
+        status = ringGrow ( ev_que, ev_que->quota + entries );
     }
-    epicsMutexUnlock ( evUser->lock );
+    if ( ! status ) {
+        ev_que->quota += entries;
+        ev_que->nSubscriptions++;
+    }
+    UNLOCKEVQUE ( ev_que );
 
-    if ( ! ev_que ) {
+    if ( status ) {
         freeListFree ( dbevEventSubscriptionFreeList, pevent );
         return NULL;
     }
@@ -482,6 +595,7 @@ dbEventSubscription db_add_event (
     pevent->callBackInProgress = FALSE;
     pevent->enabled =   FALSE;
     pevent->ev_que =    ev_que;
+    pevent->nentries =  entries;
 
     /*
      * Simple types values queued up for reliable interprocess
@@ -535,15 +649,17 @@ void db_event_disable (dbEventSubscription event)
 /*
  * event_remove()
  * event queue lock _must_ be applied
- * this nulls the entry in the queue, but doesn't delete the db_field_log chunk
+ * this removes the oldest entry from the queue,
+ * but doesn't delete the db_field_log chunk
  */
-static void event_remove ( struct event_que *ev_que,
-    unsigned short index, struct evSubscrip *placeHolder )
+static void event_remove ( struct event_que *ev_que )
 {
-    struct evSubscrip * const pevent = ev_que->evque[index];
+    struct evSubscrip * const pevent = ev_que->ring[ev_que->getix].pevent;
 
-    ev_que->evque[index] = placeHolder;
-    ev_que->valque[index] = NULL;
+    ev_que->ring[ev_que->getix].pevent = NULL;
+    ev_que->ring[ev_que->getix].pfl = NULL;
+    ev_que->getix = RNGINC ( ev_que, ev_que->getix );
+    ev_que->nInUse--;
     if ( pevent->npend == 1u ) {
         pevent->pLastLog = NULL;
     }
@@ -585,7 +701,8 @@ void db_cancel_event (dbEventSubscription event)
     } else {
         /* no other references, cleanup now */
 
-        pevent->ev_que->quota -= EVENTENTRIES;
+        que->quota -= pevent->nentries;
+        que->nSubscriptions--;
         freeListFree ( dbevEventSubscriptionFreeList, pevent );
     }
 
@@ -742,6 +859,148 @@ db_field_log* db_create_event_log (struct evSubscrip *pevent)
     return pLog;
 }
 
+/*
+ * One re-encoded copy of a snapshot (e.g. in network byte order) which
+ * servers can attach to it, so that it is converted once for all clients.
+ */
+typedef struct shared_encoding {
+    unsigned            tag;
+    void                *data;
+} shared_encoding;
+
+static void shared_array_unref (shared_array *psa)
+{
+    if (epicsAtomicDecrIntT (&psa->refcount) == 0) {
+        shared_encoding *penc = psa->encoded;
+        if (penc) {
+            free (penc->data);
+            free (penc);
+        }
+        free (psa);
+    }
+}
+
+static void shared_array_release (db_field_log *pfl)
+{
+    shared_array_unref ((shared_array *) pfl->u.r.pvt);
+}
+
+/*
+ *  SHARED_ARRAY_CREATE()
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ *        (as it calls rset->get_array_info)
+ */
+static shared_array * shared_array_create (struct dbChannel *chan,
+    long *pnelem)
+{
+    void *pfield = dbChannelField(chan);
+    long capacity = dbChannelElements(chan);
+    long nelem = capacity;
+    long offset = 0;
+    size_t size;
+    shared_array *psa;
+
+    dbChannelGetArrayInfo(chan, &pfield, &nelem, &offset);
+    if (nelem < 0 || nelem > capacity)
+        return NULL;
+    size = (size_t) nelem * dbChannelFieldSize(chan);
+    psa = malloc (offsetof(shared_array, data) + (size ? size : 1u));
+    if (!psa)
+        return NULL;
+    psa->refcount = 1;
+    psa->encoded = NULL;
+    if (nelem > 0)
+        dbExtractArray(pfield, psa->data, dbChannelFieldSize(chan),
+            nelem, capacity, offset, 1);
+    *pnelem = nelem;
+    return psa;
+}
+
+/*
+ *  DB_CREATE_SHARED_EVENT_LOG()
+ *
+ *  Event log for an array referencing a snapshot instead of the record
+ */
+static db_field_log* db_create_shared_event_log (struct evSubscrip *pevent,
+    shared_array *psa, long nelem)
+{
+    db_field_log *pLog = db_create_event_log(pevent);
+    if (pLog) {
+        epicsAtomicIncrIntT (&psa->refcount);
+        pLog->no_elements = nelem;
+        pLog->u.r.field = psa->data;
+        pLog->u.r.pvt = psa;
+        pLog->dtor = shared_array_release;
+    }
+    return pLog;
+}
+
+/*
+ *  DB_SHARED_ARRAY_REF()
+ *
+ *  New reference to the snapshot an event log points to, or NULL
+ */
+void * db_shared_array_ref (db_field_log *pfl)
+{
+    shared_array *psa;
+
+    if (!pfl || pfl->type != dbfl_type_ref ||
+        pfl->dtor != shared_array_release)
+        return NULL;
+    psa = (shared_array *) pfl->u.r.pvt;
+    if (pfl->u.r.field != psa->data)
+        return NULL;
+    epicsAtomicIncrIntT (&psa->refcount);
+    return psa;
+}
+
+void db_shared_array_unref (void *psa)
+{
+    shared_array_unref ((shared_array *) psa);
+}
+
+/*
+ *  DB_SHARED_ARRAY_ENCODED()
+ *
+ *  Encoded copy attached to the snapshot with this tag, or NULL
+ */
+const void * db_shared_array_encoded (void *pvt, unsigned tag)
+{
+    shared_array *psa = (shared_array *) pvt;
+    shared_encoding *penc = epicsAtomicGetPtrT (&psa->encoded);
+
+    if (penc && penc->tag == tag)
+        return penc->data;
+    return NULL;
+}
+
+/*
+ *  DB_SHARED_ARRAY_SET_ENCODED()
+ *
+ *  Attach pdata (from malloc()) to the snapshot unless another thread
+ *  got there first, in which case pdata is freed.  Returns the attached
+ *  copy, or NULL if it has a different tag.
+ */
+const void * db_shared_array_set_encoded (void *pvt, unsigned tag,
+    void *pdata)
+{
+    shared_array *psa = (shared_array *) pvt;
+    shared_encoding *penc = malloc (sizeof(shared_encoding));
+
+    if (penc) {
+        penc->tag = tag;
+        penc->data = pdata;
+        epicsAtomicWriteMemoryBarrier ();
+        if (!epicsAtomicCmpAndSwapPtrT (&psa->encoded, NULL, penc))
+            return pdata;
+        free (penc);
+    }
+    free (pdata);
+    epicsAtomicReadMemoryBarrier ();
+    return db_shared_array_encoded (psa, tag);
+}
+
 /*
  *  DB_CREATE_READ_LOG()
  *
@@ -759,22 +1018,14 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
 }
 
 /*
- *  DB_QUEUE_EVENT_LOG()
+ *  EVENT_ENQUEUE()
  *
+ *  event queue lock _must_ be applied
+ *  returns true if the event task needs to be notified
  */
-static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+static int event_enqueue (evSubscrip *pevent, db_field_log *pLog)
 {
-    struct event_que    *ev_que;
-    int firstEventFlag;
-    unsigned rngSpace;
-
-    ev_que = pevent->ev_que;
-    /*
-     * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
-     */
-
-    LOCKEVQUE (ev_que);
+    struct event_que * const ev_que = pevent->ev_que;
 
     /* if we have an event on the queue and both the last
      * event on the queue and the current event reference
@@ -784,8 +1035,18 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
             && !dbfl_has_copy(*pevent->pLastLog)
             && !dbfl_has_copy(pLog)) {
         db_delete_field_log(pLog);
-        UNLOCKEVQUE (ev_que);
-        return;
+        ev_que->nDiscarded++;
+        return 0;
+    }
+
+    /* likewise if both are array snapshots, but keep the newer one */
+    if (pevent->npend > 0u && *pevent->pLastLog
+            && (*pevent->pLastLog)->dtor == shared_array_release
+            && pLog->dtor == shared_array_release) {
+        db_delete_field_log(*pevent->pLastLog);
+        *pevent->pLastLog = pLog;
+        ev_que->nDiscarded++;
+        return 0;
     }
 
     /*
@@ -797,9 +1058,9 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
      * {flowCtrlMode, not room for one more of each monitor attached}
      * then replace the last event on the queue (for this monitor)
      */
-    rngSpace = ringSpace ( ev_que );
     if ( pevent->npend>0u &&
-        (ev_que->evUser->flowCtrlMode || rngSpace<=EVENTSPERQUE) ) {
+        (ev_que->evUser->flowCtrlMode ||
+         ringSpace ( ev_que ) <= ev_que->nSubscriptions) ) {
         /*
          * replace last event if no space is left
          */
@@ -808,21 +1069,25 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
             *pevent->pLastLog = pLog;
         }
         pevent->nreplace++;
+        ev_que->nReplaced++;
         /*
          * the event task has already been notified about
          * this so we don't need to post the semaphore
          */
-        firstEventFlag = 0;
+        return 0;
     }
     /*
      * Otherwise, the current entry must be available.
      * Fill it in and advance the ring buffer.
      */
     else {
-        assert ( ev_que->evque[ev_que->putix] == EVENTQEMPTY );
-        ev_que->evque[ev_que->putix] = pevent;
-        ev_que->valque[ev_que->putix] = pLog;
-        pevent->pLastLog = &ev_que->valque[ev_que->putix];
+        int firstEventFlag;
+
+        assert ( ev_que->nInUse < ev_que->size );
+        assert ( ev_que->ring[ev_que->putix].pevent == NULL );
+        ev_que->ring[ev_que->putix].pevent = pevent;
+        ev_que->ring[ev_que->putix].pfl = pLog;
+        pevent->pLastLog = &ev_que->ring[ev_que->putix].pfl;
         if (pevent->npend>0u) {
             ev_que->nDuplicates++;
         }
@@ -831,15 +1096,33 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
          * if the ring buffer was empty before
          * adding this event
          */
-        if (rngSpace==EVENTQUESIZE) {
-            firstEventFlag = 1;
+        firstEventFlag = ev_que->nInUse == 0u;
+        ev_que->nInUse++;
+        if (ev_que->nInUse > ev_que->highWaterMark) {
+            ev_que->highWaterMark = ev_que->nInUse;
         }
-        else {
-            firstEventFlag = 0;
-        }
-        ev_que->putix = RNGINC ( ev_que->putix );
+        ev_que->putix = RNGINC ( ev_que, ev_que->putix );
+        return firstEventFlag;
     }
+}
+
+/*
+ *  DB_QUEUE_EVENT_LOG()
+ *
+ */
+static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+{
+    struct event_que    *ev_que;
+    int firstEventFlag;
 
+    ev_que = pevent->ev_que;
+    /*
+     * evUser ring buffer must be locked for the multiple
+     * threads writing/reading it
+     */
+
+    LOCKEVQUE (ev_que);
+    firstEventFlag = event_enqueue (pevent, pLog);
     UNLOCKEVQUE (ev_que);
 
     /*
@@ -856,6 +1139,134 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
     }
 }
 
+/*
+ *  EVENT_BATCH_FLUSH()
+ *
+ *  Queue the collected events with one lock and
+ *  at most one notification for each event user.
+ */
+static void event_batch_flush (struct event_batch *batch)
+{
+    unsigned i, j;
+
+    for (i = 0u; i < batch->count; i++) {
+        struct event_que *ev_que;
+        int firstEventFlag = 0;
+
+        if (!batch->entries[i].pevent) {
+            continue;   /* already queued with an earlier event user */
+        }
+        ev_que = batch->entries[i].pevent->ev_que;
+
+        LOCKEVQUE (ev_que);
+        for (j = i; j < batch->count; j++) {
+            struct evSubscrip *pevent = batch->entries[j].pevent;
+
+            if (pevent && pevent->ev_que == ev_que) {
+                firstEventFlag |= event_enqueue (pevent, batch->entries[j].pfl);
+                batch->entries[j].pevent = NULL;
+                batch->entries[j].pfl = NULL;
+            }
+        }
+        UNLOCKEVQUE (ev_que);
+
+        if (firstEventFlag) {
+            epicsEventSignal(ev_que->evUser->ppendsem);
+        }
+    }
+    batch->count = 0u;
+}
+
+static void event_batch_exit (void *raw)
+{
+    epicsThreadPrivateSet (dbevBatchId, NULL);
+    free (raw);
+}
+
+/*
+ *  DB_POST_EVENTS_BEGIN()
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ *
+ */
+void db_post_events_begin (void *pRecord)
+{
+    struct dbCommon * const prec = (struct dbCommon *) pRecord;
+    struct event_batch *batch;
+
+    if (prec->mlis.count == 0 || !dbevBatchId) return;  /* no monitors set */
+
+    batch = (struct event_batch *) epicsThreadPrivateGet (dbevBatchId);
+    if (!batch) {
+        batch = (struct event_batch *) malloc (sizeof(struct event_batch));
+        if (!batch) return;                 /* post events one by one */
+        batch->prec = NULL;
+        /* other threads would never free it */
+        batch->kept = epicsAtThreadExitRuns () &&
+            !epicsAtThreadExit (event_batch_exit, batch);
+        epicsThreadPrivateSet (dbevBatchId, batch);
+    }
+    if (!batch->prec) {
+        batch->prec = prec;
+        batch->depth = 0u;
+        batch->count = 0u;
+        /* keep subscriptions from being cancelled until commit */
+        LOCKREC (prec);
+    }
+    else if (batch->prec != prec) {
+        return;                             /* only one record per thread */
+    }
+    batch->depth++;
+}
+
+/*
+ *  DB_POST_EVENTS_COMMIT()
+ */
+void db_post_events_commit (void *pRecord)
+{
+    struct dbCommon * const prec = (struct dbCommon *) pRecord;
+    struct event_batch *batch;
+
+    if (!dbevBatchId) return;
+
+    batch = (struct event_batch *) epicsThreadPrivateGet (dbevBatchId);
+    if (!batch || batch->prec != prec || --batch->depth > 0u) return;
+
+    event_batch_flush (batch);
+    batch->prec = NULL;
+    UNLOCKREC (prec);
+    if (!batch->kept) {
+        epicsThreadPrivateSet (dbevBatchId, NULL);
+        free (batch);
+    }
+}
+
+/*
+ *  SNAPSHOT_SHARED()
+ *
+ *  True if another subscription after pevent takes this event for the
+ *  same array, so that a snapshot is worth copying it.
+ */
+static int snapshot_shared (struct evSubscrip *pevent, void *pField,
+    unsigned int caEventMask)
+{
+    struct dbChannel * const chan = pevent->chan;
+    struct evSubscrip *pnext;
+
+    for (pnext = (struct evSubscrip *) pevent->node.next;
+        pnext; pnext = (struct evSubscrip *) pnext->node.next) {
+        struct dbChannel * const other = pnext->chan;
+
+        if ((dbChannelField(other) == pField || pField == NULL) &&
+                (caEventMask & pnext->select) && !pnext->useValque &&
+                dbChannelField(other) == dbChannelField(chan) &&
+                dbChannelElements(other) == dbChannelElements(chan) &&
+                dbChannelFieldSize(other) == dbChannelFieldSize(chan))
+            return 1;
+    }
+    return 0;
+}
+
 /*
  *  DB_POST_EVENTS()
  *
@@ -870,10 +1281,18 @@ unsigned int    caEventMask
 {
     struct dbCommon   * const prec = (struct dbCommon *) pRecord;
     struct evSubscrip *pevent;
+    struct event_batch *batch;
+    shared_array *psa = NULL;   /* snapshot of psaChan's field, or NULL */
+    struct dbChannel *psaChan = NULL;
+    long psaElements = 0;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
-    LOCKREC (prec);
+    /* between db_post_events_begin() and _commit() the lock is held */
+    batch = dbevBatchId ?
+        (struct event_batch *) epicsThreadPrivateGet (dbevBatchId) : NULL;
+    if (batch && batch->prec != prec) batch = NULL;
+    if (!batch) LOCKREC (prec);
 
     for (pevent = (struct evSubscrip *) prec->mlis.node.next;
         pevent; pevent = (struct evSubscrip *) pevent->node.next){
@@ -884,15 +1303,48 @@ unsigned int    caEventMask
          */
         if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
             (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
+            struct dbChannel * const chan = pevent->chan;
+            db_field_log *pLog;
+            int shared = 0;
+
+            if (dbEventArraySnapshot && !pevent->useValque &&
+                    dbChannelElements(chan) > 1) {
+                /* copy the array once for all subscriptions to it,
+                 * a single one references the record field instead */
+                if (!psaChan ||
+                        dbChannelField(chan) != dbChannelField(psaChan) ||
+                        dbChannelElements(chan) != dbChannelElements(psaChan) ||
+                        dbChannelFieldSize(chan) != dbChannelFieldSize(psaChan)) {
+                    if (psa) shared_array_unref (psa);
+                    psaChan = chan;
+                    psa = snapshot_shared (pevent, pField, caEventMask) ?
+                        shared_array_create (chan, &psaElements) : NULL;
+                }
+                shared = psa != NULL;
+            }
+            if (shared)
+                pLog = db_create_shared_event_log(pevent, psa, psaElements);
+            else
+                pLog = db_create_event_log(pevent);
             if(pLog)
                 pLog->mask = caEventMask & pevent->select;
             pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+            if (!pLog) continue;
+            if (batch) {
+                if (batch->count == EVENT_BATCH_SIZE)
+                    event_batch_flush (batch);
+                batch->entries[batch->count].pevent = pevent;
+                batch->entries[batch->count].pfl = pLog;
+                batch->count++;
+            }
+            else {
+                db_queue_event_log(pevent, pLog);
+            }
         }
     }
 
-    UNLOCKREC (prec);
+    if (!batch) UNLOCKREC (prec);
+    if (psa) shared_array_unref (psa);
     return DB_EVENT_OK;
 
 }
@@ -938,10 +1390,10 @@ static int event_read ( struct event_que *ev_que )
         return DB_EVENT_OK;
     }
 
-    while ( ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
-        struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
+    while ( ev_que->nInUse ) {
+        struct evSubscrip *pevent = ev_que->ring[ev_que->getix].pevent;
         int eventsRemaining;
-        db_field_log *pfl = ev_que->valque[ev_que->getix];
+        db_field_log *pfl = ev_que->ring[ev_que->getix].pfl;
 
         /*
          * Simple type values queued up for reliable interprocess
@@ -949,9 +1401,8 @@ static int event_read ( struct event_que *ev_que )
          * to be there upon wakeup)
          */
 
-        event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
-        ev_que->getix = RNGINC ( ev_que->getix );
-        eventsRemaining = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+        event_remove ( ev_que );
+        eventsRemaining = ev_que->nInUse != 0u;
 
         /*
          * Next event pointer can be used by event tasks to determine
@@ -986,7 +1437,8 @@ static int event_read ( struct event_que *ev_que )
         }
         /* callback may have called db_cancel_event(), so must check user_sub again */
         if(!pevent->user_sub && !pevent->npend) {
-            pevent->ev_que->quota -= EVENTENTRIES;
+            ev_que->quota -= pevent->nentries;
+            ev_que->nSubscriptions--;
             freeListFree ( dbevEventSubscriptionFreeList, pevent );
         }
         db_delete_field_log(pfl);
@@ -1005,7 +1457,6 @@ static int event_read ( struct event_que *ev_que )
 static void event_task (void *pParm)
 {
     struct event_user * const evUser = (struct event_user *) pParm;
-    struct event_que * ev_que;
     unsigned char pendexit;
 
     /* init hook */
@@ -1042,12 +1493,10 @@ static void event_task (void *pParm)
         }
         evUser->extraLaborBusy = FALSE;
 
-        for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
-            /* unlock during iteration is safe as event_que will not be free'd */
-            epicsMutexUnlock ( evUser->lock );
-            event_read (ev_que);
-            epicsMutexMustLock ( evUser->lock );
-        }
+        /* unlock during read is safe as event_que will not be free'd */
+        epicsMutexUnlock ( evUser->lock );
+        event_read (&evUser->que);
+        epicsMutexMustLock ( evUser->lock );
         pendexit = evUser->pendexit;
 
         evUser->pflush_seq++;
@@ -1065,20 +1514,6 @@ static void event_task (void *pParm)
 
     } while( ! pendexit );
 
-    epicsMutexDestroy(evUser->firstque.writelock);
-
-    {
-        struct event_que    *nextque;
-
-        ev_que = evUser->firstque.nextque;
-        while (ev_que) {
-            nextque = ev_que->nextque;
-            epicsMutexDestroy(ev_que->writelock);
-            freeListFree(dbevEventQueueFreeList, ev_que);
-            ev_que = nextque;
-        }
-    }
-
     taskwdRemove(epicsThreadGetIdSelf());
 
     /* use stopSync to ensure pexitsem is not destroy'd
@@ -38,6 +38,22 @@ DBCORE_API int dbel (
     const char *name, unsigned level);
 DBCORE_API int db_post_events (
     void *pRecord, void *pField, unsigned caEventMask );
+/** Collect the events posted for pRecord by this thread until the matching
+ * db_post_events_commit(), which queues them with one lock and at most one
+ * wakeup per event client.  Calls may nest.  The record must be locked.
+ */
+DBCORE_API void db_post_events_begin ( void *pRecord );
+DBCORE_API void db_post_events_commit ( void *pRecord );
+/** Report queue occupancy, replaced and discarded events of each client.
+ * Non-zero reset clears the counters after printing them.
+ */
+DBCORE_API void dbEventQueueShow ( const int reset );
+
+/** Number of event queue entries reserved for each new subscription */
+DBCORE_API extern int dbEventEntriesPerSubscription;
+/** If non-zero, array updates which two or more subscriptions take are
+ * posted as one shared copy per field */
+DBCORE_API extern int dbEventArraySnapshot;
 
 typedef void * dbEventCtx;
 
@@ -58,6 +74,16 @@ DBCORE_API void db_event_change_priority ( dbEventCtx ctx, unsigned epicsPriorit
 #ifdef EPICS_PRIVATE_API
 DBCORE_API void db_cleanup_events(void);
 DBCORE_API void db_init_event_freelists (void);
+/* Shared array snapshots (see dbEventArraySnapshot) for servers which send
+ * the data without copying it.  db_shared_array_ref() returns a reference
+ * to the snapshot of an event log, or NULL if it has none.  One encoded
+ * copy of the data, identified by a tag, can be attached to a snapshot.
+ */
+DBCORE_API void * db_shared_array_ref (struct db_field_log *pfl);
+DBCORE_API void db_shared_array_unref (void *psa);
+DBCORE_API const void * db_shared_array_encoded (void *psa, unsigned tag);
+DBCORE_API const void * db_shared_array_set_encoded (void *psa,
+    unsigned tag, void *pdata);
 #endif
 
 typedef void EVENTFUNC (void *user_arg, struct dbChannel *chan,
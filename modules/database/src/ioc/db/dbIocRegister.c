@@ -437,6 +437,22 @@ static void scanOnceQueueShowCallFunc(const iocshArgBuf *args)
     scanOnceQueueShow(args[0].ival);
 }
 
+/* scanPeriodicParallelThreads */
+static const iocshArg scanPeriodicParallelThreadsArg0 = { "no of threads", iocshArgInt};
+static const iocshArg scanPeriodicParallelThreadsArg1 = { "period", iocshArgString};
+static const iocshArg * const scanPeriodicParallelThreadsArgs[2] =
+    {&scanPeriodicParallelThreadsArg0,&scanPeriodicParallelThreadsArg1};
+static const iocshFuncDef scanPeriodicParallelThreadsFuncDef = {"scanPeriodicParallelThreads",2,scanPeriodicParallelThreadsArgs,
+                                                                "Configure multiple workers for a periodic scan list.\n"
+                                                                "Records are partitioned between workers by lock set.\n"
+                                                                "period may be omitted or \"*\" to act on all periods\n"
+                                                                "or one of the menuScan choices, e.g. \".1 second\".\n"
+                                                                "Must be called before iocInit().\n"};
+static void scanPeriodicParallelThreadsCallFunc(const iocshArgBuf *args)
+{
+    scanPeriodicParallelThreads(args[0].ival, args[1].sval);
+}
+
 /* scanppl */
 static const iocshArg scanpplArg0 = { "rate",iocshArgDouble};
 static const iocshArg * const scanpplArgs[1] = {&scanpplArg0};
@@ -482,6 +498,22 @@ static void callbackSetQueueSizeCallFunc(const iocshArgBuf *args)
     callbackSetQueueSize(args[0].ival);
 }
 
+/* dbEventQueueShow */
+static const iocshArg dbEventQueueShowArg0 = { "reset", iocshArgInt};
+static const iocshArg * const dbEventQueueShowArgs[1] =
+    {&dbEventQueueShowArg0};
+static const iocshFuncDef dbEventQueueShowFuncDef = {"dbEventQueueShow",1,dbEventQueueShowArgs,
+                                          "Show the event queue of each monitor client.\n"
+                                          " Lists the number of subscriptions, queue size and usage,\n"
+                                          " and the number of events replaced by newer ones or\n"
+                                          " discarded as duplicates.\n"
+                                          " Non-zero reset clears the counters.\n"
+                                          " Queue depth is set by dbEventEntriesPerSubscription.\n"};
+static void dbEventQueueShowCallFunc(const iocshArgBuf *args)
+{
+    dbEventQueueShow(args[0].ival);
+}
+
 /* callbackQueueShow */
 static const iocshArg callbackQueueShowArg0 = { "reset", iocshArgInt};
 static const iocshArg * const callbackQueueShowArgs[1] =
@@ -609,6 +641,7 @@ void dbIocRegister(void)
 
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
+    iocshRegister(&scanPeriodicParallelThreadsFuncDef,scanPeriodicParallelThreadsCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
@@ -616,6 +649,7 @@ void dbIocRegister(void)
 
     iocshRegister(&callbackSetQueueSizeFuncDef,callbackSetQueueSizeCallFunc);
     iocshRegister(&callbackQueueShowFuncDef,callbackQueueShowCallFunc);
+    iocshRegister(&dbEventQueueShowFuncDef,dbEventQueueShowCallFunc);
     iocshRegister(&callbackParallelThreadsFuncDef,callbackParallelThreadsCallFunc);
 
     /* Needed before callback system is initialized */
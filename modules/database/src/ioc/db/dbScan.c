@@ -16,6 +16,7 @@
  */
 
 #include <stddef.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
@@ -29,7 +30,7 @@
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
-#include "epicsRingBytes.h"
+#include "epicsRingMPMC.h"
 #include "epicsStdio.h"
 #include "epicsStdlib.h"
 #include "epicsString.h"
@@ -62,8 +63,7 @@ static volatile enum ctl scanCtl;
 /* SCAN ONCE */
 
 static int onceQueueSize = 1000;
-static epicsEventId onceSem;
-static epicsRingBytesId onceQ;
+static epicsRingMPMCId onceQ;
 static int onceQOverruns = 0;
 static epicsThreadId onceTaskId;
 static void *exitOnce;
@@ -87,6 +87,7 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+struct periodic_worker;
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -94,11 +95,29 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    /* Parallel mode, only used when nWorkers > 1 */
+    int                 nWorkers;
+    struct periodic_worker *workers;
+    epicsEventId        workDone;
+    int                 workPending;    /* use atomic ops */
 } periodic_scan_list;
 
+/* A parallel periodic scan list is partitioned by lock set, each worker
+ * gets all the records of the lock sets assigned to it, in list order.
+ */
+typedef struct periodic_worker {
+    periodic_scan_list  *ppsl;
+    epicsThreadId       tid;
+    epicsEventId        workStart;
+    struct dbCommon     **precs;
+    size_t              nrecs;
+    size_t              maxrecs;
+} periodic_worker;
+
 static int nPeriodic = 0;
 static periodic_scan_list **papPeriodic; /* pointer to array of pointers */
 static epicsThreadId *periodicTaskId;    /* array of thread ids */
+static int *periodicThreadsConfigured;   /* array of worker counts */
 
 
 static char *priorityName[NUM_CALLBACK_PRIORITIES] = {
@@ -138,6 +157,7 @@ static epicsMutexId ioscan_lock;
 static void onceTask(void *);
 static void initOnce(void);
 static void periodicTask(void *arg);
+static void periodicWorker(void *arg);
 static void initPeriodic(void);
 static void deletePeriodic(void);
 static void spawnPeriodic(int ind);
@@ -147,6 +167,7 @@ static void ioscanCallback(epicsCallback *pcallback);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
 static void scanList(scan_list *psl);
+static void scanListParallel(periodic_scan_list *ppsl);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -183,11 +204,14 @@ void scanCleanup(void)
     deletePeriodic();
     ioscanDestroy();
 
-    epicsRingBytesDelete(onceQ);
+    epicsRingMPMCDelete(onceQ);
+    onceQ = NULL;
 
     free(periodicTaskId);
+    free(periodicThreadsConfigured);
     papPeriodic = NULL;
     periodicTaskId = NULL;
+    periodicThreadsConfigured = NULL;
 }
 
 long scanInit(void)
@@ -366,6 +390,55 @@ void scanDelete(struct dbCommon *precord)
     }
 }
 
+int scanPeriodicParallelThreads(int count, const char *period)
+{
+    dbMenu *pmenu;
+    int nChoice, i;
+
+    if (papPeriodic) {
+        fprintf(stderr, "Periodic scan system already initialized\n");
+        return -1;
+    }
+    if (!pdbbase) {
+        fprintf(stderr, "scanPeriodicParallelThreads: pdbbase not set\n");
+        return -1;
+    }
+    pmenu = dbFindMenu(pdbbase, "menuScan");
+    if (!pmenu) {
+        fprintf(stderr, "scanPeriodicParallelThreads: menuScan not present\n");
+        return -1;
+    }
+
+    if (count < 0)
+        count = epicsThreadGetCPUs() + count;
+    else if (count == 0)
+        count = epicsThreadGetCPUs();
+    if (count < 1) count = 1;
+
+    nChoice = pmenu->nChoice - SCAN_1ST_PERIODIC;
+    if (nChoice <= 0)
+        return 0;
+    if (!periodicThreadsConfigured)
+        periodicThreadsConfigured = dbCalloc(nChoice, sizeof(int));
+
+    if (!period || *period == 0 || strcmp(period, "*") == 0) {
+        for (i = 0; i < nChoice; i++)
+            periodicThreadsConfigured[i] = count;
+        return 0;
+    }
+
+    for (i = 0; i < nChoice; i++) {
+        if (epicsStrCaseCmp(period,
+                pmenu->papChoiceValue[i + SCAN_1ST_PERIODIC]) == 0) {
+            periodicThreadsConfigured[i] = count;
+            return 0;
+        }
+    }
+    fprintf(stderr, "scanPeriodicParallelThreads: "
+        "Unknown scan period \"%s\"\n", period);
+    return -1;
+}
+
 double scanPeriod(int scan) {
     periodic_scan_list *ppsl;
 
@@ -677,7 +750,7 @@ int scanOnceCallback(struct dbCommon *precord, once_complete cb, void *usr)
     ent.cb = cb;
     ent.usr = usr;
 
-    pushOK = epicsRingBytesPut(onceQ, (void*)&ent, sizeof(ent));
+    pushOK = epicsRingMPMCPut(onceQ, &ent);
 
     if (!pushOK) {
         if (newOverflow) errlogPrintf("scanOnce: Ring buffer overflow\n");
@@ -686,7 +759,6 @@ int scanOnceCallback(struct dbCommon *precord, once_complete cb, void *usr)
     } else {
         newOverflow = TRUE;
     }
-    epicsEventSignal(onceSem);
 
     return !pushOK;
 }
@@ -697,18 +769,11 @@ static void onceTask(void *arg)
     epicsEventSignal(startStopEvent);
 
     while (TRUE) {
+        onceEntry ent;
 
-        epicsEventMustWait(onceSem);
-        while(1) {
-            onceEntry ent;
-            int bytes = epicsRingBytesGet(onceQ, (void*)&ent, sizeof(ent));
-            if(bytes==0)
-                break;
-            if(bytes!=sizeof(ent)) {
-                errlogPrintf("onceTask: received incomplete %d of %u\n",
-                             bytes, (unsigned)sizeof(ent));
-                continue; /* what to do? */
-            } else if (ent.prec == (void*)&exitOnce) goto shutdown;
+        epicsRingMPMCWait(onceQ);
+        while (epicsRingMPMCGet(onceQ, &ent)) {
+            if (ent.prec == (void*)&exitOnce) goto shutdown;
 
             dbScanLock(ent.prec);
             dbProcess(ent.prec);
@@ -734,16 +799,16 @@ int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result)
     int ret;
     if (!onceQ) return -1;
     if (result) {
-        result->size = epicsRingBytesSize(onceQ) / sizeof(onceEntry);
-        result->numUsed = epicsRingBytesUsedBytes(onceQ) / sizeof(onceEntry);
-        result->maxUsed = epicsRingBytesHighWaterMark(onceQ) / sizeof(onceEntry);
+        result->size = epicsRingMPMCGetSize(onceQ);
+        result->numUsed = epicsRingMPMCGetUsed(onceQ);
+        result->maxUsed = epicsRingMPMCGetHighWaterMark(onceQ);
         result->numOverflow = epicsAtomicGetIntT(&onceQOverruns);
         ret = 0;
     } else {
         ret = -2;
     }
     if (reset) {
-        epicsRingBytesResetHighWaterMark(onceQ);
+        epicsRingMPMCResetHighWaterMark(onceQ);
     }
     return ret;
 }
@@ -769,11 +834,9 @@ static void initOnce(void)
     opts.joinable = 1;
     opts.priority = epicsThreadPriorityScanLow + nPeriodic;
     opts.stackSize = epicsThreadStackBig;
-    if ((onceQ = epicsRingBytesLockedCreate(sizeof(onceEntry)*onceQueueSize)) == NULL) {
+    if ((onceQ = epicsRingMPMCCreate(onceQueueSize, sizeof(onceEntry))) == NULL) {
         cantProceed("initOnce: Ring buffer create failed\n");
     }
-    if(!onceSem)
-        onceSem = epicsEventMustCreate(epicsEventEmpty);
     onceTaskId = epicsThreadCreateOpt("scanOnce", onceTask, 0, &opts);
 
     epicsEventWait(startStopEvent);
@@ -789,6 +852,7 @@ static void periodicTask(void *arg)
     double over_min = 0.0;
     double over_max = 0.0;
     const double penalty = (ppsl->period >= 2) ? 1 : (ppsl->period / 2);
+    int i;
 
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
@@ -800,8 +864,12 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (ppsl->scanCtl == ctlRun) {
+            if (ppsl->nWorkers > 1)
+                scanListParallel(ppsl);
+            else
+                scanList(&ppsl->scan_list);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetMonotonic(&now);
@@ -846,10 +914,50 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    for (i = 0; i < ppsl->nWorkers; i++) {
+        epicsEventMustTrigger(ppsl->workers[i].workStart);
+        epicsThreadMustJoin(ppsl->workers[i].tid);
+    }
+
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
 
+static void periodicWorker(void *arg)
+{
+    periodic_worker *pw = (periodic_worker *)arg;
+    periodic_scan_list *ppsl = pw->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+    epicsEventSignal(startStopEvent);
+
+    while (TRUE) {
+        size_t i;
+
+        epicsEventMustWait(pw->workStart);
+        if (ppsl->scanCtl == ctlExit)
+            break;
+
+        for (i = 0; i < pw->nrecs; i++) {
+            struct dbCommon *precord = pw->precs[i];
+            scan_element *pse = precord->spvt;
+
+            dbScanLock(precord);
+            /* SCAN is only changed with the record locked, so this
+             * skips records moved off our list since the snapshot.
+             */
+            if (pse && pse->pscan_list == &ppsl->scan_list)
+                dbProcess(precord);
+            dbScanUnlock(precord);
+        }
+
+        if (!epicsAtomicDecrIntT(&ppsl->workPending))
+            epicsEventMustTrigger(ppsl->workDone);
+    }
+
+    taskwdRemove(0);
+}
+
 
 static void initPeriodic(void)
 {
@@ -905,6 +1013,19 @@ static void initPeriodic(void)
         ppsl->scanCtl = ctlPause;
         ppsl->loopEvent = epicsEventMustCreate(epicsEventEmpty);
 
+        if (periodicThreadsConfigured && periodicThreadsConfigured[i] > 1) {
+            int j;
+
+            ppsl->nWorkers = periodicThreadsConfigured[i];
+            ppsl->workers = dbCalloc(ppsl->nWorkers, sizeof(periodic_worker));
+            ppsl->workDone = epicsEventMustCreate(epicsEventEmpty);
+            for (j = 0; j < ppsl->nWorkers; j++) {
+                ppsl->workers[j].ppsl = ppsl;
+                ppsl->workers[j].workStart =
+                    epicsEventMustCreate(epicsEventEmpty);
+            }
+        }
+
         number = ppsl->period / quantum;
         if ((ppsl->period < 2 * quantum) ||
             (number / floor(number) > 1.1)) {
@@ -924,6 +1045,16 @@ static void deletePeriodic(void)
         periodic_scan_list *ppsl = papPeriodic[i];
 
         if (!ppsl) continue;
+        if (ppsl->nWorkers > 1) {
+            int j;
+
+            for (j = 0; j < ppsl->nWorkers; j++) {
+                epicsEventDestroy(ppsl->workers[j].workStart);
+                free(ppsl->workers[j].precs);
+            }
+            free(ppsl->workers);
+            epicsEventDestroy(ppsl->workDone);
+        }
         ellFree(&ppsl->scan_list.list);
         epicsEventDestroy(ppsl->loopEvent);
         epicsMutexDestroy(ppsl->scan_list.lock);
@@ -937,7 +1068,8 @@ static void deletePeriodic(void)
 static void spawnPeriodic(int ind)
 {
     periodic_scan_list *ppsl = papPeriodic[ind];
-    char taskName[20];
+    char taskName[32];
+    int i;
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
     opts.joinable = 1;
     opts.priority = epicsThreadPriorityScanLow + ind;
@@ -945,6 +1077,16 @@ static void spawnPeriodic(int ind)
 
     if (!ppsl) return;
 
+    for (i = 0; i < ppsl->nWorkers; i++) {
+        sprintf(taskName, "scan-%g-%d", ppsl->period, i);
+        ppsl->workers[i].tid = epicsThreadCreateOpt(
+            taskName, periodicWorker, (void *)&ppsl->workers[i], &opts);
+        if (!ppsl->workers[i].tid)
+            cantProceed("Failed to spawn periodic scan worker %s\n",
+                taskName);
+        epicsEventWait(startStopEvent);
+    }
+
     sprintf(taskName, "scan-%g", ppsl->period);
     periodicTaskId[ind] = epicsThreadCreateOpt(
         taskName, periodicTask, (void *)ppsl, &opts);
@@ -1046,6 +1188,56 @@ static void scanList(scan_list *psl)
     }
 }
 
+static void scanListParallel(periodic_scan_list *ppsl)
+{
+    scan_list *psl = &ppsl->scan_list;
+    scan_element *pse;
+    int pending = 0;
+    int i;
+
+    for (i = 0; i < ppsl->nWorkers; i++)
+        ppsl->workers[i].nrecs = 0;
+
+    /* Records in the same lock set always go to the same worker,
+     * so their relative (PHAS) order is preserved.
+     */
+    epicsMutexMustLock(psl->lock);
+    for (pse = (scan_element *)ellFirst(&psl->list); pse;
+         pse = (scan_element *)ellNext(&pse->node)) {
+        struct dbCommon *precord = pse->precord;
+        periodic_worker *pw =
+            &ppsl->workers[dbLockGetLockId(precord) % ppsl->nWorkers];
+
+        if (pw->nrecs == pw->maxrecs) {
+            size_t newmax = pw->maxrecs ? 2 * pw->maxrecs : 64;
+            struct dbCommon **precs =
+                realloc(pw->precs, newmax * sizeof(*precs));
+
+            if (!precs) {
+                epicsMutexUnlock(psl->lock);
+                errlogPrintf("scanListParallel: out of memory\n");
+                return;
+            }
+            pw->precs = precs;
+            pw->maxrecs = newmax;
+        }
+        pw->precs[pw->nrecs++] = precord;
+    }
+    epicsMutexUnlock(psl->lock);
+
+    for (i = 0; i < ppsl->nWorkers; i++)
+        if (ppsl->workers[i].nrecs)
+            pending++;
+    if (!pending)
+        return;
+
+    epicsAtomicSetIntT(&ppsl->workPending, pending);
+    for (i = 0; i < ppsl->nWorkers; i++)
+        if (ppsl->workers[i].nrecs)
+            epicsEventMustTrigger(ppsl->workers[i].workStart);
+    epicsEventMustWait(ppsl->workDone);
+}
+
 static void buildScanLists(void)
 {
     dbRecordType *pdbRecordType;
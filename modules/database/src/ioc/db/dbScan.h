@@ -62,6 +62,10 @@ DBCORE_API void post_event(int event);
 DBCORE_API void scanAdd(struct dbCommon *);
 DBCORE_API void scanDelete(struct dbCommon *);
 DBCORE_API double scanPeriod(int scan);
+/* Use count workers for a periodic scan list (NULL or "*" for all),
+ * records are partitioned by lock set.  Call before iocInit().
+ */
+DBCORE_API int scanPeriodicParallelThreads(int count, const char *period);
 DBCORE_API int scanOnce(struct dbCommon *);
 DBCORE_API int scanOnceCallback(struct dbCommon *, once_complete cb, void *usr);
 DBCORE_API int scanOnceSetQueueSize(int size);
@@ -137,6 +137,33 @@ int dbChannel_get(struct dbChannel *chan,
     return result;
 }
 
+/* Non-zero if the values of a buffer_type request are copied unchanged
+ * from an array with elements of field_type.
+ */
+int dbChannel_native_type(int buffer_type, short field_type)
+{
+    if (buffer_type < 0 || buffer_type > oldDBR_CTRL_DOUBLE)
+        return 0;
+
+    switch (buffer_type % (oldDBR_DOUBLE + 1)) {
+    case oldDBR_STRING:
+        return field_type == DBF_STRING;
+    case oldDBR_SHORT:
+        return field_type == DBF_SHORT;
+    case oldDBR_FLOAT:
+        return field_type == DBF_FLOAT;
+    case oldDBR_ENUM:
+        return field_type == DBF_ENUM;
+    case oldDBR_CHAR:
+        return field_type == DBF_CHAR || field_type == DBF_UCHAR;
+    case oldDBR_LONG:
+        return field_type == DBF_LONG;
+    case oldDBR_DOUBLE:
+        return field_type == DBF_DOUBLE;
+    }
+    return 0;
+}
+
 /* Performs the work of the public db_get_field API, but also returns the number
  * of elements actually copied to the buffer.  The caller is responsible for
  * zeroing the remaining part of the buffer. */
@@ -34,6 +34,7 @@ DBCORE_API int dbChannel_get(struct dbChannel *chan,
     int buffer_type, void *pbuffer, long no_elements, void *pfl);
 DBCORE_API int dbChannel_put(struct dbChannel *chan, int src_type,
     const void *psrc, long no_elements);
+DBCORE_API int dbChannel_native_type(int buffer_type, short field_type);
 DBCORE_API int dbChannel_get_count(struct dbChannel *chan,
     int buffer_type, void *pbuffer, long *nRequest, void *pfl);
 
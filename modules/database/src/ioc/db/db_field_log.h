@@ -100,6 +100,10 @@ struct dbfl_val {
  * must explicitly call the dtor function.
  * If the dtor is NULL and no_elements > 0, then this means the array
  * data is still owned by a record. See the macro dbfl_has_copy below.
+ * With dbEventArraySnapshot set, event logs for array fields may reference
+ * an immutable snapshot shared by all subscriptions of the field, which
+ * the dtor releases.
+ * The referenced data must therefore never be modified in place.
  */
 struct dbfl_ref {
     void              *pvt;   /* Private pointer */
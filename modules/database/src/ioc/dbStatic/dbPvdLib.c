@@ -10,6 +10,20 @@
 
 /* dbPvdLib.c */
 
+/*
+ * The process variable directory is a chained hash table which grows
+ * when the number of entries exceeds the number of buckets.
+ *
+ * Adding, deleting and resizing are serialized by one mutex.  Lookups
+ * take no lock.  Adding links a fully initialized entry at the head of
+ * its chain, so readers never see partial entries.  Deleting and resizing
+ * bump a sequence count before and after they relink entries.  A reader
+ * that saw the count change while it searched retries, and after a few
+ * failed attempts it takes the mutex.  Replaced bucket arrays and deleted
+ * entries are kept until dbPvdFreeMem(), so a racing reader never follows
+ * a pointer into freed memory.
+ */
+
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -17,6 +31,7 @@
 
 #include "dbDefs.h"
 #include "ellLib.h"
+#include "epicsAtomic.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
@@ -25,15 +40,29 @@
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 
-typedef struct {
-    ELLLIST      list;
-    epicsMutexId lock;
-} dbPvdBucket;
-
-typedef struct dbPvd {
+typedef struct dbPvdTable {
+    struct dbPvdTable *retired;
     unsigned int size;
     unsigned int mask;
-    dbPvdBucket **buckets;
+    void *buckets[1];   /* PVDENTRY *, size entries */
+} dbPvdTable;
+
+typedef struct dbPvd {
+    void         *table;    /* dbPvdTable * */
+    int          seq;       /* odd while entries are being relinked */
+    unsigned int count;
+    epicsMutexId lock;
+    ELLLIST      retired;
+    /* statistics */
+#ifdef DBPVD_STATISTICS
+    size_t lookups;
+    size_t hits;
+    size_t probes;
+    size_t maxProbes;
+#endif
+    size_t retries;
+    size_t locked;
+    size_t resizes;
 } dbPvd;
 
 unsigned int dbPvdHashTableSize = 0;
@@ -41,6 +70,8 @@ unsigned int dbPvdHashTableSize = 0;
 #define MIN_SIZE 256
 #define DEFAULT_SIZE 512
 #define MAX_SIZE 65536
+#define MAX_GROW (1u << 22)
+#define MAX_TRIES 4
 
 
 int dbPvdTableSize(int size)
@@ -60,6 +91,34 @@ int dbPvdTableSize(int size)
     return 0;
 }
 
+/* FNV-1a, finished with the murmur3 mixer so the low bits are usable */
+static unsigned int pvdHash(const char *name, size_t lenName)
+{
+    const unsigned char *p = (const unsigned char *) name;
+    epicsUInt32 h = 2166136261u;
+
+    while (lenName--) {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static dbPvdTable * pvdTableCreate(unsigned int size)
+{
+    dbPvdTable *ptable = dbCalloc(1,
+        offsetof(dbPvdTable, buckets) + size * sizeof(void *));
+
+    ptable->size = size;
+    ptable->mask = size - 1;
+    return ptable;
+}
+
 void dbPvdInitPvt(dbBase *pdbbase)
 {
     dbPvd *ppvd;
@@ -70,123 +129,205 @@ void dbPvdInitPvt(dbBase *pdbbase)
         dbPvdHashTableSize = DEFAULT_SIZE;
     }
 
-    ppvd = (dbPvd *)dbMalloc(sizeof(dbPvd));
-    ppvd->size    = dbPvdHashTableSize;
-    ppvd->mask    = dbPvdHashTableSize - 1;
-    ppvd->buckets = dbCalloc(ppvd->size, sizeof(dbPvdBucket *));
+    ppvd = dbCalloc(1, sizeof(dbPvd));
+    ppvd->table = pvdTableCreate(dbPvdHashTableSize);
+    ppvd->lock  = epicsMutexMustCreate();
+    ellInit(&ppvd->retired);
 
     pdbbase->ppvd = ppvd;
     return;
 }
 
+static PVDENTRY * pvdSearch(const dbPvdTable *ptable, const char *name,
+    size_t lenName, unsigned int h, size_t *pprobes)
+{
+    PVDENTRY *ppvdNode = ptable->buckets[h & ptable->mask];
+    size_t probes = 0;
+
+    while (ppvdNode) {
+        probes++;
+        if (ppvdNode->hash == h) {
+            const char *recordname = ppvdNode->precnode->recordname;
+
+            if (strncmp(name, recordname, lenName) == 0 &&
+                recordname[lenName] == '\0')
+                break;
+        }
+        ppvdNode = ppvdNode->next;
+    }
+    *pprobes = probes;
+    return ppvdNode;
+}
+
+/* Counting every lookup in shared variables would make parallel readers
+ * contend for their cache line, so this is only done when debugging.
+ */
+#ifdef DBPVD_STATISTICS
+static void pvdCount(dbPvd *ppvd, PVDENTRY *ppvdNode, size_t probes)
+{
+    size_t max = epicsAtomicGetSizeT(&ppvd->maxProbes);
+
+    epicsAtomicIncrSizeT(&ppvd->lookups);
+    if (ppvdNode)
+        epicsAtomicIncrSizeT(&ppvd->hits);
+    epicsAtomicAddSizeT(&ppvd->probes, probes);
+    while (probes > max) {
+        size_t prev = epicsAtomicCmpAndSwapSizeT(&ppvd->maxProbes, max, probes);
+
+        if (prev == max) break;
+        max = prev;
+    }
+}
+#else
+#define pvdCount(ppvd, ppvdNode, probes)
+#endif
+
 PVDENTRY *dbPvdFind(dbBase *pdbbase, const char *name, size_t lenName)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    unsigned int h = pvdHash(name, lenName);
     PVDENTRY *ppvdNode;
+    size_t probes;
+    int tries;
+
+    for (tries = 0; tries < MAX_TRIES; tries++) {
+        int seq = epicsAtomicGetIntT(&ppvd->seq);
+
+        if (!(seq & 1)) {
+            ppvdNode = pvdSearch(epicsAtomicGetPtrT(&ppvd->table),
+                name, lenName, h, &probes);
+            if (epicsAtomicGetIntT(&ppvd->seq) == seq) {
+                pvdCount(ppvd, ppvdNode, probes);
+                return ppvdNode;
+            }
+        }
+        epicsAtomicIncrSizeT(&ppvd->retries);
+    }
 
-    pbucket = ppvd->buckets[epicsMemHash(name, lenName, 0) & ppvd->mask];
-    if (pbucket == NULL) return NULL;
+    /* A writer is busy, wait for it */
+    epicsMutexMustLock(ppvd->lock);
+    ppvdNode = pvdSearch(ppvd->table, name, lenName, h, &probes);
+    epicsMutexUnlock(ppvd->lock);
+    epicsAtomicIncrSizeT(&ppvd->locked);
+    pvdCount(ppvd, ppvdNode, probes);
+    return ppvdNode;
+}
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        const char *recordname = ppvdNode->precnode->recordname;
+/* Called with the lock held.  Readers retry while entries are relinked. */
+static void pvdGrow(dbPvd *ppvd)
+{
+    dbPvdTable *pold = ppvd->table;
+    dbPvdTable *pnew;
+    unsigned int h;
 
-        if (strncmp(name, recordname, lenName) == 0 &&
-            strlen(recordname) == lenName)
-            break;
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+    if (pold->size >= MAX_GROW) return;
+    pnew = pvdTableCreate(pold->size * 2);
+
+    epicsAtomicIncrIntT(&ppvd->seq);
+    for (h = 0; h < pold->size; h++) {
+        PVDENTRY *ppvdNode = pold->buckets[h];
+
+        while (ppvdNode) {
+            PVDENTRY *pnext = ppvdNode->next;
+            void **pbucket = &pnew->buckets[ppvdNode->hash & pnew->mask];
+
+            ppvdNode->next = *pbucket;
+            *pbucket = ppvdNode;
+            ppvdNode = pnext;
+        }
     }
-    epicsMutexUnlock(pbucket->lock);
-    return ppvdNode;
+    pnew->retired = pold;
+    epicsAtomicSetPtrT(&ppvd->table, pnew);
+    epicsAtomicIncrIntT(&ppvd->seq);
+    epicsAtomicIncrSizeT(&ppvd->resizes);
 }
-
+
 PVDENTRY *dbPvdAdd(dbBase *pdbbase, dbRecordType *precordType,
     dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptable;
     PVDENTRY *ppvdNode;
     char *name = precnode->recordname;
-    unsigned int h;
-
-    h = epicsStrHash(name, 0) & ppvd->mask;
-    pbucket = ppvd->buckets[h];
-    if (pbucket == NULL) {
-        pbucket = dbCalloc(1, sizeof(dbPvdBucket));
-        ellInit(&pbucket->list);
-        pbucket->lock = epicsMutexCreate();
-        ppvd->buckets[h] = pbucket;
-    }
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            epicsMutexUnlock(pbucket->lock);
-            return NULL;
-        }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+    size_t lenName = strlen(name);
+    unsigned int h = pvdHash(name, lenName);
+    size_t probes;
+
+    epicsMutexMustLock(ppvd->lock);
+    ptable = ppvd->table;
+    if (pvdSearch(ptable, name, lenName, h, &probes)) {
+        epicsMutexUnlock(ppvd->lock);
+        return NULL;
     }
     ppvdNode = dbCalloc(1, sizeof(PVDENTRY));
     ppvdNode->precordType = precordType;
     ppvdNode->precnode = precnode;
-    ellAdd(&pbucket->list, (ELLNODE *)ppvdNode);
-    epicsMutexUnlock(pbucket->lock);
+    ppvdNode->hash = h;
+    ppvdNode->next = ptable->buckets[h & ptable->mask];
+    /* publish a complete entry */
+    epicsAtomicSetPtrT(&ptable->buckets[h & ptable->mask], ppvdNode);
+    if (++ppvd->count > ptable->size)
+        pvdGrow(ppvd);
+    epicsMutexUnlock(ppvd->lock);
     return ppvdNode;
 }
 
 void dbPvdDelete(dbBase *pdbbase, dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptable;
     PVDENTRY *ppvdNode;
+    void **pprev;
     char *name = precnode->recordname;
 
-    pbucket = ppvd->buckets[epicsStrHash(name, 0) & ppvd->mask];
-    if (pbucket == NULL) return;
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
+    epicsMutexMustLock(ppvd->lock);
+    ptable = ppvd->table;
+    pprev = &ptable->buckets[pvdHash(name, strlen(name)) & ptable->mask];
+    while ((ppvdNode = *pprev)) {
         if (ppvdNode->precnode &&
             ppvdNode->precnode->recordname &&
             strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
-            free(ppvdNode);
+            epicsAtomicIncrIntT(&ppvd->seq);
+            *pprev = ppvdNode->next;
+            epicsAtomicIncrIntT(&ppvd->seq);
+            ellAdd(&ppvd->retired, &ppvdNode->node);
+            ppvd->count--;
             break;
         }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+        pprev = &ppvdNode->next;
     }
-    epicsMutexUnlock(pbucket->lock);
+    epicsMutexUnlock(ppvd->lock);
     return;
 }
 
 void dbPvdFreeMem(dbBase *pdbbase)
 {
     dbPvd *ppvd = pdbbase->ppvd;
+    dbPvdTable *ptable;
     unsigned int h;
 
     if (ppvd == NULL) return;
     pdbbase->ppvd = NULL;
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
+    ptable = ppvd->table;
+    for (h = 0; h < ptable->size; h++) {
+        PVDENTRY *ppvdNode = ptable->buckets[h];
+
+        while (ppvdNode) {
+            PVDENTRY *pnext = ppvdNode->next;
 
-        if (pbucket == NULL) continue;
-        epicsMutexMustLock(pbucket->lock);
-        ppvd->buckets[h] = NULL;
-        while ((ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list))) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
             free(ppvdNode);
+            ppvdNode = pnext;
         }
-        epicsMutexUnlock(pbucket->lock);
-        epicsMutexDestroy(pbucket->lock);
-        free(pbucket);
     }
-    free(ppvd->buckets);
+    while (ptable) {
+        dbPvdTable *pnext = ptable->retired;
+
+        free(ptable);
+        ptable = pnext;
+    }
+    ellFree(&ppvd->retired);
+    epicsMutexDestroy(ppvd->lock);
     free(ppvd);
 }
 
@@ -194,6 +335,7 @@ void dbPvdDump(dbBase *pdbbase, int verbose)
 {
     unsigned int empty = 0;
     dbPvd *ppvd;
+    dbPvdTable *ptable;
     unsigned int h;
 
     if (!pdbbase) {
@@ -203,27 +345,91 @@ void dbPvdDump(dbBase *pdbbase, int verbose)
     ppvd = pdbbase->ppvd;
     if (ppvd == NULL) return;
 
-    printf("Process Variable Directory has %u buckets", ppvd->size);
+    epicsMutexMustLock(ppvd->lock);
+    ptable = ppvd->table;
+    printf("Process Variable Directory has %u buckets", ptable->size);
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
+    for (h = 0; h < ptable->size; h++) {
+        PVDENTRY *ppvdNode = ptable->buckets[h];
+        PVDENTRY *pnode;
+        int count = 0;
         int i = 1;
 
-        if (pbucket == NULL) {
+        if (ppvdNode == NULL) {
             empty++;
             continue;
         }
-        epicsMutexMustLock(pbucket->lock);
-        ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-        printf("\n [%4u] %4d  ", h, ellCount(&pbucket->list));
+        for (pnode = ppvdNode; pnode; pnode = pnode->next)
+            count++;
+        printf("\n [%4u] %4d  ", h, count);
         while (ppvdNode && verbose) {
             if (!(++i % 4))
                 printf("\n         ");
             printf("  %s", ppvdNode->precnode->recordname);
-            ppvdNode = (PVDENTRY *) ellNext((ELLNODE*)ppvdNode);
+            ppvdNode = ppvdNode->next;
         }
-        epicsMutexUnlock(pbucket->lock);
     }
+    epicsMutexUnlock(ppvd->lock);
     printf("\n%u buckets empty.\n", empty);
 }
+
+void dbPvdStats(dbBase *pdbbase, int reset)
+{
+    dbPvd *ppvd;
+    dbPvdTable *ptable;
+    unsigned int h, used = 0, longest = 0;
+#ifdef DBPVD_STATISTICS
+    size_t lookups, probes;
+#endif
+
+    if (!pdbbase) {
+        fprintf(stderr,"pdbbase not specified\n");
+        return;
+    }
+    ppvd = pdbbase->ppvd;
+    if (ppvd == NULL) return;
+
+    epicsMutexMustLock(ppvd->lock);
+    ptable = ppvd->table;
+    for (h = 0; h < ptable->size; h++) {
+        PVDENTRY *ppvdNode = ptable->buckets[h];
+        unsigned int len = 0;
+
+        if (!ppvdNode) continue;
+        used++;
+        for (; ppvdNode; ppvdNode = ppvdNode->next)
+            len++;
+        if (len > longest)
+            longest = len;
+    }
+    printf("Process Variable Directory: %u entries in %u buckets, "
+        "%u used, longest chain %u, %lu resizes\n",
+        ppvd->count, ptable->size, used, longest,
+        (unsigned long) epicsAtomicGetSizeT(&ppvd->resizes));
+    epicsMutexUnlock(ppvd->lock);
+
+#ifdef DBPVD_STATISTICS
+    lookups = epicsAtomicGetSizeT(&ppvd->lookups);
+    probes = epicsAtomicGetSizeT(&ppvd->probes);
+    printf("  %lu lookups, %lu found, %.2f entries compared per lookup, "
+        "%lu most\n",
+        (unsigned long) lookups,
+        (unsigned long) epicsAtomicGetSizeT(&ppvd->hits),
+        lookups ? (double) probes / lookups : 0.0,
+        (unsigned long) epicsAtomicGetSizeT(&ppvd->maxProbes));
+#endif
+    printf("  %lu lookups retried, %lu waited for the lock\n",
+        (unsigned long) epicsAtomicGetSizeT(&ppvd->retries),
+        (unsigned long) epicsAtomicGetSizeT(&ppvd->locked));
+
+    if (reset) {
+#ifdef DBPVD_STATISTICS
+        epicsAtomicSetSizeT(&ppvd->lookups, 0);
+        epicsAtomicSetSizeT(&ppvd->hits, 0);
+        epicsAtomicSetSizeT(&ppvd->probes, 0);
+        epicsAtomicSetSizeT(&ppvd->maxProbes, 0);
+#endif
+        epicsAtomicSetSizeT(&ppvd->retries, 0);
+        epicsAtomicSetSizeT(&ppvd->locked, 0);
+    }
+}
@@ -191,6 +191,24 @@ static void dbPvdDumpCallFunc(const iocshArgBuf *args)
     dbPvdDump(*iocshPpdbbase,args[1].ival);
 }
 
+/* dbPvdStats */
+static const iocshArg dbPvdStatsArg1 = { "reset",iocshArgInt};
+static const iocshArg * const dbPvdStatsArgs[] = {
+    &argPdbbase,&dbPvdStatsArg1};
+static const iocshFuncDef dbPvdStatsFuncDef = {
+    "dbPvdStats",
+    2,
+    dbPvdStatsArgs,
+    "Show the size of the process variable directory, the number of\n"
+    "lookups and how many entries they had to compare.\n"
+    "If reset is non-zero, clear the lookup counters after printing them.\n"
+    "Example: dbPvdStats pdbbase 1\n",
+};
+static void dbPvdStatsCallFunc(const iocshArgBuf *args)
+{
+    dbPvdStats(*iocshPpdbbase,args[1].ival);
+}
+
 /* dbPvdTableSize */
 static const iocshArg dbPvdTableSizeArg0 = { "size",iocshArgInt};
 static const iocshArg * const dbPvdTableSizeArgs[1] =
@@ -199,9 +217,9 @@ static const iocshFuncDef dbPvdTableSizeFuncDef = {
     "dbPvdTableSize",
     1,
     dbPvdTableSizeArgs,
-    "Change the number of buckets in the process variable directory.\n\n"
+    "Change the initial number of buckets in the process variable directory.\n\n"
     "The process variable directory size should be set before loading the database.\n"
-    "The size of the process variable directory can automatically grow.\n"
+    "The process variable directory doubles its size when it has more records than buckets.\n"
     "The size must be a power of 2.\n\n"
     "Example: dbPvdTableSize 1024\n",
 };
@@ -275,6 +293,7 @@ void dbStaticIocRegister(void)
     iocshRegister(&dbDumpVariableFuncDef, dbDumpVariableCallFunc);
     iocshRegister(&dbDumpBreaktableFuncDef, dbDumpBreaktableCallFunc);
     iocshRegister(&dbPvdDumpFuncDef, dbPvdDumpCallFunc);
+    iocshRegister(&dbPvdStatsFuncDef, dbPvdStatsCallFunc);
     iocshRegister(&dbPvdTableSizeFuncDef,dbPvdTableSizeCallFunc);
     iocshRegister(&dbReportDeviceConfigFuncDef, dbReportDeviceConfigCallFunc);
     iocshRegister(&dbCreateAliasFuncDef, dbCreateAliasCallFunc);
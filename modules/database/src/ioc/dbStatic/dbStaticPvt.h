@@ -105,9 +105,11 @@ typedef struct dbGuiGroup {
 /*The following are in dbPvdLib.c*/
 /*directory*/
 typedef struct{
-    ELLNODE         node;
+    ELLNODE         node;       /* on the retired list once deleted */
+    void            *next;      /* hash chain, see dbPvdLib.c */
     dbRecordType    *precordType;
     dbRecordNode    *precnode;
+    unsigned int    hash;
 }PVDENTRY;
 DBCORE_API int dbPvdTableSize(int size);
 extern int dbStaticDebug;
@@ -24,6 +24,9 @@
 #include <stdarg.h>
 #include <limits.h>
 
+#define EPICS_PRIVATE_API
+
+#include "epicsEndian.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
@@ -482,6 +485,114 @@ static void no_read_access_event ( struct client *pClient,
 /*
  *  read_reply()
  */
+/*
+ * Network encoding of an array snapshot, made once for all clients
+ */
+static const void * shared_net_data ( void *psa, unsigned valueType,
+    const void *pData, long nElem )
+{
+    if ( valueType == DBR_STRING || valueType == DBR_CHAR ) {
+        return pData;
+    }
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_BIG && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_BIG
+    return pData;
+#else
+    {
+        const void *pNet = db_shared_array_encoded ( psa, valueType );
+        void *pCopy;
+
+        if ( pNet ) {
+            return pNet;
+        }
+        pCopy = malloc ( dbr_value_size[valueType] * nElem );
+        if ( ! pCopy ) {
+            return NULL;
+        }
+        if ( caNetConvert ( valueType, pData, pCopy, TRUE, nElem )
+                != ECA_NORMAL ) {
+            free ( pCopy );
+            return NULL;
+        }
+        return db_shared_array_set_encoded ( psa, valueType, pCopy );
+    }
+#endif
+}
+
+/*
+ * read_reply_shared ()
+ *
+ * Send a large array update of the field's own type straight from the
+ * snapshot taken by db_post_events(), so that it isn't copied into the
+ * send buffer of every client.  Returns FALSE if the update has to go
+ * through read_reply() as usual.
+ */
+static int read_reply_shared ( struct event_ext *pevext,
+    struct dbChannel *dbch, db_field_log *pfl )
+{
+    struct client *pClient = pevext->pciu->client;
+    unsigned type = pevext->msg.m_dataType;
+    unsigned valueType = type % ( LAST_TYPE + 1 );
+    long nElem = pfl->no_elements;
+    long count = 1;
+    ca_uint32_t headSize, refSize, payloadSize;
+    const void *pData;
+    void *psa, *pPayload;
+    int status;
+
+    if ( pClient->proto != IPPROTO_TCP ||
+            ! dbChannel_native_type ( type, pfl->field_type ) ||
+            pfl->field_size != dbr_value_size[valueType] ) {
+        return FALSE;
+    }
+    if ( pevext->msg.m_count != 0 ) {
+        if ( pevext->msg.m_count > (ca_uint32_t) nElem ) {
+            return FALSE;   /* needs zero padding */
+        }
+        nElem = pevext->msg.m_count;
+    }
+    refSize = dbr_value_size[valueType] * (ca_uint32_t) nElem;
+    if ( nElem <= 0 || refSize < MAX_TCP ) {
+        return FALSE;
+    }
+    payloadSize = dbr_size_n ( type, nElem );
+    if ( rsrvLargeBufFreeListTCP && CA_MESSAGE_ALIGN ( payloadSize ) >
+            rsrvSizeofLargeBufTCP - sizeof ( caHdr ) - 2 * sizeof ( ca_uint32_t ) ) {
+        return FALSE;   /* let read_reply() report the size error */
+    }
+
+    psa = db_shared_array_ref ( pfl );
+    if ( ! psa ) {
+        return FALSE;
+    }
+    pData = shared_net_data ( psa, valueType, pfl->u.r.field,
+        pfl->no_elements );
+    if ( ! pData ) {
+        db_shared_array_unref ( psa );
+        return FALSE;
+    }
+
+    /* room for the metadata with one element, and trailing pad bytes */
+    status = cas_copy_in_header_ref ( pClient, pevext->msg.m_cmmd,
+        payloadSize, dbr_size[type] + 8u, type, nElem, ECA_NORMAL,
+        pevext->msg.m_available, &pPayload );
+    if ( status == ECA_NORMAL ) {
+        status = dbChannel_get_count ( dbch, type, pPayload, &count, pfl );
+        if ( status >= 0 ) {
+            status = caNetConvert ( type, pPayload, pPayload, TRUE, 1 );
+        }
+    }
+    if ( status != ECA_NORMAL ) {
+        db_shared_array_unref ( psa );
+        return FALSE;
+    }
+
+    headSize = dbr_value_offset[type];
+    cas_commit_msg_ref ( pClient, headSize, pData, refSize,
+        db_shared_array_unref, psa );
+    return TRUE;
+}
+
 static void read_reply ( void *pArg, struct dbChannel *dbch,
                        int eventsRemaining, db_field_log *pfl )
 {
@@ -500,6 +611,13 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
 
     SEND_LOCK ( pClient );
 
+    if ( readAccess && pfl && read_reply_shared ( pevext, dbch, pfl ) ) {
+        if ( ! eventsRemaining )
+            cas_send_bs_msg ( pClient, FALSE );
+        SEND_UNLOCK ( pClient );
+        return;
+    }
+
     cid = ECA_NORMAL;
 
     /* If the client has requested a zero element count we interpret this as a
@@ -1453,6 +1571,23 @@ static void write_notify_reply ( struct client * pClient )
      * wakeup the TCP thread if it is waiting for a cb to complete
      */
     epicsEventSignal ( pClient->blockSem );
+
+    /*
+     * or have an I/O thread retry the put notify which was held back
+     */
+    if ( pClient->ioPool ) {
+        char resume;
+
+        epicsMutexMustLock ( pClient->putNotifyLock );
+        pClient->recvParked = FALSE;
+        resume = pClient->ioParked;
+        pClient->ioParked = FALSE;
+        epicsMutexUnlock ( pClient->putNotifyLock );
+
+        if ( resume ) {
+            casIoPoolResume ( pClient );
+        }
+    }
 }
 
 /*
@@ -1689,6 +1824,15 @@ static int write_notify_action ( caHdrLargeArray *mp, void *pPayload,
          * serialize concurrent put notifies
          */
         epicsMutexMustLock(client->putNotifyLock);
+        if ( client->ioPool && pciu->pPutNotify->busy ) {
+            /*
+             * an I/O thread doesn't wait, write_notify_reply()
+             * has it retry once the previous one completes
+             */
+            client->recvParked = TRUE;
+            epicsMutexUnlock(client->putNotifyLock);
+            return RSRV_PARKED;
+        }
         while(pciu->pPutNotify->busy){
             epicsMutexUnlock(client->putNotifyLock);
             status = epicsEventWaitWithTimeout(client->blockSem,60.0);
@@ -2418,6 +2562,13 @@ int camessage ( struct client *client )
         caHdr *mp;
         void *pBody;
 
+        /* leave the rest until the client takes the replies queued */
+        if ( client->sendBlocked ) {
+            client->recvHeld = TRUE;
+            status = RSRV_OK;
+            break;
+        }
+
         /* wait for at least a complete caHdr */
         bytes_left = client->recv.cnt - client->recv.stk;
         if ( bytes_left < sizeof(*mp) ) {
@@ -2544,6 +2695,12 @@ int camessage ( struct client *client )
         else {
             if ( msg.m_cmmd < NELEMENTS(tcpJumpTable) ) {
                 status = ( *tcpJumpTable[msg.m_cmmd] ) ( &msg, pBody, client );
+                if ( status == RSRV_PARKED ) {
+                    /* this request and the rest wait */
+                    client->recvHeld = TRUE;
+                    status = RSRV_OK;
+                    break;
+                }
                 if ( status != RSRV_OK ) {
                     status = RSRV_ERROR;
                     break;
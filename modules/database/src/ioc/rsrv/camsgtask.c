@@ -20,7 +20,15 @@
 #include <string.h>
 #include <errno.h>
 
+#ifdef __linux__
+#   include <sys/epoll.h>
+#   include <poll.h>
+#   include <unistd.h>
+#   define CAS_IO_POOL
+#endif
+
 #include "dbDefs.h"
+#include "epicsSignal.h"
 #include "epicsStdio.h"
 #include "epicsTime.h"
 #include "errlog.h"
@@ -33,6 +41,155 @@
 #include "rsrv.h"
 #include "server.h"
 
+/*
+ *  casProcess()
+ *
+ *  Process all complete messages in the receive buffer, except those
+ *  held back while the client isn't taking replies from an I/O thread.
+ *  Returns FALSE when the circuit must be closed.
+ */
+static int casProcess ( struct client *client )
+{
+    int status;
+
+    client->recv.stk = 0;
+    status = camessage ( client );
+    if (status == 0) {
+        /*
+         * if there is a partial message
+         * align it with the start of the buffer
+         */
+        if (client->recv.cnt > client->recv.stk) {
+            unsigned bytes_left;
+
+            bytes_left = client->recv.cnt - client->recv.stk;
+
+            /*
+             * overlapping regions handled
+             * properly by memmove
+             */
+            memmove (client->recv.buf,
+                &client->recv.buf[client->recv.stk], bytes_left);
+            client->recv.cnt = bytes_left;
+        }
+        else {
+            client->recv.cnt = 0ul;
+        }
+    }
+    else {
+        char buf[64];
+
+        /* flush any queued messages before shutdown */
+        cas_send_bs_msg(client, 1);
+
+        client->recv.cnt = 0ul;
+
+        /*
+         * disconnect when there are severe message errors
+         */
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*
+ *  casReceive()
+ *
+ *  Read what the client has sent and process all complete messages.
+ *  Returns FALSE when the circuit must be closed.
+ */
+static int casReceive ( struct client *client, int flags )
+{
+    long nchars;
+
+    assert ( client->recv.maxstk >= client->recv.cnt );
+    nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
+            (int) ( client->recv.maxstk - client->recv.cnt ), flags );
+    if ( nchars == 0 ){
+        if ( CASDEBUG > 0 ) {
+            /* convert to u long so that %lu works on both 32 and 64 bit archs */
+            unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
+            errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
+                cnt );
+        }
+        return FALSE;
+    }
+    else if ( nchars < 0 ) {
+        int anerrno = SOCKERRNO;
+
+        if ( anerrno == SOCK_EINTR || anerrno == SOCK_EWOULDBLOCK ) {
+            return TRUE;
+        }
+
+        if ( anerrno == SOCK_ENOBUFS ) {
+            /* the I/O threads don't wait, they retry with the next event */
+            if ( ! client->ioPool ) {
+                errlogPrintf (
+                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
+                epicsThreadSleep ( 15.0 );
+            }
+            return TRUE;
+        }
+
+        /*
+         * normal conn lost conditions
+         */
+        if (    ( anerrno != SOCK_ECONNABORTED &&
+            anerrno != SOCK_ECONNRESET &&
+            anerrno != SOCK_ETIMEDOUT ) ||
+            CASDEBUG > 2 ) {
+            char sockErrBuf[64];
+
+            epicsSocketConvertErrorToString(
+                sockErrBuf, sizeof ( sockErrBuf ), anerrno);
+            errlogPrintf ( "CAS: Client disconnected - %s\n",
+                sockErrBuf );
+        }
+        return FALSE;
+    }
+
+    epicsTimeGetCurrent ( &client->time_at_last_recv );
+    client->recv.cnt += ( unsigned ) nchars;
+
+    return casProcess ( client );
+}
+
+/*
+ *  casFlushIfIdle()
+ *
+ *  Allow messages to batch up if more requests are coming
+ */
+static void casFlushIfIdle ( struct client *client )
+{
+    osiSockIoctl_t check_nchars;
+    int status;
+
+    status = socket_ioctl (client->sock, FIONREAD, &check_nchars);
+    if (status < 0) {
+        char sockErrBuf[64];
+
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf("CAS: FIONREAD " ERL_ERROR ": %s\n",
+            sockErrBuf);
+        cas_send_bs_msg(client, TRUE);
+    }
+    else if (check_nchars == 0){
+        cas_send_bs_msg(client, TRUE);
+    }
+}
+
+static void casCloseClient ( struct client *client )
+{
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    UNLOCK_CLIENTQ;
+
+    destroy_tcp_client ( client );
+}
+
 /*
  *  camsgtask()
  *
@@ -45,121 +202,281 @@ void camsgtask ( void *pParm )
     casAttachThreadToClient ( client );
 
     while (castcp_ctl == ctlRun && !client->disconnect) {
-        osiSockIoctl_t check_nchars;
-        long nchars;
-        int status;
+        casFlushIfIdle ( client );
+        if ( ! casReceive ( client, 0 ) ) {
+            break;
+        }
+    }
 
-        /*
-         * allow message to batch up if more are coming
-         */
-        status = socket_ioctl (client->sock, FIONREAD, &check_nchars);
-        if (status < 0) {
-            char sockErrBuf[64];
+    casCloseClient ( client );
+}
+
+#ifdef CAS_IO_POOL
+
+/*
+ * Optional mode where a few I/O threads serve all TCP circuits.  Each
+ * circuit is registered with EPOLLONESHOT, so only one thread at a time
+ * handles it and the requests of a client are processed in order.
+ */
+static int casIoPollFd = -1;
+static unsigned casIoThreadCount;
 
-            epicsSocketConvertErrnoToString (
-                sockErrBuf, sizeof ( sockErrBuf ) );
-            errlogPrintf("CAS: FIONREAD " ERL_ERROR ": %s\n",
-                sockErrBuf);
-            cas_send_bs_msg(client, TRUE);
+/*
+ *  casIoService()
+ *
+ *  Send what the client didn't take before, then process the requests
+ *  held back meanwhile and whatever else the client has sent.  Nothing
+ *  here waits for the client or for a put notify.  Returns FALSE when
+ *  the circuit must be closed.
+ */
+static int casIoService ( struct client *client )
+{
+    if ( client->sendBlocked ) {
+        cas_send_bs_msg ( client, TRUE );
+        if ( client->sendBlocked ) {
+            return TRUE;
         }
-        else if (check_nchars == 0){
-            cas_send_bs_msg(client, TRUE);
+    }
+    if ( client->recvHeld ) {
+        client->recvHeld = FALSE;
+        if ( ! casProcess ( client ) ) {
+            return FALSE;
         }
+    }
+    if ( ! client->recvHeld && ! casReceive ( client, MSG_DONTWAIT ) ) {
+        return FALSE;
+    }
+    if ( client->sendBlocked ) {
+        return TRUE;
+    }
+    if ( client->recvHeld ) {
+        /* replies to the requests before a put notify still busy */
+        cas_send_bs_msg ( client, TRUE );
+    }
+    else {
+        casFlushIfIdle ( client );
+    }
+    return TRUE;
+}
 
-        client->recv.stk = 0;
-        assert ( client->recv.maxstk >= client->recv.cnt );
-        nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
-                (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
-        if ( nchars == 0 ){
-            if ( CASDEBUG > 0 ) {
-                /* convert to u long so that %lu works on both 32 and 64 bit archs */
-                unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
-                errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
-                    cnt );
-            }
-            break;
-        }
-        else if ( nchars < 0 ) {
-            int anerrno = SOCKERRNO;
+/*
+ *  casIoArm()
+ *
+ *  Have an I/O thread serve the client with its next event.  A client
+ *  waiting for a put notify gets none until casIoPoolResume().
+ */
+static int casIoArm ( struct client *client )
+{
+    struct epoll_event ev;
+    int status = 0;
 
-            if ( anerrno == SOCK_EINTR ) {
-                continue;
-            }
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.data.ptr = client;
+    if ( client->sendBlocked ) {
+        ev.events = EPOLLOUT | EPOLLONESHOT;
+    }
+    else if ( client->recvHeld ) {
+        /* the requests held back are processed at once */
+        ev.events = EPOLLIN | EPOLLOUT | EPOLLONESHOT;
+    }
+    else {
+        ev.events = EPOLLIN | EPOLLONESHOT;
+    }
 
-            if ( anerrno == SOCK_ENOBUFS ) {
-                errlogPrintf (
-                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
-                continue;
-            }
+    epicsMutexMustLock ( client->putNotifyLock );
+    if ( client->recvParked && ! client->sendBlocked ) {
+        client->ioParked = TRUE;
+    }
+    else {
+        status = epoll_ctl ( casIoPollFd, EPOLL_CTL_MOD, client->sock, &ev );
+    }
+    epicsMutexUnlock ( client->putNotifyLock );
 
-            /*
-             * normal conn lost conditions
-             */
-            if (    ( anerrno != SOCK_ECONNABORTED &&
-                anerrno != SOCK_ECONNRESET &&
-                anerrno != SOCK_ETIMEDOUT ) ||
-                CASDEBUG > 2 ) {
+    return status;
+}
+
+static void casIoTask ( void *pParm )
+{
+    epicsThreadId self = epicsThreadGetIdSelf ();
+
+    taskwdInsert ( self, NULL, NULL );
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+
+    while ( TRUE ) {
+        struct epoll_event ev;
+        struct client *client;
+        int nfds = epoll_wait ( casIoPollFd, &ev, 1, -1 );
+
+        if ( nfds <= 0 ) {
+            if ( nfds < 0 && errno != EINTR ) {
                 char sockErrBuf[64];
 
-                epicsSocketConvertErrorToString(
-                    sockErrBuf, sizeof ( sockErrBuf ), anerrno);
-                errlogPrintf ( "CAS: Client disconnected - %s\n",
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ( "CAS: epoll_wait " ERL_ERROR ": %s\n",
                     sockErrBuf );
+                epicsThreadSleep ( 1.0 );
             }
-            break;
+            continue;
         }
+        client = (struct client *) ev.data.ptr;
 
-        epicsTimeGetCurrent ( &client->time_at_last_recv );
-        client->recv.cnt += ( unsigned ) nchars;
-
-        status = camessage ( client );
-        if (status == 0) {
-            /*
-             * if there is a partial message
-             * align it with the start of the buffer
-             */
-            if (client->recv.cnt > client->recv.stk) {
-                unsigned bytes_left;
-
-                bytes_left = client->recv.cnt - client->recv.stk;
-
-                /*
-                 * overlapping regions handled
-                 * properly by memmove
-                 */
-                memmove (client->recv.buf,
-                    &client->recv.buf[client->recv.stk], bytes_left);
-                client->recv.cnt = bytes_left;
-            }
-            else {
-                client->recv.cnt = 0ul;
+        epicsThreadPrivateSet ( rsrvCurrentClient, client );
+        client->ioTid = self;
+        if ( castcp_ctl == ctlRun && ! client->disconnect &&
+                casIoService ( client ) && ! client->disconnect ) {
+            /* a client which isn't reading gets no more requests processed */
+            client->ioTid = NULL;
+            if ( casIoArm ( client ) == 0 ) {
+                client = NULL;
             }
         }
-        else {
-            char buf[64];
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
 
-            /* flush any queued messages before shutdown */
-            cas_send_bs_msg(client, 1);
+        if ( client ) {
+            client->ioTid = NULL;
+            /* stops the event thread waiting in casIoPoolSendWait() */
+            client->disconnect = TRUE;
+            epoll_ctl ( casIoPollFd, EPOLL_CTL_DEL, client->sock, &ev );
+            casCloseClient ( client );
+        }
+    }
+}
 
-            client->recv.cnt = 0ul;
+/*
+ *  casIoPoolInit()
+ *
+ *  Start nThreads I/O threads, returns the number actually started
+ */
+unsigned casIoPoolInit ( unsigned nThreads, unsigned priority )
+{
+    unsigned i;
 
-            /*
-             * disconnect when there are severe message errors
-             */
-            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-            epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
-                break;
+    casIoPollFd = epoll_create1 ( EPOLL_CLOEXEC );
+    if ( casIoPollFd < 0 ) {
+        errlogPrintf ( "CAS: epoll_create1 failed, "
+            "using a thread per client\n" );
+        return 0u;
+    }
+    for ( i = 0u; i < nThreads; i++ ) {
+        char name[20];
+
+        epicsSnprintf ( name, sizeof ( name ), "CAS-io%u", i );
+        if ( ! epicsThreadCreate ( name, priority,
+                epicsThreadGetStackSize ( epicsThreadStackBig ),
+                casIoTask, NULL ) ) {
+            break;
         }
     }
+    if ( i == 0u ) {
+        close ( casIoPollFd );
+        casIoPollFd = -1;
+    }
+    casIoThreadCount = i;
+    return i;
+}
 
-    LOCK_CLIENTQ;
-    ellDelete ( &clientQ, &client->node );
-    UNLOCK_CLIENTQ;
+/*
+ *  casIoPoolAdd()
+ *
+ *  Have the I/O threads serve a new client
+ */
+int casIoPoolAdd ( struct client *client )
+{
+    struct epoll_event ev;
 
-    destroy_tcp_client ( client );
+    if ( casIoPollFd < 0 ) {
+        return -1;
+    }
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.ptr = client;
+    /* set first, an I/O thread may pick the client up at once */
+    client->ioPool = TRUE;
+    if ( epoll_ctl ( casIoPollFd, EPOLL_CTL_ADD, client->sock, &ev ) ) {
+        /* served by a thread of its own instead */
+        client->ioPool = FALSE;
+        return -1;
+    }
+    return 0;
+}
+
+unsigned casIoPoolThreads ( void )
+{
+    return casIoThreadCount;
+}
+
+/*
+ *  casIoPoolSendWait()
+ *
+ *  Wait up to a second for a client served by the I/O threads to take
+ *  more output.  For the other threads sending to it, such as its event
+ *  thread.  The send lock is released meanwhile, so that an I/O thread
+ *  handling the client's requests doesn't wait for the client as well.
+ */
+void casIoPoolSendWait ( struct client *client )
+{
+    struct pollfd pfd;
+
+    pfd.fd = client->sock;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+    SEND_UNLOCK ( client );
+    poll ( &pfd, 1, 1000 );
+    SEND_LOCK ( client );
+}
+
+/*
+ *  casIoPoolResume()
+ *
+ *  Serve a client again whose requests waited for a put notify
+ */
+void casIoPoolResume ( struct client *client )
+{
+    struct epoll_event ev;
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLONESHOT;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( casIoPollFd, EPOLL_CTL_MOD, client->sock, &ev ) ) {
+        char sockErrBuf[64];
+
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_ctl " ERL_ERROR ": %s\n",
+            sockErrBuf );
+    }
+}
+
+#else /* CAS_IO_POOL */
+
+unsigned casIoPoolInit ( unsigned nThreads, unsigned priority )
+{
+    errlogPrintf ( "CAS: rsrvIoThreads is not supported on this target, "
+        "using a thread per client\n" );
+    return 0u;
+}
+
+int casIoPoolAdd ( struct client *client )
+{
+    return -1;
+}
+
+unsigned casIoPoolThreads ( void )
+{
+    return 0u;
+}
+
+void casIoPoolSendWait ( struct client *client )
+{
+}
+
+void casIoPoolResume ( struct client *client )
+{
 }
 
+#endif /* CAS_IO_POOL */
 
 int casClientInitiatingCurrentThread ( char * pBuf, size_t bufSize )
 {
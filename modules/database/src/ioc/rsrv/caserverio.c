@@ -32,52 +32,145 @@
 
 #include "server.h"
 
+#if defined(_WIN32) || defined(vxWorks)
+/* no sendmsg(), send the pieces one at a time */
+#   define CAS_SEND_GATHER 0
+typedef struct {
+    void *iov_base;
+    size_t iov_len;
+} cas_iovec;
+#else
+#   include <sys/uio.h>
+#   define CAS_SEND_GATHER 1
+typedef struct iovec cas_iovec;
+#endif
+
+#ifndef MSG_DONTWAIT
+/* only used for the I/O threads, see camsgtask.c */
+#   define MSG_DONTWAIT 0
+#endif
+
 /*
- *  cas_send_bs_msg()
- *
- *  (channel access server send message)
- *
+ *  cas_discard_send()
  *
- * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ *  Drop all queued output, send lock must be on
  */
-void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+void cas_discard_send ( struct client *pclient )
 {
-    int status;
+    unsigned i;
 
-    if ( lock_needed ) {
-        SEND_LOCK ( pclient );
+    for ( i = 0u; i < pclient->nSendRefs; i++ ) {
+        struct send_ref *pRef = &pclient->sendRefs[i];
+        pRef->release ( pRef->pvt );
     }
+    pclient->nSendRefs = 0u;
+    pclient->send.stk = 0u;
+    pclient->sendSent = 0u;
+    pclient->sendBlocked = FALSE;
+}
 
-    if ( CASDEBUG > 2 && pclient->send.stk ) {
-        errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
+/*
+ *  cas_gather_send()
+ *
+ *  Describe the queued output following the first nSent bytes, which is
+ *  the send buffer with the referenced payloads spliced in.  Returns the
+ *  number of vector elements used, 0 when everything was sent.
+ */
+static unsigned cas_gather_send ( struct client *pclient, size_t nSent,
+    cas_iovec *pIov )
+{
+    unsigned nIov = 0u, bufPos = 0u, i;
+
+    for ( i = 0u; i <= pclient->nSendRefs; i++ ) {
+        struct send_ref *pRef = i < pclient->nSendRefs ?
+            &pclient->sendRefs[i] : NULL;
+        unsigned bufEnd = pRef ? pRef->offset : pclient->send.stk;
+        size_t size = bufEnd - bufPos;
+
+        if ( nSent >= size ) {
+            nSent -= size;
+        }
+        else {
+            pIov[nIov].iov_base = &pclient->send.buf[bufPos + nSent];
+            pIov[nIov++].iov_len = size - nSent;
+            nSent = 0u;
+        }
+        bufPos = bufEnd;
+        if ( ! pRef ) {
+            break;
+        }
+        if ( nSent >= pRef->size ) {
+            nSent -= pRef->size;
+        }
+        else {
+            pIov[nIov].iov_base = (void *) ( pRef->data + nSent );
+            pIov[nIov++].iov_len = pRef->size - nSent;
+            nSent = 0u;
+        }
     }
+    return nIov;
+}
 
-    if ( pclient->disconnect ) {
-        if ( CASDEBUG > 2 ) {
-            errlogPrintf ( "CAS: msg Discard for sock %d addr %x\n",
-                (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
+/*
+ *  cas_limit_send()
+ *
+ *  Shorten the vector to at most max bytes, so that partial sends
+ *  can be tested.  Returns the number of vector elements left.
+ */
+static unsigned cas_limit_send ( cas_iovec *pIov, unsigned nIov, size_t max )
+{
+    unsigned i;
+
+    for ( i = 0u; i < nIov; i++ ) {
+        if ( pIov[i].iov_len >= max ) {
+            pIov[i].iov_len = max;
+            return i + 1u;
         }
-        pclient->send.stk = 0u;
-        if(lock_needed)
-            SEND_UNLOCK(pclient);
-        return;
+        max -= pIov[i].iov_len;
     }
+    return nIov;
+}
+
+/*
+ *  cas_send_queued()
+ *
+ *  Send the queued output, send lock must be on.  A client served by
+ *  the I/O threads is sent to without blocking in the kernel.  Unless
+ *  wait is set, what it doesn't take right away stays queued, and an
+ *  I/O thread sends it once EPOLLOUT fires.
+ */
+static void cas_send_queued ( struct client *pclient, int wait )
+{
+    int status;
+    int flags = pclient->ioPool ? MSG_DONTWAIT : 0;
 
-    while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+    while ( ! pclient->disconnect ) {
+        cas_iovec iov[2 * CAS_MAX_SEND_REFS + 1];
+        unsigned nIov = cas_gather_send ( pclient, pclient->sendSent, iov );
+
+        if ( nIov == 0u ) {
+            cas_discard_send ( pclient );
+            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+            break;
+        }
+        if ( rsrvSendMax > 0 ) {
+            nIov = cas_limit_send ( iov, nIov, (size_t) rsrvSendMax );
+        }
+#if CAS_SEND_GATHER
+        {
+            struct msghdr msg;
+
+            memset ( &msg, 0, sizeof ( msg ) );
+            msg.msg_iov = iov;
+            msg.msg_iovlen = nIov;
+            status = sendmsg ( pclient->sock, &msg, flags );
+        }
+#else
+        status = send ( pclient->sock, (char *) iov[0].iov_base,
+            (int) iov[0].iov_len, flags );
+#endif
         if ( status >= 0 ) {
-            unsigned transferSize = (unsigned) status;
-            if ( transferSize >= pclient->send.stk ) {
-                pclient->send.stk = 0;
-                epicsTimeGetCurrent ( &pclient->time_at_last_send );
-                break;
-            }
-            else {
-                unsigned bytesLeft = pclient->send.stk - transferSize;
-                memmove ( pclient->send.buf, &pclient->send.buf[transferSize],
-                    bytesLeft );
-                pclient->send.stk = bytesLeft;
-            }
+            pclient->sendSent += (size_t) status;
         }
         else {
             int causeWasSocketHangup = 0;
@@ -85,7 +178,6 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             char buf[64];
 
             if ( pclient->disconnect ) {
-                pclient->send.stk = 0u;
                 break;
             }
 
@@ -93,6 +185,16 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 continue;
             }
 
+            if ( pclient->ioPool && ( anerrno == SOCK_EWOULDBLOCK ||
+                    anerrno == SOCK_ENOBUFS ) ) {
+                if ( ! wait ) {
+                    pclient->sendBlocked = TRUE;
+                    break;
+                }
+                casIoPoolSendWait ( pclient );
+                continue;
+            }
+
             if ( anerrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAS: Out of network buffers, retrying send in 15 seconds\n" );
@@ -117,7 +219,6 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                     buf, sockErrBuf);
             }
             pclient->disconnect = TRUE;
-            pclient->send.stk = 0u;
 
             /*
              * wakeup the receive thread
@@ -155,6 +256,43 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
         }
     }
 
+    /* a partially sent message can't be completed after a disconnect */
+    if ( pclient->disconnect ) {
+        cas_discard_send ( pclient );
+    }
+}
+
+/*
+ *  cas_send_bs_msg()
+ *
+ *  (channel access server send message)
+ *
+ *  Returns with all output sent, except on an I/O thread when the
+ *  client isn't keeping up, see cas_send_queued().
+ *
+ * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ */
+void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+{
+    if ( lock_needed ) {
+        SEND_LOCK ( pclient );
+    }
+
+    if ( CASDEBUG > 2 && pclient->send.stk ) {
+        errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
+    }
+
+    if ( pclient->disconnect ) {
+        if ( CASDEBUG > 2 ) {
+            errlogPrintf ( "CAS: msg Discard for sock %d addr %x\n",
+                (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
+        }
+        cas_discard_send ( pclient );
+    }
+    else {
+        cas_send_queued ( pclient, pclient->ioTid != epicsThreadGetIdSelf () );
+    }
+
     if ( lock_needed ) {
         SEND_UNLOCK(pclient);
     }
@@ -200,26 +338,29 @@ void cas_send_dg_msg ( struct client * pclient )
         sizeDG -= sizeof (caHdr);
     }
 
-    status = sendto ( pclient->sock, pDG, sizeDG, 0,
-       (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
-    if ( status >= 0 ) {
-        if ( status >= sizeDG ) {
-            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+    /* batched replies are sent by casUdpFlush() */
+    if ( ! casUdpQueue ( pclient, pDG, sizeDG ) ) {
+        status = sendto ( pclient->sock, pDG, sizeDG, 0,
+           (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+        if ( status >= 0 ) {
+            if ( status >= sizeDG ) {
+                epicsTimeGetCurrent ( &pclient->time_at_last_send );
+            }
+            else {
+                errlogPrintf (
+                    "CAS: System failed to send entire udp frame?\n" );
+            }
         }
         else {
-            errlogPrintf (
-                "CAS: System failed to send entire udp frame?\n" );
+            char sockErrBuf[64];
+            char buf[128];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
         }
     }
-    else {
-        char sockErrBuf[64];
-        char buf[128];
-        epicsSocketConvertErrnoToString (
-            sockErrBuf, sizeof ( sockErrBuf ) );
-        ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
-        errlogPrintf( "CAS: UDP send to %s failed: %s\n",
-            buf, sockErrBuf);
-    }
 
     pclient->send.stk = 0u;
 
@@ -236,21 +377,39 @@ void cas_send_dg_msg ( struct client * pclient )
 }
 
 /*
+ *  cas_make_room()
  *
- *  cas_copy_in_header()
+ *  The client didn't take all queued output from an I/O thread.  Grow
+ *  the send buffer for one more message instead of waiting, camessage()
+ *  processes no further requests until the client catches up.  Wait
+ *  only when the buffer can't grow.
+ */
+static void cas_make_room ( struct client *pclient, unsigned msgSize,
+    int needRef )
+{
+    if ( ! needRef && pclient->send.stk <= UINT_MAX - msgSize ) {
+        casExpandSendBuffer ( pclient, pclient->send.stk + msgSize );
+        if ( pclient->send.stk <= pclient->send.maxstk - msgSize ) {
+            return;
+        }
+    }
+    cas_send_queued ( pclient, TRUE );
+}
+
+/*
+ *  cas_reserve_msg()
  *
- *  Allocate space in the outgoing message buffer and
- *  copy in message header. Return pointer to message body.
+ *  Fill in the header of a message with payloadSize bytes of payload and
+ *  make sure that it fits into the send buffer together with reserveSize
+ *  bytes of payload.  With needRef space for one send_ref is made, too.
  *
  *  send lock must be on while in this routine
- *
- *  Returns a valid ptr to message body or NULL if the msg
- *  will not fit.
  */
-int cas_copy_in_header (
+static int cas_reserve_msg (
     struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
-    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
-    ca_uint32_t responseSpecific, void **ppPayload )
+    ca_uint32_t reserveSize, int needRef, ca_uint16_t dataType,
+    ca_uint32_t nElem, ca_uint32_t cid, ca_uint32_t responseSpecific,
+    void **ppPayload )
 {
     unsigned    msgSize;
     ca_uint32_t alignedPayloadSize;
@@ -262,7 +421,7 @@ int cas_copy_in_header (
 
     alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
 
-    msgSize = alignedPayloadSize + sizeof ( caHdr );
+    msgSize = reserveSize + sizeof ( caHdr );
     if ( alignedPayloadSize >= 0xffff || nElem >= 0xffff ) {
         if ( ! CA_V49 ( pclient->minor_version_number ) ) {
             return ECA_16KARRAYCLIENT;
@@ -277,13 +436,17 @@ int cas_copy_in_header (
         }
     }
 
-    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+    if ( pclient->send.stk > pclient->send.maxstk - msgSize ||
+            ( needRef && pclient->nSendRefs >= CAS_MAX_SEND_REFS ) ) {
         if ( pclient->disconnect ) {
-            pclient->send.stk = 0;
+            cas_discard_send ( pclient );
         }
         else{
             if ( pclient->proto == IPPROTO_TCP) {
                 cas_send_bs_msg ( pclient, FALSE );
+                if ( pclient->sendBlocked ) {
+                    cas_make_room ( pclient, msgSize, needRef );
+                }
             }
             else if ( pclient->proto == IPPROTO_UDP ) {
                 cas_send_dg_msg ( pclient );
@@ -315,6 +478,42 @@ int cas_copy_in_header (
             *ppPayload = (void *) (pW32 + 2);
     }
 
+    return ECA_NORMAL;
+}
+
+/*
+ *
+ *  cas_copy_in_header()
+ *
+ *  Allocate space in the outgoing message buffer and
+ *  copy in message header. Return pointer to message body.
+ *
+ *  send lock must be on while in this routine
+ *
+ *  Returns a valid ptr to message body or NULL if the msg
+ *  will not fit.
+ */
+int cas_copy_in_header (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific, void **ppPayload )
+{
+    ca_uint32_t alignedPayloadSize;
+    int status;
+
+    if ( payloadSize > UINT_MAX - sizeof ( caHdr ) - 8u ) {
+        return ECA_TOLARGE;
+    }
+
+    alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
+
+    status = cas_reserve_msg ( pclient, response, payloadSize,
+        alignedPayloadSize, FALSE, dataType, nElem, cid, responseSpecific,
+        ppPayload );
+    if ( status != ECA_NORMAL ) {
+        return status;
+    }
+
     /* zero out pad bytes */
     if ( alignedPayloadSize > payloadSize ) {
         char *p = ( char * ) *ppPayload;
@@ -325,6 +524,27 @@ int cas_copy_in_header (
     return ECA_NORMAL;
 }
 
+/*
+ *  cas_copy_in_header_ref()
+ *
+ *  Like cas_copy_in_header(), but only reserveSize bytes of the payload
+ *  are allocated in the send buffer.  The message must be completed with
+ *  cas_commit_msg_ref(), which queues the bulk of the payload by reference
+ *  so that it is sent without being copied into the send buffer.
+ */
+int cas_copy_in_header_ref (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint32_t reserveSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific, void **ppPayload )
+{
+    if ( pclient->proto != IPPROTO_TCP ) {
+        return ECA_INTERNAL;
+    }
+    return cas_reserve_msg ( pclient, response, payloadSize,
+        CA_MESSAGE_ALIGN ( reserveSize ), TRUE, dataType, nElem, cid,
+        responseSpecific, ppPayload );
+}
+
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t cid )
 {
     caHdr *pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
@@ -365,6 +585,48 @@ void cas_commit_msg ( struct client *pClient, ca_uint32_t size )
     pClient->send.stk += size;
 }
 
+/*
+ *  cas_commit_msg_ref()
+ *
+ *  Commit a message started with cas_copy_in_header_ref().  The payload
+ *  consists of headSize bytes already in the send buffer, refSize bytes
+ *  at pRef, and zeros up to the size given to cas_copy_in_header_ref().
+ *  pRef must stay valid until release(pvt) is called.
+ */
+void cas_commit_msg_ref ( struct client *pClient, ca_uint32_t headSize,
+    const void *pRef, ca_uint32_t refSize,
+    void (*release) ( void *pvt ), void *pvt )
+{
+    caHdr * pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
+    struct send_ref *pSendRef;
+    ca_uint32_t size, tail;
+
+    if ( pMsg->m_postsize == htons ( 0xffff ) ) {
+        ca_uint32_t * pLW = ( ca_uint32_t * ) ( pMsg + 1 );
+        size = ntohl ( *pLW );
+        pClient->send.stk += sizeof ( caHdr ) + 2 * sizeof ( *pLW );
+    }
+    else {
+        size = ntohs ( pMsg->m_postsize );
+        pClient->send.stk += sizeof ( caHdr );
+    }
+    assert ( headSize + refSize <= size );
+    assert ( pClient->nSendRefs < CAS_MAX_SEND_REFS );
+    pClient->send.stk += headSize;
+
+    pSendRef = &pClient->sendRefs[pClient->nSendRefs++];
+    pSendRef->offset = pClient->send.stk;
+    pSendRef->data = ( const char * ) pRef;
+    pSendRef->size = refSize;
+    pSendRef->release = release;
+    pSendRef->pvt = pvt;
+
+    tail = size - headSize - refSize;
+    assert ( tail <= pClient->send.maxstk - pClient->send.stk );
+    memset ( &pClient->send.buf[pClient->send.stk], '\0', tail );
+    pClient->send.stk += tail;
+}
+
 /*
  * this assumes that we have already checked to see
  * if sufficent bytes are available
@@ -106,6 +106,10 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( casIoPoolThreads () && casIoPoolAdd ( pClient ) == 0 ) {
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -556,8 +560,9 @@ void rsrv_init (void)
      *  Name receiver: epicsThreadPriorityCAServerLow-4
      * Now starting global
      *  Beacon sender: epicsThreadPriorityCAServerLow-3
-     * Started later per TCP client
+     * Started later per TCP client, or once if rsrvIoThreads > 0
      *  TCP receiver: epicsThreadPriorityCAServerLow
+     * Started later per TCP client
      *  TCP sender : epicsThreadPriorityCAServerLow-1
      */
     {
@@ -575,6 +580,10 @@ void rsrv_init (void)
         }
     }
 
+    if ( rsrvIoThreads > 0 ) {
+        casIoPoolInit ( (unsigned) rsrvIoThreads, threadPrios[0] );
+    }
+
     {
         unsigned short sport = ca_server_port;
         char buf[6]; /* space for 0 - 65535 */
@@ -938,6 +947,11 @@ void casr (unsigned level)
     }
     UNLOCK_CLIENTQ
 
+    if ( casIoPoolThreads () ) {
+        printf ( "TCP clients served by %u I/O threads.\n",
+            casIoPoolThreads () );
+    }
+
     if (level>=1) {
         rsrv_iface_config *iface = (rsrv_iface_config *) ellFirst ( &servers );
         while (iface) {
@@ -954,15 +968,18 @@ void casr (unsigned level)
 #else
             if (iface->udpbcast==INVALID_SOCKET) {
                 printf("    CAS-UDP name server on %s\n", buf);
+                casUdpStats(iface->client);
                 if (level >= 2)
                     log_one_client(iface->client, level - 2);
             }
             else {
                 printf("    CAS-UDP unicast name server on %s\n", buf);
+                casUdpStats(iface->client);
                 if (level >= 2)
                     log_one_client(iface->client, level - 2);
                 ipAddrToDottedIP (&iface->udpbcastAddr.ia, buf, sizeof(buf));
                 printf("    CAS-UDP broadcast name server on %s\n", buf);
+                casUdpStats(iface->bclient);
                 if (level >= 2)
                     log_one_client(iface->bclient, level - 2);
             }
@@ -1070,6 +1087,8 @@ void destroy_client ( struct client *client )
     }
 
     if ( client->proto == IPPROTO_TCP ) {
+        /* release payloads still queued by reference */
+        cas_discard_send ( client );
         if ( client->send.buf ) {
             if ( client->send.type == mbtSmallTCP ) {
                 freeListFree ( rsrvSmallBufFreeListTCP,  client->send.buf );
@@ -1302,6 +1321,7 @@ struct client * create_client ( SOCKET sock, int proto )
     }
     client->send.stk = 0u;
     client->send.cnt = 0u;
+    client->nSendRefs = 0u;
     client->recv.stk = 0u;
     client->recv.cnt = 0u;
     client->evuser = NULL;
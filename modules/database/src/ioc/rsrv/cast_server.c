@@ -37,6 +37,12 @@
 #include <string.h>
 #include <errno.h>
 
+#ifdef __linux__
+#   include <sys/socket.h>
+#   define CAS_UDP_BATCH
+#endif
+
+#include "cantProceed.h"
 #include "dbDefs.h"
 #include "envDefs.h"
 #include "epicsMutex.h"
@@ -107,6 +113,392 @@ static void clean_addrq(struct client *client)
 
 }
 
+/*
+ * cast_process ()
+ *
+ * handle one datagram, which is in client->recv
+ */
+static void cast_process(struct client *client,
+    const struct sockaddr_in *pRecvAddr, unsigned nBytes)
+{
+    int status;
+    int count = 0;
+
+    client->recv.cnt = nBytes;
+    client->recv.stk = 0ul;
+    epicsTimeGetCurrent(&client->time_at_last_recv);
+
+    client->minor_version_number = CA_UKN_MINOR_VERSION;
+    client->seqNoOfReq = 0;
+
+    /*
+     * If we are talking to a new client flush to the old one
+     * in case we are holding UDP messages waiting to
+     * see if the next message is for this same client.
+     */
+    if (client->send.stk>sizeof(caHdr)) {
+        status = memcmp(&client->addr,
+            pRecvAddr, sizeof(*pRecvAddr));
+        if(status){
+            /*
+             * if the address is different
+             */
+            cas_send_dg_msg(client);
+            client->addr = *pRecvAddr;
+        }
+    }
+    else {
+        client->addr = *pRecvAddr;
+    }
+
+    if (CASDEBUG>1) {
+        char    buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
+            client->recv.cnt, buf);
+    }
+
+    if (CASDEBUG>2)
+        count = ellCount (&client->chanList);
+
+    status = camessage ( client );
+    if(status == RSRV_OK){
+        if(client->recv.cnt !=
+            client->recv.stk){
+            char buf[40];
+
+            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+            epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
+                client->recv.cnt - client->recv.stk, buf);
+
+            epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+                &client->time_at_last_recv);
+            epicsPrintf ("CAS: message received at %s\n", buf);
+        }
+    }
+    else if (CASDEBUG>0){
+        char buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+        epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
+
+        epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+            &client->time_at_last_recv);
+        epicsPrintf ("CAS: message received at %s\n", buf);
+    }
+
+    if (CASDEBUG>2) {
+        if ( ellCount (&client->chanList) ) {
+            errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
+                ellCount(&client->chanList)-count,
+                ellCount(&client->chanList));
+        }
+    }
+}
+
+static int cast_ignored(const struct sockaddr_in *pRecvAddr)
+{
+    size_t idx;
+
+    for(idx=0; casIgnoreAddrs[idx]; idx++)
+    {
+        if(pRecvAddr->sin_addr.s_addr==casIgnoreAddrs[idx])
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static void cast_recv_error(void)
+{
+    if (SOCKERRNO != SOCK_EINTR) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        epicsPrintf ("CAS: UDP recv error: %s\n",
+                sockErrBuf);
+        epicsThreadSleep(1.0);
+    }
+}
+
+/*
+ * cast_idle ()
+ *
+ * allow messages to batch up if more are coming
+ */
+static void cast_idle(struct client *client, SOCKET recv_sock)
+{
+    osiSockIoctl_t nchars = 0; /* suppress purify warning */
+    int status = socket_ioctl(recv_sock, FIONREAD, &nchars);
+
+    if (status<0) {
+        errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
+    }
+    else if (nchars != 0) {
+        return;
+    }
+    cas_send_dg_msg (client);
+    SEND_LOCK (client);
+    casUdpFlush (client);
+    SEND_UNLOCK (client);
+    clean_addrq (client);
+}
+
+#ifdef CAS_UDP_BATCH
+
+/*
+ * Search requests and replies are received and sent in batches with
+ * recvmmsg() and sendmmsg().  Replies are copied into the batch by
+ * cas_send_dg_msg(), and are sent when the batch is full or no more
+ * requests are pending.  Each receive slot takes a datagram as large as
+ * the unbatched receive buffer (MAX_UDP_RECV), so that requests from
+ * clients which pack many searches into one datagram aren't lost.  As
+ * that is 64k per slot, a server starts with one slot and doubles their
+ * number whenever a call fills all of them, up to CAS_UDP_BATCH_SIZE.
+ */
+#define CAS_UDP_BATCH_SIZE 32u
+#define CAS_UDP_SLOT_SIZE MAX_UDP_RECV
+
+typedef struct casUdpBatch {
+    struct mmsghdr      recvMsgs[CAS_UDP_BATCH_SIZE];
+    struct iovec        recvIov[CAS_UDP_BATCH_SIZE];
+    struct sockaddr_in  recvAddrs[CAS_UDP_BATCH_SIZE];
+    char                *recvBufs[CAS_UDP_BATCH_SIZE];
+    unsigned            nRecv;      /* slots allocated */
+    struct mmsghdr      sendMsgs[CAS_UDP_BATCH_SIZE];
+    struct iovec        sendIov[CAS_UDP_BATCH_SIZE];
+    struct sockaddr_in  sendAddrs[CAS_UDP_BATCH_SIZE];
+    char                sendBufs[CAS_UDP_BATCH_SIZE][MAX_UDP_SEND];
+    unsigned            nSend;
+    /* statistics */
+    size_t              recvCalls;
+    size_t              recvDatagrams;
+    size_t              sendCalls;
+    size_t              sendDatagrams;
+    size_t              dropped;
+} casUdpBatch;
+
+/* Add receive slots, up to n in total */
+static void casUdpBatchGrow(casUdpBatch *pBatch, unsigned n)
+{
+    if (n > CAS_UDP_BATCH_SIZE)
+        n = CAS_UDP_BATCH_SIZE;
+    while (pBatch->nRecv < n) {
+        unsigned i = pBatch->nRecv;
+        char *pBuf = malloc(CAS_UDP_SLOT_SIZE);
+
+        if (!pBuf)
+            break;  /* carry on with fewer slots */
+        pBatch->recvBufs[i] = pBuf;
+        pBatch->recvIov[i].iov_base = pBuf;
+        pBatch->recvIov[i].iov_len = CAS_UDP_SLOT_SIZE;
+        pBatch->recvMsgs[i].msg_hdr.msg_iov = &pBatch->recvIov[i];
+        pBatch->recvMsgs[i].msg_hdr.msg_iovlen = 1;
+        pBatch->nRecv++;
+    }
+}
+
+static casUdpBatch * casUdpBatchCreate(void)
+{
+    casUdpBatch *pBatch = callocMustSucceed(1, sizeof(casUdpBatch),
+        "casUdpBatchCreate");
+    unsigned i;
+
+    for (i = 0; i < CAS_UDP_BATCH_SIZE; i++) {
+        pBatch->sendIov[i].iov_base = pBatch->sendBufs[i];
+        pBatch->sendMsgs[i].msg_hdr.msg_iov = &pBatch->sendIov[i];
+        pBatch->sendMsgs[i].msg_hdr.msg_iovlen = 1;
+        pBatch->sendMsgs[i].msg_hdr.msg_name = &pBatch->sendAddrs[i];
+        pBatch->sendMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+    }
+    casUdpBatchGrow(pBatch, 1u);
+    if (!pBatch->nRecv)
+        cantProceed("casUdpBatchCreate");
+    return pBatch;
+}
+
+static void casUdpBatchDestroy(casUdpBatch *pBatch)
+{
+    unsigned i;
+
+    if (!pBatch)
+        return;
+    for (i = 0; i < pBatch->nRecv; i++)
+        free(pBatch->recvBufs[i]);
+    free(pBatch);
+}
+
+/*
+ *  casUdpQueue()
+ *
+ *  Copy a reply datagram to the client's address into the send batch.
+ *  Returns FALSE if the client does not batch its replies.
+ *
+ *  send lock must be on while in this routine
+ */
+int casUdpQueue ( struct client *pclient, const char *pDG, unsigned size )
+{
+    casUdpBatch *pBatch = pclient->udpBatch;
+    unsigned i;
+
+    if ( ! pBatch ) {
+        return FALSE;
+    }
+    if ( pBatch->nSend >= CAS_UDP_BATCH_SIZE ) {
+        casUdpFlush ( pclient );
+    }
+    i = pBatch->nSend++;
+    memcpy ( pBatch->sendBufs[i], pDG, size );
+    pBatch->sendIov[i].iov_len = size;
+    pBatch->sendAddrs[i] = pclient->addr;
+    return TRUE;
+}
+
+/*
+ *  casUdpFlush()
+ *
+ *  send the batched replies
+ *
+ *  send lock must be on while in this routine
+ */
+void casUdpFlush ( struct client *pclient )
+{
+    casUdpBatch *pBatch = pclient->udpBatch;
+    unsigned next = 0u;
+
+    if ( ! pBatch ) {
+        return;
+    }
+    while ( next < pBatch->nSend ) {
+        int status = sendmmsg ( pclient->sock, &pBatch->sendMsgs[next],
+            pBatch->nSend - next, 0 );
+
+        pBatch->sendCalls++;
+        if ( status > 0 ) {
+            unsigned i;
+
+            for ( i = next; i < next + status; i++ ) {
+                if ( pBatch->sendMsgs[i].msg_len < pBatch->sendIov[i].iov_len ) {
+                    errlogPrintf (
+                        "CAS: System failed to send entire udp frame?\n" );
+                }
+            }
+            pBatch->sendDatagrams += status;
+            next += status;
+            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+        }
+        else if ( status < 0 && SOCKERRNO == SOCK_EINTR ) {
+            continue;
+        }
+        else {
+            /* report and skip the datagram which failed */
+            char sockErrBuf[64];
+            char buf[128];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pBatch->sendAddrs[next], buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
+            next++;
+        }
+    }
+    pBatch->nSend = 0u;
+}
+
+void casUdpStats ( struct client *pclient )
+{
+    casUdpBatch *pBatch = pclient ? pclient->udpBatch : NULL;
+
+    if ( ! pBatch ) {
+        return;
+    }
+    printf ( "        Received %lu datagrams with %lu calls (%.1f per call), "
+        "%lu dropped, %u slots\n",
+        (unsigned long) pBatch->recvDatagrams,
+        (unsigned long) pBatch->recvCalls,
+        pBatch->recvCalls ?
+            (double) pBatch->recvDatagrams / pBatch->recvCalls : 0.0,
+        (unsigned long) pBatch->dropped, pBatch->nRecv );
+    printf ( "        Sent %lu datagrams with %lu calls (%.1f per call)\n",
+        (unsigned long) pBatch->sendDatagrams,
+        (unsigned long) pBatch->sendCalls,
+        pBatch->sendCalls ?
+            (double) pBatch->sendDatagrams / pBatch->sendCalls : 0.0 );
+}
+
+static void cast_recv_batch(struct client *client, SOCKET recv_sock)
+{
+    casUdpBatch *pBatch = client->udpBatch;
+    char *pRecvBuf = client->recv.buf;
+    unsigned maxstk = client->recv.maxstk;
+    int status;
+    int i;
+
+    for (i = 0; i < pBatch->nRecv; i++) {
+        pBatch->recvMsgs[i].msg_hdr.msg_name = &pBatch->recvAddrs[i];
+        pBatch->recvMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        pBatch->recvMsgs[i].msg_hdr.msg_flags = 0;
+    }
+
+    /* block for the first datagram, take the others which are pending */
+    status = recvmmsg(recv_sock, pBatch->recvMsgs, pBatch->nRecv,
+        MSG_WAITFORONE, NULL);
+    if (status < 0) {
+        cast_recv_error();
+        return;
+    }
+    pBatch->recvCalls++;
+    pBatch->recvDatagrams += status;
+    /* more may be pending, take them with the next call */
+    if (status == (int) pBatch->nRecv)
+        casUdpBatchGrow(pBatch, 2u * pBatch->nRecv);
+
+    if (casudp_ctl != ctlRun)
+        return;
+
+    for (i = 0; i < status; i++) {
+        struct mmsghdr *pMsg = &pBatch->recvMsgs[i];
+        const struct sockaddr_in *pAddr = &pBatch->recvAddrs[i];
+
+        if (cast_ignored(pAddr))
+            continue;
+        if (pMsg->msg_hdr.msg_flags & MSG_TRUNC) {
+            if (CASDEBUG>0) {
+                char buf[40];
+
+                ipAddrToDottedIP (pAddr, buf, sizeof(buf));
+                epicsPrintf ("CAS: oversized UDP msg from %s dropped\n", buf);
+            }
+            pBatch->dropped++;
+            continue;
+        }
+        client->recv.buf = pBatch->recvBufs[i];
+        client->recv.maxstk = CAS_UDP_SLOT_SIZE;
+        cast_process(client, pAddr, pMsg->msg_len);
+    }
+    client->recv.buf = pRecvBuf;
+    client->recv.maxstk = maxstk;
+}
+
+#else /* CAS_UDP_BATCH */
+
+int casUdpQueue ( struct client *pclient, const char *pDG, unsigned size )
+{
+    return FALSE;
+}
+
+void casUdpFlush ( struct client *pclient )
+{
+}
+
+void casUdpStats ( struct client *pclient )
+{
+}
+
+#endif /* CAS_UDP_BATCH */
+
 /*
  * CAST_SERVER
  *
@@ -116,17 +508,10 @@ static void clean_addrq(struct client *client)
 void cast_server(void *pParm)
 {
     rsrv_iface_config *conf = pParm;
-    int                 status;
-    int                 count=0;
     int                 mysocket=0;
-    struct sockaddr_in  new_recv_addr;
-    osiSocklen_t        recv_addr_size;
-    osiSockIoctl_t      nchars;
     SOCKET              recv_sock, reply_sock;
     struct client      *client;
 
-    recv_addr_size = sizeof(new_recv_addr);
-
     reply_sock = conf->udp;
 
     /*
@@ -161,10 +546,19 @@ void cast_server(void *pParm)
     /* these pointers become invalid after signaling casudp_startStopEvent */
     conf = NULL;
 
+#ifdef CAS_UDP_BATCH
+    client->udpBatch = casUdpBatchCreate ();
+#endif
+
     epicsEventSignal(casudp_startStopEvent);
 
     while (TRUE) {
-        status = recvfrom (
+#ifdef CAS_UDP_BATCH
+        cast_recv_batch (client, recv_sock);
+#else
+        struct sockaddr_in  new_recv_addr;
+        osiSocklen_t        recv_addr_size = sizeof(new_recv_addr);
+        int                 status = recvfrom (
             recv_sock,
             client->recv.buf,
             client->recv.maxstk,
@@ -172,122 +566,24 @@ void cast_server(void *pParm)
             (struct sockaddr *)&new_recv_addr,
             &recv_addr_size);
         if (status < 0) {
-            if (SOCKERRNO != SOCK_EINTR) {
-                char sockErrBuf[64];
-                epicsSocketConvertErrnoToString (
-                    sockErrBuf, sizeof ( sockErrBuf ) );
-                epicsPrintf ("CAS: UDP recv error: %s\n",
-                        sockErrBuf);
-                epicsThreadSleep(1.0);
-            }
-
-        } else {
-            size_t idx;
-            for(idx=0; casIgnoreAddrs[idx]; idx++)
-            {
-                if(new_recv_addr.sin_addr.s_addr==casIgnoreAddrs[idx]) {
-                    status = -1; /* ignore */
-                    break;
-                }
-            }
+            cast_recv_error();
         }
-
-        if (status >= 0 && casudp_ctl == ctlRun) {
-            client->recv.cnt = (unsigned) status;
-            client->recv.stk = 0ul;
-            epicsTimeGetCurrent(&client->time_at_last_recv);
-
-            client->minor_version_number = CA_UKN_MINOR_VERSION;
-            client->seqNoOfReq = 0;
-
-            /*
-             * If we are talking to a new client flush to the old one
-             * in case we are holding UDP messages waiting to
-             * see if the next message is for this same client.
-             */
-            if (client->send.stk>sizeof(caHdr)) {
-                status = memcmp(&client->addr,
-                    &new_recv_addr, recv_addr_size);
-                if(status){
-                    /*
-                     * if the address is different
-                     */
-                    cas_send_dg_msg(client);
-                    client->addr = new_recv_addr;
-                }
-            }
-            else {
-                client->addr = new_recv_addr;
-            }
-
-            if (CASDEBUG>1) {
-                char    buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-                errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
-                    client->recv.cnt, buf);
-            }
-
-            if (CASDEBUG>2)
-                count = ellCount (&client->chanList);
-
-            status = camessage ( client );
-            if(status == RSRV_OK){
-                if(client->recv.cnt !=
-                    client->recv.stk){
-                    char buf[40];
-
-                    ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                    epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
-                        client->recv.cnt - client->recv.stk, buf);
-
-                    epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                        &client->time_at_last_recv);
-                    epicsPrintf ("CAS: message received at %s\n", buf);
-                }
-            }
-            else if (CASDEBUG>0){
-                char buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
-
-                epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                    &client->time_at_last_recv);
-                epicsPrintf ("CAS: message received at %s\n", buf);
-            }
-
-            if (CASDEBUG>2) {
-                if ( ellCount (&client->chanList) ) {
-                    errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
-                        ellCount(&client->chanList)-count,
-                        ellCount(&client->chanList));
-                }
-            }
+        else if (!cast_ignored(&new_recv_addr) && casudp_ctl == ctlRun) {
+            cast_process(client, &new_recv_addr, (unsigned) status);
         }
+#endif
 
-        /*
-         * allow messages to batch up if more are coming
-         */
-        nchars = 0; /* suppress purify warning */
-        status = socket_ioctl(recv_sock, FIONREAD, &nchars);
-        if (status<0) {
-            errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
-            cas_send_dg_msg (client);
-            clean_addrq (client);
-        }
-        else if (nchars == 0) {
-            cas_send_dg_msg (client);
-            clean_addrq (client);
-        }
+        cast_idle (client, recv_sock);
     }
 
     /* ATM never reached, just a placeholder */
 
     if(!mysocket)
         client->sock = INVALID_SOCKET; /* only one cast_server should destroy the reply socket */
+#ifdef CAS_UDP_BATCH
+    casUdpBatchDestroy(client->udpBatch);
+    client->udpBatch = NULL;
+#endif
     destroy_client(client);
     epicsSocketDestroy(recv_sock);
 }
@@ -63,12 +63,30 @@ struct message_buffer {
   enum messageBufferType    type;
 };
 
+/*
+ * Payload sent from outside of the send buffer, in between the bytes
+ * before and after offset.  release(pvt) is called once it is sent.
+ */
+#define CAS_MAX_SEND_REFS 16
+struct send_ref {
+  unsigned                  offset;
+  const char                *data;
+  size_t                    size;
+  void                      (*release) ( void *pvt );
+  void                      *pvt;
+};
+
 extern epicsThreadPrivateId rsrvCurrentClient;
 
 typedef struct client {
   ELLNODE               node;
   /*! guarded by SEND_LOCK()  aka. client::lock */
   struct message_buffer send;
+  /*! guarded by SEND_LOCK(), payloads queued with cas_commit_msg_ref() */
+  struct send_ref       sendRefs[CAS_MAX_SEND_REFS];
+  unsigned              nSendRefs;
+  /*! guarded by SEND_LOCK(), bytes of the queued output already sent */
+  size_t                sendSent;
   /*! accessed by receive thread w/o locks cf. camsgtask() */
   struct message_buffer recv;
   epicsMutexId          lock;
@@ -86,12 +104,19 @@ typedef struct client {
   char                  *pHostName;
   epicsEventId          blockSem; /* used whenever the client blocks */
   SOCKET                sock, udpRecv;
+  struct casUdpBatch    *udpBatch; /* UDP only, see cast_server.c */
   int                   proto;
   epicsThreadId         tid;
   unsigned              minor_version_number;
   ca_uint32_t           seqNoOfReq; /* for udp  */
   unsigned              recvBytesToDrain;
   unsigned              priority;
+  epicsThreadId         ioTid; /* CAS-io thread serving the client now */
+  char                  ioPool; /* served by the CAS-io threads */
+  char                  sendBlocked; /* queued output waits for EPOLLOUT */
+  char                  recvHeld; /* requests left in recv for the next pass */
+  char                  recvParked; /* guarded by putNotifyLock, waits for a put notify */
+  char                  ioParked; /* guarded by putNotifyLock, socket not armed meanwhile */
   char                  disconnect; /* disconnect detected */
 } client;
 
@@ -180,6 +205,8 @@ enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
 #endif
 
 GLBLTYPE int                CASDEBUG;
+GLBLTYPE int                rsrvIoThreads;
+GLBLTYPE int                rsrvSendMax; /* only set by tests */
 GLBLTYPE unsigned short     ca_server_port, ca_udp_port, ca_beacon_port;
 GLBLTYPE ELLLIST            clientQ             GLBLTYPE_INIT(ELLLIST_INIT);
 GLBLTYPE ELLLIST            servers; /* rsrv_iface_config::node, read-only after rsrv_init() */
@@ -209,6 +236,9 @@ GLBLTYPE unsigned int       threadPrios[5];
 
 #define CAS_HASH_TABLE_SIZE 4096
 
+/* a request handler stopped, camessage() retries the request later */
+#define RSRV_PARKED 1
+
 #define SEND_LOCK(CLIENT) epicsMutexMustLock((CLIENT)->lock)
 #define SEND_UNLOCK(CLIENT) epicsMutexUnlock((CLIENT)->lock)
 
@@ -220,10 +250,18 @@ extern "C" {
 #endif
 
 void camsgtask (void *client);
+unsigned casIoPoolInit ( unsigned nThreads, unsigned priority );
+int casIoPoolAdd ( struct client *client );
+unsigned casIoPoolThreads ( void );
+void casIoPoolSendWait ( struct client *client );
+void casIoPoolResume ( struct client *client );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
 void cas_send_dg_msg ( struct client *pclient );
 void rsrv_online_notify_task (void *);
 void cast_server (void *);
+int casUdpQueue ( struct client *pclient, const char *pDG, unsigned size );
+void casUdpFlush ( struct client *pclient );
+void casUdpStats ( struct client *pclient );
 struct client *create_client ( SOCKET sock, int proto );
 void destroy_client ( struct client * );
 struct client *create_tcp_client ( SOCKET sock, const osiSockAddr* peerAddr );
@@ -254,6 +292,14 @@ int cas_copy_in_header (
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t );
 void cas_set_header_count (struct client *pClient, ca_uint32_t count);
 void cas_commit_msg ( struct client *pClient, ca_uint32_t size );
+int cas_copy_in_header_ref (
+    struct client *pClient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint32_t headSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific, void **pPayload );
+void cas_commit_msg_ref ( struct client *pClient, ca_uint32_t headSize,
+    const void *pRef, ca_uint32_t refSize,
+    void (*release) ( void *pvt ), void *pvt );
+void cas_discard_send ( struct client *pClient );
 
 #ifdef __cplusplus
 }
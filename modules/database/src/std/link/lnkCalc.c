@@ -61,6 +61,9 @@ typedef struct calc_link {
     char *post_expr;
     char *post_major;
     char *post_minor;
+    calcCompiled *comp_expr;
+    calcCompiled *comp_major;
+    calcCompiled *comp_minor;
     char *units;
     short tinp;
     struct link inp[CALCPERFORM_NARGS];
@@ -73,6 +76,13 @@ typedef struct calc_link {
 
 static lset lnkCalc_lset;
 
+static long doCalc(double *parg, double *presult, const char *post,
+    const calcCompiled *comp)
+{
+    return comp ? calcPerformCompiled(parg, presult, comp) :
+        calcPerform(parg, presult, post);
+}
+
 
 /*************************** jlif Routines **************************/
 
@@ -116,6 +126,9 @@ static void lnkCalc_free(jlink *pjlink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcCompiledFree(clink->comp_expr);
+    calcCompiledFree(clink->comp_major);
+    calcCompiledFree(clink->comp_minor);
     free(clink->units);
     free(clink);
 }
@@ -226,6 +239,14 @@ static jlif_result lnkCalc_string(jlink *pjlink, const char *val, size_t len)
         return jlif_stop;
     }
 
+    /* NULL if it can't be compiled, the postfix is used instead */
+    if (clink->pstate == ps_major)
+        clink->comp_major = calcCompile(postbuf);
+    else if (clink->pstate == ps_minor)
+        clink->comp_minor = calcCompile(postbuf);
+    else
+        clink->comp_expr = calcCompile(postbuf);
+
     return jlif_continue;
 }
 
@@ -489,6 +510,9 @@ static void lnkCalc_remove(struct dbLocker *locker, struct link *plink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcCompiledFree(clink->comp_expr);
+    calcCompiledFree(clink->comp_major);
+    calcCompiledFree(clink->comp_minor);
     free(clink->units);
     free(clink);
     plink->value.json.jlink = NULL;
@@ -591,7 +615,7 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     clink->amsg[0] = '\0';
 
     if (clink->post_expr) {
-        status = calcPerform(clink->arg, &clink->val, clink->post_expr);
+        status = doCalc(clink->arg, &clink->val, clink->post_expr, clink->comp_expr);
         if (!status)
             status = conv(&clink->val, pbuffer, NULL);
         if (!status && pnRequest)
@@ -606,7 +630,7 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     if (!status && clink->post_major) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_major);
+        status = doCalc(clink->arg, &alval, clink->post_major, clink->comp_major);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MAJOR_ALARM;
@@ -618,7 +642,7 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     if (!status && !clink->sevr && clink->post_minor) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_minor);
+        status = doCalc(clink->arg, &alval, clink->post_minor, clink->comp_minor);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MINOR_ALARM;
@@ -674,12 +698,12 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
     status = conv(pbuffer, &clink->val, NULL);
 
     if (!status && clink->post_expr)
-        status = calcPerform(clink->arg, &clink->val, clink->post_expr);
+        status = doCalc(clink->arg, &clink->val, clink->post_expr, clink->comp_expr);
 
     if (!status && clink->post_major) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_major);
+        status = doCalc(clink->arg, &alval, clink->post_major, clink->comp_major);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MAJOR_ALARM;
@@ -691,7 +715,7 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
     if (!status && !clink->sevr && clink->post_minor) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_minor);
+        status = doCalc(clink->arg, &alval, clink->post_minor, clink->comp_minor);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MINOR_ALARM;
@@ -238,7 +238,9 @@ static long process(struct dbCommon *pcommon)
                 (&prec->neva)[i]);
     }
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     recGblFwdLink(prec);
     prec->pact = FALSE;
 
@@ -165,15 +165,20 @@ static long process(struct dbCommon *pcommon)
         return S_dev_missingSup;
     }
 
+    /* NORD posted by device support goes out with the value */
+    db_post_events_begin(prec);
     status = readValue(prec); /* read the new value */
-    if (!pact && prec->pact)
+    if (!pact && prec->pact) {
+        db_post_events_commit(prec);
         return 0;
+    }
 
     prec->pact = TRUE;
     prec->udf = FALSE;
     recGblGetTimeStampSimm(prec, prec->simm, &prec->siol);
 
     monitor(prec);
+    db_post_events_commit(prec);
     /* process the forward scan link record */
     recGblFwdLink(prec);
 
@@ -180,7 +180,9 @@ static long process(struct dbCommon *pcommon)
         recGblGetTimeStampSimm(prec, prec->simm, NULL);
     }
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     /* process the forward scan link record */
     recGblFwdLink(prec);
 
@@ -163,7 +163,9 @@ static long process(struct dbCommon *pcommon)
     /* check for alarms */
     checkAlarms(prec,&timeLast);
     /* check event list */
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     /* process the forward scan link record */
         recGblFwdLink(prec);
 
@@ -229,7 +229,9 @@ static long process(struct dbCommon *pcommon)
     }
 
     /* check event list */
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* process the forward scan link record */
         recGblFwdLink(prec);
@@ -108,6 +108,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->rpcc = calcCompile(prec->rpcl);
     return 0;
 }
 
@@ -118,7 +120,9 @@ static long process(struct dbCommon *pcommon)
 
     prec->pact = TRUE;
     if (fetch_values(prec) == 0) {
-        if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+        if (prec->rpcc ?
+            calcPerformCompiled(&prec->a, &prec->val, prec->rpcc) :
+            calcPerform(&prec->a, &prec->val, prec->rpcl)) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else
             prec->udf = isnan(prec->val);
@@ -129,7 +133,9 @@ static long process(struct dbCommon *pcommon)
     /* check for alarms */
     checkAlarms(prec, &timeLast);
     /* check event list */
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     /* process the forward scan link record */
     recGblFwdLink(prec);
     prec->pact = FALSE;
@@ -143,6 +149,8 @@ static long special(DBADDR *paddr, int after)
 
     if (!after) return 0;
     if (paddr->special == SPC_CALC) {
+        calcCompiledFree(prec->rpcc);
+        prec->rpcc = NULL;
         if (postfix(prec->calc, prec->rpcl, &error_number)) {
             recGblRecordError(S_db_badField, (void *)prec,
                               "calc: Illegal CALC field");
@@ -150,6 +158,7 @@ static long special(DBADDR *paddr, int after)
                          prec->name, calcErrorStr(error_number), prec->calc);
             return S_db_badField;
         }
+        prec->rpcc = calcCompile(prec->rpcl);
         return 0;
     }
     recGblDbaddrError(S_db_badChoice, paddr, "calc::special - bad special value!");
@@ -195,6 +195,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->rpcc = calcCompile(prec->rpcl);
 
     prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
     if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
@@ -203,6 +205,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->ocal);
     }
+    if (!prec->oclv)
+        prec->orcc = calcCompile(prec->orpc);
 
     prpvt = prec->rpvt;
     callbackSetCallback(checkLinksCallback, &prpvt->checkLinkCb);
@@ -235,7 +239,9 @@ static long process(struct dbCommon *pcommon)
             checkLinks(prec);
         }
         if (fetch_values(prec) == 0) {
-            if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+            if (prec->rpcc ?
+                calcPerformCompiled(&prec->a, &prec->val, prec->rpcc) :
+                calcPerform(&prec->a, &prec->val, prec->rpcl)) {
                 recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "calcPerform");
             } else {
                 prec->udf = isnan(prec->val);
@@ -303,7 +309,9 @@ static long process(struct dbCommon *pcommon)
             writeValue(prec);
         }
     }
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     recGblFwdLink(prec);
     prec->pact = FALSE;
     return 0;
@@ -323,6 +331,8 @@ static long special(DBADDR *paddr, int after)
     if (!after) return 0;
     switch(fieldIndex) {
       case(calcoutRecordCALC):
+        calcCompiledFree(prec->rpcc);
+        prec->rpcc = NULL;
         prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
         if (prec->clcv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -330,10 +340,14 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->calc);
         }
+        else
+            prec->rpcc = calcCompile(prec->rpcl);
         db_post_events(prec, &prec->clcv, DBE_VALUE);
         return 0;
 
       case(calcoutRecordOCAL):
+        calcCompiledFree(prec->orcc);
+        prec->orcc = NULL;
         prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
         if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -341,6 +355,8 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->ocal);
         }
+        if (!prec->oclv)
+            prec->orcc = calcCompile(prec->orpc);
         db_post_events(prec, &prec->oclv, DBE_VALUE);
         return 0;
       case(calcoutRecordINPA):
@@ -609,7 +625,9 @@ static void execOutput(calcoutRecord *prec)
         prec->oval = prec->val;
         break;
     case calcoutDOPT_Use_OVAL:
-        if (calcPerform(&prec->a, &prec->oval, prec->orpc)) {
+        if (prec->orcc ?
+            calcPerformCompiled(&prec->a, &prec->oval, prec->orcc) :
+            calcPerform(&prec->a, &prec->oval, prec->orpc)) {
             recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "OCAL calcPerform");
         } else {
             prec->udf = isnan(prec->oval);
@@ -365,7 +365,9 @@ static long process(struct dbCommon *pcommon)
     if (status != 1) {
         prec->udf = FALSE;
         recGblGetTimeStamp(prec);
+        db_post_events_begin(prec);
         monitor(prec);
+        db_post_events_commit(prec);
         /* process the forward scan link record */
         recGblFwdLink(prec);
     }
@@ -125,7 +125,9 @@ static long process(struct dbCommon *pcommon)
     dbGetLink(&(prec->sell),DBR_USHORT,&(prec->seln),0,0);
     checkAlarms(prec);
     push_values(prec);
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     recGblFwdLink(prec);
     prec->pact=FALSE;
     return(status);
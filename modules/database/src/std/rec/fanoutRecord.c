@@ -145,11 +145,13 @@ static long process(struct dbCommon *pcommon)
     recGblGetTimeStamp(prec);
 
     /* post monitors */
+    db_post_events_begin(prec);
     events = recGblResetAlarms(prec);
     if (events)
         db_post_events(prec, &prec->val, events);
     if (prec->seln != oldn)
         db_post_events(prec, &prec->seln, events | DBE_VALUE | DBE_LOG);
+    db_post_events_commit(prec);
 
     /* finish off */
     recGblFwdLink(prec);
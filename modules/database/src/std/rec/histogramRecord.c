@@ -220,7 +220,9 @@ static long process(struct dbCommon *pcommon)
     else if (status == 2)
         status = 0;
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     recGblFwdLink(prec);
 
     prec->pact=FALSE;
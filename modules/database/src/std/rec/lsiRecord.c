@@ -111,7 +111,9 @@ static long process(struct dbCommon *pcommon)
     prec->pact = TRUE;
     recGblGetTimeStampSimm(prec, prec->simm, &prec->siol);
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
@@ -168,7 +168,9 @@ static long process(struct dbCommon *pcommon)
     if (prec->udf)
         recGblSetSevr(prec, UDF_ALARM, INVALID_ALARM);
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
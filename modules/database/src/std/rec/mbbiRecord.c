@@ -193,7 +193,9 @@ static long process(struct dbCommon *pcommon)
         status = 0;
 
     checkAlarms(prec, &timeLast);
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
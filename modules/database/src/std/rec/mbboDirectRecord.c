@@ -239,7 +239,9 @@ CONTINUE:
     /* update bits to reflect any change made by dset */
     bitsFromVAL(prec);
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
@@ -258,7 +258,9 @@ CONTINUE:
         recGblGetTimeStampSimm(prec, prec->simm, NULL);
     }
 
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
@@ -84,7 +84,9 @@ static long process(struct dbCommon *pcommon)
     prec->pact=TRUE;
     prec->udf=FALSE;
     recGblGetTimeStamp(prec);
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     recGblFwdLink(prec);
     prec->pact=FALSE;
     return(0);
@@ -395,9 +395,11 @@ static long process(struct dbCommon *pcommon)
     prec->pact = TRUE;
 
     /* Post monitor */
+    db_post_events_begin(prec);
     events = recGblResetAlarms(prec);
     db_post_events(prec, prec->val, events | DBE_VALUE | DBE_LOG);
     db_post_events(prec, &prec->len, events | DBE_VALUE | DBE_LOG);
+    db_post_events_commit(prec);
 
     /* Wrap up */
     recGblFwdLink(prec);
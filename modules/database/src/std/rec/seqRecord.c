@@ -224,6 +224,7 @@ static long asyncFinish(seqRecord *prec)
     recGblGetTimeStamp(prec);
 
     /* post monitors */
+    db_post_events_begin(prec);
     events = recGblResetAlarms(prec);
     if (events)
         db_post_events(prec, &prec->val, events);
@@ -231,6 +232,7 @@ static long asyncFinish(seqRecord *prec)
         db_post_events(prec, &prec->seln, events | DBE_VALUE | DBE_LOG);
         prec->oldn = prec->seln;
     }
+    db_post_events_commit(prec);
 
     /* process the forward scan link record */
     recGblFwdLink(prec);
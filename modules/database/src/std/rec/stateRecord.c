@@ -99,7 +99,9 @@ static long process(struct dbCommon *pcommon)
     prec->udf = FALSE;
     prec->pact=TRUE;
     recGblGetTimeStamp(prec);
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
     /* process the forward scan link record */
     recGblFwdLink(prec);
     prec->pact=FALSE;
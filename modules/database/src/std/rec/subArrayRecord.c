@@ -138,8 +138,13 @@ static long process(struct dbCommon *pcommon)
 
     if (pact && prec->busy) return 0;
 
+    /* NORD posted by device support goes out with the value */
+    db_post_events_begin(prec);
     status=readValue(prec); /* read the new value */
-    if (!pact && prec->pact) return 0;
+    if (!pact && prec->pact) {
+        db_post_events_commit(prec);
+        return 0;
+    }
     prec->pact = TRUE;
 
     recGblGetTimeStamp(prec);
@@ -149,6 +154,7 @@ static long process(struct dbCommon *pcommon)
         recGblSetSevr(prec, UDF_ALARM, prec->udfs);
 
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* process the forward scan link record */
     recGblFwdLink(prec);
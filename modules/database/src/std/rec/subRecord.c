@@ -157,7 +157,9 @@ static long process(struct dbCommon *pcommon)
     checkAlarms(prec);
 
     /* publish changes */
+    db_post_events_begin(prec);
     monitor(prec);
+    db_post_events_commit(prec);
 
     recGblFwdLink(prec);
     prec->pact = FALSE;
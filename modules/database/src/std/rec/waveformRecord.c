@@ -136,9 +136,13 @@ static long process(struct dbCommon *pcommon)
     if (pact && prec->busy)
         return 0;
 
+    /* NORD posted by device support goes out with the value */
+    db_post_events_begin(prec);
     status = readValue(prec); /* read the new value */
-    if (!pact && prec->pact)
+    if (!pact && prec->pact) {
+        db_post_events_commit(prec);
         return 0;
+    }
 
     prec->pact = TRUE;
     prec->udf = FALSE;
@@ -147,6 +151,7 @@ static long process(struct dbCommon *pcommon)
     if (nord != prec->nord)
         db_post_events(prec, &prec->nord, DBE_VALUE | DBE_LOG);
     monitor(prec);
+    db_post_events_commit(prec);
 
     /* process the forward scan link record */
     recGblFwdLink(prec);
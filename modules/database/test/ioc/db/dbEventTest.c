@@ -0,0 +1,459 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Event queue sizing and replacement
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define EPICS_PRIVATE_API
+
+#include "epicsThread.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "db_field_log.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+#include "arrRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NSUBS 100
+#define NFIRST 10
+
+typedef struct {
+    dbEventSubscription sub;
+    int count;
+    int last;
+    int outOfOrder;
+    int values[4];
+} subscriber;
+
+static subscriber subs[NFIRST + NSUBS];
+
+static void monitor(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    subscriber *psub = user_arg;
+    int val = pfl->u.v.field.dbf_long;
+
+    if (val <= psub->last)
+        psub->outOfOrder++;
+    if (psub->count < 4)
+        psub->values[psub->count] = val;
+    psub->last = val;
+    psub->count++;
+}
+
+static void addSubs(dbEventCtx ctx, dbChannel *chan, int first, int n)
+{
+    int i;
+
+    for (i = first; i < first + n; i++) {
+        memset(&subs[i], 0, sizeof(subs[i]));
+        subs[i].sub = db_add_event(ctx, chan, monitor, &subs[i], DBE_VALUE);
+        if (!subs[i].sub)
+            testAbort("db_add_event() fails");
+        db_event_enable(subs[i].sub);
+    }
+}
+
+static void cancelSubs(int first, int n)
+{
+    int i;
+
+    for (i = first; i < first + n; i++)
+        db_cancel_event(subs[i].sub);
+}
+
+static void postValue(xRecord *prec, int val)
+{
+    dbScanLock((dbCommon*)prec);
+    prec->val = val;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon*)prec);
+}
+
+static int waitForLast(int first, int n, int val)
+{
+    int tries, i;
+
+    for (tries = 0; tries < 1000; tries++) {
+        for (i = first; i < first + n; i++) {
+            if (subs[i].last != val)
+                break;
+        }
+        if (i == first + n)
+            return 1;
+        epicsThreadSleep(0.01);
+    }
+    return 0;
+}
+
+static void testDepth(xRecord *prec, dbChannel *chan)
+{
+    dbEventCtx ctx = db_init_events();
+    int i, val, tooFew = 0, outOfOrder = 0;
+
+    testDiag("%d subscriptions with 8 entries each", NSUBS);
+
+    dbEventEntriesPerSubscription = 8;
+    addSubs(ctx, chan, 0, NSUBS);
+
+    /* queue up events before the event task runs */
+    for (val = 1; val <= 20; val++)
+        postValue(prec, val);
+
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+    testOk(waitForLast(0, NSUBS, 20), "Last update delivered to all");
+    dbEventQueueShow(0);
+
+    for (i = 0; i < NSUBS; i++) {
+        if (subs[i].count < 7)
+            tooFew++;
+        outOfOrder += subs[i].outOfOrder;
+    }
+    testOk(tooFew == 0, "%d subscriptions got less than 7 updates", tooFew);
+    testOk(outOfOrder == 0, "%d updates out of order", outOfOrder);
+
+    cancelSubs(0, NSUBS);
+    db_close_events(ctx);
+    dbEventEntriesPerSubscription = 4;
+}
+
+static void testGrowth(xRecord *prec, dbChannel *chan)
+{
+    dbEventCtx ctx = db_init_events();
+    int i, bad = 0;
+
+    testDiag("Grow the queue while events are pending");
+
+    addSubs(ctx, chan, 0, NFIRST);
+    postValue(prec, 1);
+    postValue(prec, 2);
+
+    /* moves pending entries into a larger ring */
+    addSubs(ctx, chan, NFIRST, NSUBS);
+
+    /* replaces the last pending entry of the first subscriptions */
+    db_event_flow_ctrl_mode_on(ctx);
+    postValue(prec, 3);
+    db_event_flow_ctrl_mode_off(ctx);
+
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+    testOk(waitForLast(0, NFIRST + NSUBS, 3), "Last update delivered to all");
+
+    for (i = 0; i < NFIRST; i++) {
+        if (subs[i].count != 2 || subs[i].values[0] != 1 ||
+            subs[i].values[1] != 3)
+            bad++;
+    }
+    testOk(bad == 0, "%d early subscriptions did not see 1, 3", bad);
+
+    for (i = NFIRST, bad = 0; i < NFIRST + NSUBS; i++) {
+        if (subs[i].count != 1)
+            bad++;
+    }
+    testOk(bad == 0, "%d late subscriptions did not see 3 only", bad);
+
+    cancelSubs(0, NFIRST + NSUBS);
+    db_close_events(ctx);
+}
+
+static void testBatch(xRecord *prec, dbChannel *chan)
+{
+    dbEventCtx ctx = db_init_events();
+    int i, bad = 0;
+
+    testDiag("Batched posting");
+
+    addSubs(ctx, chan, 0, NFIRST);
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+
+    dbScanLock((dbCommon*)prec);
+    db_post_events_begin(prec);
+    for (i = 1; i <= 3; i++) {
+        prec->val = i;
+        db_post_events(prec, &prec->val, DBE_VALUE);
+    }
+    /* nested begin/commit must not flush */
+    db_post_events_begin(prec);
+    db_post_events_commit(prec);
+    epicsThreadSleep(0.1);
+    for (i = 0; i < NFIRST; i++) {
+        if (subs[i].count)
+            bad++;
+    }
+    testOk(bad == 0, "%d subscriptions updated before commit", bad);
+    db_post_events_commit(prec);
+    dbScanUnlock((dbCommon*)prec);
+
+    testOk(waitForLast(0, NFIRST, 3), "Last update delivered to all");
+    for (i = 0, bad = 0; i < NFIRST; i++) {
+        if (subs[i].count != 3 || subs[i].values[0] != 1 ||
+            subs[i].values[1] != 2)
+            bad++;
+    }
+    testOk(bad == 0, "%d subscriptions did not see 1, 2, 3", bad);
+
+    cancelSubs(0, NFIRST);
+    db_close_events(ctx);
+}
+
+typedef struct {
+    dbEventSubscription sub;
+    int count;
+    int hasCopy;
+    long nelem;
+    const void *field;
+    const void *encoded;
+    epicsInt32 values[4];
+} arraySubscriber;
+
+static arraySubscriber arraySubs[2];
+
+static void arrayMonitor(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    arraySubscriber *psub = user_arg;
+    void *psa = db_shared_array_ref(pfl);
+
+    if (psa) {
+        /* the first subscriber's copy is kept, the second one's freed */
+        psub->encoded = db_shared_array_set_encoded(psa, 1, malloc(16));
+        db_shared_array_unref(psa);
+    }
+    psub->hasCopy = dbfl_has_copy(pfl);
+    psub->nelem = pfl->no_elements;
+    psub->field = pfl->u.r.field;
+    if (psub->hasCopy && pfl->no_elements == 4)
+        memcpy(psub->values, pfl->u.r.field, sizeof(psub->values));
+    psub->count++;
+}
+
+static void addArraySubs(dbEventCtx ctx, dbChannel *chan, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        memset(&arraySubs[i], 0, sizeof(arraySubs[i]));
+        arraySubs[i].sub = db_add_event(ctx, chan, arrayMonitor,
+            &arraySubs[i], DBE_VALUE);
+        if (!arraySubs[i].sub)
+            testAbort("db_add_event() fails");
+        db_event_enable(arraySubs[i].sub);
+    }
+}
+
+static int waitForArraySubs(int n)
+{
+    int tries, i;
+
+    for (tries = 0; tries < 1000; tries++) {
+        for (i = 0; i < n; i++) {
+            if (!arraySubs[i].count)
+                break;
+        }
+        if (i == n)
+            return 1;
+        epicsThreadSleep(0.01);
+    }
+    return 0;
+}
+
+static void postArray(arrRecord *prec, epicsInt32 first)
+{
+    epicsInt32 *data = prec->bptr;
+    int i;
+
+    dbScanLock((dbCommon*)prec);
+    for (i = 0; i < 4; i++)
+        data[i] = first + i;
+    prec->nord = 4;
+    prec->off = 0;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon*)prec);
+}
+
+static void testArraySnapshot(void)
+{
+    arrRecord *prec = (arrRecord*)testdbRecordPtr("arr");
+    dbChannel *chan = dbChannelCreate("arr.VAL");
+    dbEventCtx ctx = db_init_events();
+    epicsInt32 *data;
+    int i;
+
+    testDiag("Shared array snapshots");
+
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel arr.VAL");
+
+    dbEventArraySnapshot = 1;
+    addArraySubs(ctx, chan, 2);
+
+    dbScanLock((dbCommon*)prec);
+    data = prec->bptr;
+    for (i = 0; i < 4; i++)
+        data[i] = i + 1;
+    prec->nord = 4;
+    prec->off = 1;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    /* must not be seen by the subscribers */
+    for (i = 0; i < 4; i++)
+        data[i] = 9;
+    prec->off = 0;
+    dbScanUnlock((dbCommon*)prec);
+
+    db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium);
+    waitForArraySubs(2);
+
+    testOk(arraySubs[0].hasCopy && arraySubs[1].hasCopy &&
+        arraySubs[0].nelem == 4 && arraySubs[1].nelem == 4,
+        "Subscriptions got a copy of 4 elements");
+    testOk(arraySubs[0].field == arraySubs[1].field &&
+        arraySubs[0].field != prec->bptr,
+        "Subscriptions share one snapshot");
+    for (i = 0; i < 2; i++) {
+        epicsInt32 *v = arraySubs[i].values;
+        testOk(v[0] == 2 && v[1] == 3 && v[2] == 4 && v[3] == 1,
+            "Subscription %d got {%d, %d, %d, %d}", i, v[0], v[1], v[2], v[3]);
+    }
+    testOk(arraySubs[0].encoded &&
+        arraySubs[0].encoded == arraySubs[1].encoded,
+        "Subscriptions share one encoded copy");
+
+    for (i = 0; i < 2; i++)
+        db_cancel_event(arraySubs[i].sub);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    dbEventArraySnapshot = 0;
+}
+
+static void testArraySingle(void)
+{
+    arrRecord *prec = (arrRecord*)testdbRecordPtr("arr");
+    dbChannel *chan = dbChannelCreate("arr.VAL");
+    dbEventCtx ctx = db_init_events();
+
+    testDiag("No snapshot for a single subscription");
+
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel arr.VAL");
+
+    dbEventArraySnapshot = 1;
+    addArraySubs(ctx, chan, 1);
+    postArray(prec, 1);
+    db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium);
+    waitForArraySubs(1);
+
+    testOk(arraySubs[0].count == 1 && !arraySubs[0].hasCopy,
+        "Subscription references the record");
+
+    db_cancel_event(arraySubs[0].sub);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    dbEventArraySnapshot = 0;
+}
+
+static void testArrayDiscard(int snapshot)
+{
+    arrRecord *prec = (arrRecord*)testdbRecordPtr("arr");
+    dbChannel *chan = dbChannelCreate("arr.VAL");
+    dbEventCtx ctx = db_init_events();
+    epicsInt32 val;
+    int i;
+
+    testDiag("Array updates for a slow consumer, %s",
+        snapshot ? "snapshots" : "record references");
+
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel arr.VAL");
+
+    dbEventArraySnapshot = snapshot;
+    addArraySubs(ctx, chan, 2);
+
+    /* the event task isn't running yet */
+    for (val = 10; val <= 100; val += 10)
+        postArray(prec, val);
+
+    db_start_events(ctx, "dbEventTest", NULL, NULL,
+        epicsThreadPriorityMedium);
+    waitForArraySubs(2);
+    epicsThreadSleep(0.1);
+
+    testOk(arraySubs[0].count == 1 && arraySubs[1].count == 1,
+        "Older updates discarded, subscriptions got %d and %d",
+        arraySubs[0].count, arraySubs[1].count);
+    if (snapshot) {
+        int ok = 1;
+
+        for (i = 0; i < 2; i++) {
+            epicsInt32 *v = arraySubs[i].values;
+            ok &= arraySubs[i].hasCopy && v[0] == 100 && v[3] == 103;
+        }
+        testOk(ok, "Subscriptions got the last snapshot");
+    }
+    else {
+        testOk(!arraySubs[0].hasCopy && !arraySubs[1].hasCopy,
+            "Subscriptions reference the record");
+    }
+
+    for (i = 0; i < 2; i++)
+        db_cancel_event(arraySubs[i].sub);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    dbEventArraySnapshot = 0;
+}
+
+MAIN(dbEventTest)
+{
+    xRecord *prec;
+    dbChannel *chan;
+
+    testPlan(22);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testdbReadDatabase("dbEventTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec = (xRecord*)testdbRecordPtr("x");
+    chan = dbChannelCreate("x.VAL");
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel x.VAL");
+
+    testDepth(prec, chan);
+    testGrowth(prec, chan);
+    testBatch(prec, chan);
+
+    dbChannelDelete(chan);
+
+    testArraySnapshot();
+    testArraySingle();
+    testArrayDiscard(0);
+    testArrayDiscard(1);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
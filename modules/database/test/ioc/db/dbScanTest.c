@@ -13,13 +13,16 @@
 #include <string.h>
 
 #include "dbScan.h"
+#include "dbLock.h"
 #include "epicsEvent.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
 #include "errlog.h"
+#include "xRecord.h"
 
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
@@ -66,9 +69,79 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+#define NPAR 6
+static int wrongThread;
+static int outOfOrder;
+
+static void parProcess(xRecord *prec)
+{
+    const char *name = epicsThreadGetNameSelf();
+
+    if (strncmp(name, "scan-0.1-", 9) != 0)
+        wrongThread = 1;
+    /* par1 must always be processed after par0 in the same period */
+    if (strcmp(prec->name, "par1") == 0 &&
+        prec->val + 1 != ((xRecord *)testdbRecordPtr("par0"))->val)
+        outOfOrder = 1;
+    prec->val++;
+}
+
+static void testParallel(void)
+{
+    xRecord *precs[NPAR];
+    double timeout;
+    int i, done = 0;
+
+    testDiag("check scanPeriodicParallelThreads()");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    testOk1(scanPeriodicParallelThreads(3, ".1 second")==0);
+    testOk1(scanPeriodicParallelThreads(3, "no such rate")==-1);
+
+    for (i = 0; i < NPAR; i++) {
+        char name[8];
+
+        sprintf(name, "par%d", i);
+        precs[i] = (xRecord *)testdbRecordPtr(name);
+        precs[i]->clbk = parProcess;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk1(scanPeriodicParallelThreads(3, NULL)==-1);
+    testOk1(dbLockGetLockId((dbCommon *)precs[0]) ==
+            dbLockGetLockId((dbCommon *)precs[1]));
+
+    for (timeout = 0.0; !done && timeout < 10.0; timeout += 0.1) {
+        epicsThreadSleep(0.1);
+        done = 1;
+        for (i = 0; i < NPAR; i++) {
+            dbScanLock((dbCommon *)precs[i]);
+            if (precs[i]->val < 3)
+                done = 0;
+            dbScanUnlock((dbCommon *)precs[i]);
+        }
+    }
+    testOk(done, "All records processed repeatedly");
+    testOk(!wrongThread, "Processed by periodic worker threads");
+    testOk(!outOfOrder, "PHAS order kept within lock set");
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(10);
     testOnce();
+    testParallel();
     return testDone();
 }
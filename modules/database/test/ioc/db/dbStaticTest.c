@@ -4,9 +4,12 @@
 * in file LICENSE that is included with this distribution.
  \*************************************************************************/
 
+#include <stdio.h>
 #include <string.h>
 
 #include <errlog.h>
+#include <epicsEvent.h>
+#include <epicsThread.h>
 #include <osiFileName.h>
 #include <dbAccess.h>
 #include <dbStaticLib.h>
@@ -303,6 +306,87 @@ static void testWrongAliasRecord(const char *filename)
            "Wrong alias record in %s is expected to fail", filename);
 }
 
+#define NPVD 3000
+
+static volatile int pvdReaderStop;
+static int pvdReaderMisses, pvdReaderLookups;
+
+/* Looks up an existing record while the directory grows */
+static void pvdReader(void *arg)
+{
+    epicsEventId done = arg;
+    DBENTRY entry;
+
+    dbInitEntry(pdbbase, &entry);
+    while (!pvdReaderStop) {
+        if (dbFindRecord(&entry, "testrec"))
+            pvdReaderMisses++;
+        if (!(++pvdReaderLookups % 100))
+            epicsThreadSleep(0.0);
+    }
+    dbFinishEntry(&entry);
+    epicsEventMustTrigger(done);
+}
+
+static void testPvdGrow(void)
+{
+    epicsEventId done = epicsEventMustCreate(epicsEventEmpty);
+    DBENTRY entry;
+    char name[20];
+    int i, created = 0, found = 0, wrong = 0, gone = 0;
+
+    testDiag("Grow the process variable directory");
+
+    epicsThreadMustCreate("pvdReader", epicsThreadPriorityMedium,
+        epicsThreadGetStackSize(epicsThreadStackSmall), pvdReader, done);
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("Record type x not found");
+
+    for (i = 0; i < NPVD; i++) {
+        sprintf(name, "pvd%d", i);
+        if (!dbCreateRecord(&entry, name))
+            created++;
+    }
+    testOk(created == NPVD, "Created %d of %d records", created, NPVD);
+
+    pvdReaderStop = 1;
+    epicsEventMustWait(done);
+    epicsEventDestroy(done);
+    testOk(pvdReaderMisses == 0, "Reader missed %d of %d lookups",
+        pvdReaderMisses, pvdReaderLookups);
+
+    for (i = 0; i < NPVD; i++) {
+        sprintf(name, "pvd%d", i);
+        if (dbFindRecord(&entry, name))
+            continue;
+        found++;
+        if (strcmp(dbGetRecordName(&entry), name) != 0)
+            wrong++;
+    }
+    testOk(found == NPVD && wrong == 0, "Found %d records, %d wrong",
+        found, wrong);
+
+    /* a prefix of an existing name must not match */
+    testOk1(dbFindRecord(&entry, "pvd1000x") != 0);
+
+    for (i = 0; i < NPVD; i++) {
+        sprintf(name, "pvd%d", i);
+        if (!dbFindRecord(&entry, name))
+            dbDeleteRecord(&entry);
+    }
+    for (i = 0; i < NPVD; i++) {
+        sprintf(name, "pvd%d", i);
+        if (dbFindRecord(&entry, name))
+            gone++;
+    }
+    testOk(gone == NPVD, "Deleted %d of %d records", gone, NPVD);
+    dbFinishEntry(&entry);
+
+    dbPvdStats(pdbbase, 0);
+}
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 MAIN(dbStaticTest)
@@ -310,7 +394,7 @@ MAIN(dbStaticTest)
     const char *ldir;
     FILE *fp = NULL;
 
-    testPlan(312);
+    testPlan(317);
     testdbPrepare();
 
     testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
@@ -341,6 +425,8 @@ MAIN(dbStaticTest)
     testRec2Entry("testalias2");
     testRec2Entry("testalias3");
 
+    testPvdGrow();
+
     eltc(0);
     testIocInitOk();
     eltc(1);
@@ -0,0 +1,183 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsTime.h"
+#include "caProto.h"
+#include "caeventmask.h"
+#include "epicsUnitTest.h"
+
+#include "caTestClient.h"
+
+#define MINOR_VERSION 13u
+
+static void sendMsg(SOCKET sock, unsigned cmd, unsigned dataType,
+    unsigned count, unsigned cid, unsigned avail,
+    const void *payload, unsigned size)
+{
+    char buf[sizeof(caHdr) + 64];
+    unsigned postsize = CA_MESSAGE_ALIGN(size);
+    caHdr hdr;
+
+    if (postsize > sizeof(buf) - sizeof(caHdr))
+        testAbort("caTestClient: message too large");
+    hdr.m_cmmd = htons(cmd);
+    hdr.m_postsize = htons(postsize);
+    hdr.m_dataType = htons(dataType);
+    hdr.m_count = htons(count);
+    hdr.m_cid = htonl(cid);
+    hdr.m_available = htonl(avail);
+    memset(buf, 0, sizeof(buf));
+    memcpy(buf, &hdr, sizeof(hdr));
+    if (size)
+        memcpy(buf + sizeof(hdr), payload, size);
+    if (send(sock, buf, sizeof(hdr) + postsize, 0) !=
+            (int) (sizeof(hdr) + postsize))
+        testAbort("caTestClient: send() fails");
+}
+
+SOCKET caTestConnect(unsigned short port, int rcvBuf)
+{
+    SOCKET sock = epicsSocketCreate(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    osiSockAddr addr;
+    int flag = 1;
+
+    if (sock == INVALID_SOCKET)
+        testAbort("caTestClient: can't create TCP socket");
+    if (rcvBuf > 0)
+        setsockopt(sock, SOL_SOCKET, SO_RCVBUF, (char *) &rcvBuf,
+            sizeof(rcvBuf));
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (char *) &flag, sizeof(flag));
+    if (aToIPAddr("127.0.0.1", port, &addr.ia) ||
+            connect(sock, &addr.sa, sizeof(addr.ia)))
+        testAbort("caTestClient: can't connect to the CA server");
+    sendMsg(sock, CA_PROTO_VERSION, 0u, MINOR_VERSION, 0u, 0u, NULL, 0u);
+    return sock;
+}
+
+long caTestCreateChannel(SOCKET sock, const char *name, unsigned cid,
+    unsigned *pType, unsigned *pCount)
+{
+    caTestMsg msg;
+    long sid = -1;
+
+    sendMsg(sock, CA_PROTO_CREATE_CHAN, 0u, 0u, cid, MINOR_VERSION,
+        name, (unsigned) strlen(name) + 1u);
+    memset(&msg, 0, sizeof(msg));
+    while (!caTestRead(sock, &msg, 5.0)) {
+        if (msg.cmd == CA_PROTO_CREATE_CHAN && msg.cid == cid) {
+            *pType = msg.type;
+            *pCount = msg.count;
+            sid = (long) msg.avail;
+            break;
+        }
+        if (msg.cmd == CA_PROTO_CREATE_CH_FAIL && msg.cid == cid)
+            break;
+    }
+    caTestMsgFree(&msg);
+    return sid;
+}
+
+void caTestSubscribe(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned subid)
+{
+    struct mon_info info;
+
+    memset(&info, 0, sizeof(info));
+    info.m_mask = htons(DBE_VALUE);
+    sendMsg(sock, CA_PROTO_EVENT_ADD, type, count, sid, subid,
+        &info, sizeof(info));
+}
+
+void caTestReadNotify(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned ioid)
+{
+    sendMsg(sock, CA_PROTO_READ_NOTIFY, type, count, sid, ioid, NULL, 0u);
+}
+
+void caTestWriteNotify(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned ioid, const void *pValue, unsigned size)
+{
+    sendMsg(sock, CA_PROTO_WRITE_NOTIFY, type, count, sid, ioid,
+        pValue, size);
+}
+
+/* Receive exactly size bytes before the deadline */
+static int readExact(SOCKET sock, void *pBuf, size_t size,
+    const epicsTimeStamp *deadline)
+{
+    char *p = pBuf;
+
+    while (size > 0) {
+        struct timeval timeout;
+        epicsTimeStamp now;
+        fd_set fds;
+        double left;
+        int status;
+
+        epicsTimeGetCurrent(&now);
+        left = epicsTimeDiffInSeconds(deadline, &now);
+        if (left <= 0.0)
+            return -1;
+        timeout.tv_sec = (long) left;
+        timeout.tv_usec = (long) ((left - timeout.tv_sec) * 1e6);
+        FD_ZERO(&fds);
+        FD_SET(sock, &fds);
+        status = select(sock + 1, &fds, NULL, NULL, &timeout);
+        if (status <= 0)
+            continue;
+        status = recv(sock, p, (int) size, 0);
+        if (status <= 0)
+            return -1;
+        p += status;
+        size -= (size_t) status;
+    }
+    return 0;
+}
+
+int caTestRead(SOCKET sock, caTestMsg *pMsg, double timeout)
+{
+    epicsTimeStamp deadline;
+    caHdr hdr;
+
+    epicsTimeGetCurrent(&deadline);
+    epicsTimeAddSeconds(&deadline, timeout);
+    if (readExact(sock, &hdr, sizeof(hdr), &deadline))
+        return -1;
+    pMsg->cmd = ntohs(hdr.m_cmmd);
+    pMsg->size = ntohs(hdr.m_postsize);
+    pMsg->type = ntohs(hdr.m_dataType);
+    pMsg->count = ntohs(hdr.m_count);
+    pMsg->cid = ntohl(hdr.m_cid);
+    pMsg->avail = ntohl(hdr.m_available);
+    if (pMsg->size == 0xffff && pMsg->count == 0) {
+        ca_uint32_t ext[2];
+
+        if (readExact(sock, ext, sizeof(ext), &deadline))
+            return -1;
+        pMsg->size = ntohl(ext[0]);
+        pMsg->count = ntohl(ext[1]);
+    }
+    if (pMsg->size > pMsg->capacity) {
+        char *p = realloc(pMsg->payload, pMsg->size);
+
+        if (!p)
+            testAbort("caTestClient: no memory");
+        pMsg->payload = p;
+        pMsg->capacity = pMsg->size;
+    }
+    if (pMsg->size && readExact(sock, pMsg->payload, pMsg->size, &deadline))
+        return -1;
+    return 0;
+}
+
+void caTestMsgFree(caTestMsg *pMsg)
+{
+    free(pMsg->payload);
+    memset(pMsg, 0, sizeof(*pMsg));
+}
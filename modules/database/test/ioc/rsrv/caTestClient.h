@@ -0,0 +1,57 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Minimal CA protocol client for testing the CA server, which reads
+ * (or doesn't read) the server's messages exactly as they arrive
+ */
+
+#ifndef INC_caTestClient_H
+#define INC_caTestClient_H
+
+#include <stddef.h>
+
+#include "osiSock.h"
+
+typedef struct caTestMsg {
+    unsigned cmd;
+    unsigned type;
+    unsigned count;
+    unsigned cid;
+    unsigned avail;
+    size_t size;        /* of the payload */
+    char *payload;      /* in network byte order */
+    size_t capacity;
+} caTestMsg;
+
+/* Connect to the CA server on the loopback interface.  A non-zero rcvBuf
+ * sets the socket receive buffer size, so that a client which stops
+ * reading holds up the server sooner. */
+SOCKET caTestConnect(unsigned short port, int rcvBuf);
+
+/* Create a channel, returns the server's id for it or -1 */
+long caTestCreateChannel(SOCKET sock, const char *name, unsigned cid,
+    unsigned *pType, unsigned *pCount);
+
+/* Subscribe to value changes, updates arrive with avail == subid */
+void caTestSubscribe(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned subid);
+
+/* Request a value, the reply arrives with avail == ioid */
+void caTestReadNotify(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned ioid);
+
+/* Write a value of at most 64 bytes and ask for a completion reply,
+ * which arrives with avail == ioid */
+void caTestWriteNotify(SOCKET sock, unsigned sid, unsigned type,
+    unsigned count, unsigned ioid, const void *pValue, unsigned size);
+
+/* Read the next message, returns 0 or -1 after timeout seconds */
+int caTestRead(SOCKET sock, caTestMsg *pMsg, double timeout);
+
+void caTestMsgFree(caTestMsg *pMsg);
+
+#endif /* INC_caTestClient_H */
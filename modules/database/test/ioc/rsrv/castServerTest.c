@@ -0,0 +1,210 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Search requests sent to the CA server's UDP port, several per
+ * datagram and several datagrams at a time
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "osiSock.h"
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "caProto.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "testMain.h"
+
+void rsrvTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define TEST_PORT 55164
+#define MINOR_VERSION 13u
+#define PV_NAME "rsrvTest:ai"
+#define PV_NAME_SIZE 16u    /* padded to a multiple of 8 */
+#define MAX_CID 1000u
+
+static SOCKET sock;
+static osiSockAddr server;
+static char seen[MAX_CID];
+
+static char * putHeader(char *p, unsigned cmd, unsigned postsize,
+    unsigned dataType, unsigned count, unsigned cid, unsigned avail)
+{
+    caHdr hdr;
+
+    hdr.m_cmmd = htons(cmd);
+    hdr.m_postsize = htons(postsize);
+    hdr.m_dataType = htons(dataType);
+    hdr.m_count = htons(count);
+    hdr.m_cid = htonl(cid);
+    hdr.m_available = htonl(avail);
+    memcpy(p, &hdr, sizeof(hdr));
+    return p + sizeof(hdr);
+}
+
+/* One datagram with searches for cids first .. first+n-1, returns its size */
+static size_t sendSearches(unsigned first, unsigned n)
+{
+    size_t size = sizeof(caHdr) + n * (sizeof(caHdr) + PV_NAME_SIZE);
+    char *buf = calloc(1, size);
+    char *p = buf;
+    unsigned i;
+    int status;
+
+    if (!buf)
+        testAbort("No memory");
+    p = putHeader(p, CA_PROTO_VERSION, 0u, 0u, MINOR_VERSION, 0u, 0u);
+    for (i = first; i < first + n; i++) {
+        p = putHeader(p, CA_PROTO_SEARCH, PV_NAME_SIZE, DONTREPLY,
+            MINOR_VERSION, i, i);
+        strcpy(p, PV_NAME);
+        p += PV_NAME_SIZE;
+    }
+    status = sendto(sock, buf, size, 0, &server.sa, sizeof(server.ia));
+    if (status != (int) size)
+        testDiag("sendto() returns %d", status);
+    free(buf);
+    return size;
+}
+
+/* Wait for replies to cids first .. first+n-1, returns how many came */
+static unsigned collectReplies(unsigned first, unsigned n)
+{
+    char buf[MAX_UDP_RECV];
+    unsigned nseen = 0u;
+    epicsTimeStamp start, now;
+
+    memset(seen, 0, sizeof(seen));
+    epicsTimeGetCurrent(&start);
+    do {
+        struct timeval timeout;
+        fd_set fds;
+        int status;
+        char *p;
+
+        FD_ZERO(&fds);
+        FD_SET(sock, &fds);
+        timeout.tv_sec = 0;
+        timeout.tv_usec = 100000;
+        status = select(sock + 1, &fds, NULL, NULL, &timeout);
+        if (status > 0) {
+            status = recv(sock, buf, sizeof(buf), 0);
+            for (p = buf; status > 0 && p + sizeof(caHdr) <= buf + status; ) {
+                caHdr hdr;
+                unsigned cid;
+
+                memcpy(&hdr, p, sizeof(hdr));
+                cid = ntohl(hdr.m_available);
+                if (ntohs(hdr.m_cmmd) == CA_PROTO_SEARCH &&
+                        cid >= first && cid < first + n && !seen[cid]) {
+                    seen[cid] = 1;
+                    nseen++;
+                }
+                p += sizeof(caHdr) + ntohs(hdr.m_postsize);
+            }
+        }
+        epicsTimeGetCurrent(&now);
+    } while (nseen < n && epicsTimeDiffInSeconds(&now, &start) < 5.0);
+    return nseen;
+}
+
+static void testSingle(void)
+{
+    testDiag("One search");
+    sendSearches(1u, 1u);
+    testOk(collectReplies(1u, 1u) == 1u, "Got a reply");
+}
+
+static void testOversized(void)
+{
+    unsigned n;
+    size_t size;
+
+    testDiag("Many searches in one datagram");
+    size = sendSearches(100u, 200u);
+    testOk(size > ETHERNET_MAX_UDP, "Sent %u bytes", (unsigned) size);
+    n = collectReplies(100u, 200u);
+    testOk(n == 200u, "Got %u of 200 replies", n);
+
+    size = sendSearches(300u, 600u);
+    n = collectReplies(300u, 600u);
+    testOk(n == 600u, "Got %u of 600 replies to %u bytes", n, (unsigned) size);
+}
+
+static void testBatch(void)
+{
+    unsigned i, n;
+
+    testDiag("Many datagrams at once");
+    for (i = 0u; i < 40u; i++)
+        sendSearches(100u + 5u * i, 5u);
+    n = collectReplies(100u, 200u);
+    testOk(n == 200u, "Got %u of 200 replies to 40 datagrams", n);
+
+    /* mixed sizes */
+    for (i = 0u; i < 10u; i++) {
+        sendSearches(100u + 20u * i, 1u);
+        sendSearches(101u + 20u * i, 19u);
+    }
+    n = collectReplies(100u, 200u);
+    testOk(n == 200u, "Got %u of 200 replies to 20 datagrams", n);
+
+    /* the server adds receive slots as it needs them */
+    for (i = 0u; i < 8u; i++)
+        sendSearches(100u + 100u * i, 100u);
+    n = collectReplies(100u, 800u);
+    testOk(n == 800u, "Got %u of 800 replies to 8 large datagrams", n);
+}
+
+MAIN(castServerTest)
+{
+    char port[16];
+
+    testPlan(7);
+
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT);
+    epicsEnvSet("EPICS_CA_SERVER_PORT", port);
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT + 1u);
+    epicsEnvSet("EPICS_CAS_BEACON_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+
+    testdbPrepare();
+    testdbReadDatabase("rsrvTestIoc.dbd", NULL, NULL);
+    rsrvTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvTest.db", NULL, NULL);
+
+    eltc(0);
+    if (iocInit())
+        testAbort("iocInit() fails");
+    eltc(1);
+
+    if (!osiSockAttach())
+        testAbort("osiSockAttach() fails");
+    sock = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    if (sock == INVALID_SOCKET)
+        testAbort("Can't create UDP socket");
+    if (aToIPAddr("127.0.0.1", TEST_PORT, &server.ia))
+        testAbort("aToIPAddr() fails");
+
+    testSingle();
+    testOversized();
+    testBatch();
+
+    epicsSocketDestroy(sock);
+    osiSockRelease();
+
+    /* the CA server can't be stopped */
+    return testDone();
+}
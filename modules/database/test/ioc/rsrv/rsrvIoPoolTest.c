@@ -0,0 +1,356 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * The CA server with rsrvIoThreads set, where a few I/O threads serve
+ * all clients.  Clients which stop reading must not hold up the others.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "osiSock.h"
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsTypes.h"
+#include "iocsh.h"
+#include "iocInit.h"
+#include "caProto.h"
+#include "caerr.h"
+#include "db_access.h"
+#include "db_access_routines.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "testMain.h"
+
+#include "caTestClient.h"
+
+void rsrvTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define TEST_PORT 55168
+#define AI_NAME "rsrvTest:ai"
+#define WF_NAME "rsrvTest:wf"
+#define SLOW_NAME "rsrvTest:slow%u.A"   /* put notify takes 2 seconds */
+#define NELM 20000
+#define NSTALLED 3      /* more than I/O threads */
+#define NREADS 100
+
+static epicsInt32 values[NELM];
+
+static void putWaveform(epicsInt32 k)
+{
+    int i;
+
+    for (i = 0; i < NELM; i++)
+        values[i] = k * 100000 + i;
+    testdbPutArrFieldOk(WF_NAME, DBF_LONG, NELM, values);
+}
+
+static epicsUInt32 getUInt32(const char *p)
+{
+    const unsigned char *u = (const unsigned char *) p;
+
+    return ((epicsUInt32) u[0] << 24) | ((epicsUInt32) u[1] << 16) |
+        ((epicsUInt32) u[2] << 8) | u[3];
+}
+
+static double getDouble(const char *p)
+{
+    epicsUInt64 bits = ((epicsUInt64) getUInt32(p) << 32) | getUInt32(p + 4);
+    double d;
+
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static void putDouble(char *p, double d)
+{
+    epicsUInt64 bits;
+    int i;
+
+    memcpy(&bits, &d, sizeof(bits));
+    for (i = 7; i >= 0; i--, bits >>= 8)
+        p[i] = (char) (bits & 0xff);
+}
+
+/* The k of a DBR_LONG waveform if all of its values match, else -1 */
+static epicsInt32 waveformValue(const caTestMsg *pMsg)
+{
+    const char *p = pMsg->payload;
+    epicsInt32 k;
+    unsigned i;
+
+    if (pMsg->type != DBR_LONG || pMsg->count != NELM ||
+            pMsg->size < NELM * sizeof(epicsInt32))
+        return -1;
+    k = (epicsInt32) getUInt32(p) / 100000;
+    for (i = 0; i < NELM; i++, p += sizeof(epicsInt32)) {
+        if ((epicsInt32) getUInt32(p) != k * 100000 + (epicsInt32) i)
+            return -1;
+    }
+    return k;
+}
+
+/* Wait for the reply with cmd and ioid, returns 0 or -1 on timeout */
+static int waitReply(SOCKET sock, unsigned cmd, unsigned ioid,
+    caTestMsg *pMsg)
+{
+    while (!caTestRead(sock, pMsg, 5.0)) {
+        if (pMsg->cmd == cmd && pMsg->avail == ioid)
+            return 0;
+    }
+    return -1;
+}
+
+static SOCKET connectChannel(const char *name, int rcvBuf, unsigned *psid)
+{
+    SOCKET sock = caTestConnect(TEST_PORT, rcvBuf);
+    unsigned type = 0u, count = 0u;
+    long sid = caTestCreateChannel(sock, name, 1u, &type, &count);
+
+    *psid = sid < 0 ? 0u : (unsigned) sid;
+    if (sid < 0) {
+        epicsSocketDestroy(sock);
+        return INVALID_SOCKET;
+    }
+    return sock;
+}
+
+/* A client doing a put with completion and a read, as a CA client would */
+static void testRequests(double value)
+{
+    SOCKET sock;
+    unsigned sid;
+    caTestMsg msg;
+    char buf[8];
+    int ok;
+
+    sock = connectChannel(AI_NAME, 0, &sid);
+    testOk(sock != INVALID_SOCKET, "Channel " AI_NAME " connected");
+    if (sock == INVALID_SOCKET) {
+        testSkip(2, "Not connected");
+        return;
+    }
+    memset(&msg, 0, sizeof(msg));
+
+    putDouble(buf, value);
+    caTestWriteNotify(sock, sid, DBR_DOUBLE, 1u, 10u, buf, sizeof(buf));
+    ok = !waitReply(sock, CA_PROTO_WRITE_NOTIFY, 10u, &msg);
+    testOk(ok && msg.cid == ECA_NORMAL, "Put with completion done");
+
+    caTestReadNotify(sock, sid, DBR_DOUBLE, 1u, 11u);
+    ok = !waitReply(sock, CA_PROTO_READ_NOTIFY, 11u, &msg);
+    testOk(ok && msg.size >= 8 && getDouble(msg.payload) == value,
+        "Read back %g", ok && msg.size >= 8 ? getDouble(msg.payload) : -1.0);
+
+    caTestMsgFree(&msg);
+    epicsSocketDestroy(sock);
+}
+
+/* Read all replies and updates a stalled client has missed */
+static void readStalled(SOCKET sock, unsigned n)
+{
+    caTestMsg msg;
+    unsigned nReads = 0u;
+    epicsInt32 lastRead = 0, lastUpdate = 0;
+    int intact = 1, ordered = 1;
+
+    memset(&msg, 0, sizeof(msg));
+    while (!caTestRead(sock, &msg, nReads < NREADS ? 5.0 : 1.0)) {
+        epicsInt32 k = waveformValue(&msg);
+
+        if (msg.cmd == CA_PROTO_READ_NOTIFY) {
+            if (k < 0)
+                intact = 0;
+            else if (msg.avail != ++nReads || k < lastRead)
+                ordered = 0;
+            lastRead = k;
+        }
+        else if (msg.cmd == CA_PROTO_EVENT_ADD) {
+            if (k < 0)
+                intact = 0;
+            else if (k <= lastUpdate)
+                ordered = 0;
+            lastUpdate = k;
+        }
+    }
+    caTestMsgFree(&msg);
+    testOk(nReads == NREADS && intact && ordered,
+        "Client %u got %u of %u reads, intact %d, in order %d",
+        n, nReads, NREADS, intact, ordered);
+    testOk(lastUpdate == 4, "Client %u got the last update (%d)",
+        n, lastUpdate);
+}
+
+static void testStalled(void)
+{
+    SOCKET socks[NSTALLED];
+    unsigned sid, i, j;
+
+    testDiag("Clients which stop reading");
+    iocshCmd("var dbEventArraySnapshot 1");
+
+    putWaveform(1);
+    for (i = 0u; i < NSTALLED; i++) {
+        epicsInt32 k = -1;
+        caTestMsg msg;
+
+        socks[i] = connectChannel(WF_NAME, 4096, &sid);
+        if (socks[i] == INVALID_SOCKET)
+            testAbort("Can't connect to " WF_NAME);
+        memset(&msg, 0, sizeof(msg));
+        caTestSubscribe(socks[i], sid, DBR_LONG, NELM, 0u);
+        if (!waitReply(socks[i], CA_PROTO_EVENT_ADD, 0u, &msg))
+            k = waveformValue(&msg);
+        caTestMsgFree(&msg);
+        if (k != 1)
+            testAbort("No initial update for client %u", i);
+
+        /* far more than fits into the socket buffers */
+        for (j = 1u; j <= NREADS; j++)
+            caTestReadNotify(socks[i], sid, DBR_LONG, NELM, j);
+    }
+    for (i = 2; i <= 4; i++) {
+        putWaveform(i);
+        epicsThreadSleep(0.1);
+    }
+
+    testDiag("Other clients are served meanwhile");
+    testRequests(1.5);
+
+    for (i = 0u; i < NSTALLED; i++)
+        readStalled(socks[i], i);
+    for (i = 0u; i < NSTALLED; i++)
+        epicsSocketDestroy(socks[i]);
+}
+
+static void testAbandoned(void)
+{
+    SOCKET socks[NSTALLED];
+    unsigned sid, i, j;
+
+    testDiag("Clients which disconnect with replies pending");
+    for (i = 0u; i < NSTALLED; i++) {
+        socks[i] = connectChannel(WF_NAME, 4096, &sid);
+        if (socks[i] == INVALID_SOCKET)
+            testAbort("Can't connect to " WF_NAME);
+        caTestSubscribe(socks[i], sid, DBR_LONG, NELM, 0u);
+        for (j = 1u; j <= NREADS; j++)
+            caTestReadNotify(socks[i], sid, DBR_LONG, NELM, j);
+    }
+    putWaveform(5);
+    epicsThreadSleep(0.5);
+    for (i = 0u; i < NSTALLED; i++)
+        epicsSocketDestroy(socks[i]);
+    putWaveform(6);
+    epicsThreadSleep(0.5);
+
+    testRequests(2.5);
+}
+
+/* Check the replies of a client which sent two put notifies */
+static void readPutNotifies(SOCKET sock, unsigned n)
+{
+    caTestMsg msg;
+    unsigned nextIoid = 20u;
+    int ok = 1;
+
+    memset(&msg, 0, sizeof(msg));
+    while (nextIoid <= 21u && !caTestRead(sock, &msg, 10.0)) {
+        ok &= msg.cmd == CA_PROTO_WRITE_NOTIFY && msg.avail == nextIoid &&
+            msg.cid == ECA_NORMAL;
+        nextIoid++;
+    }
+    caTestMsgFree(&msg);
+    testOk(ok && nextIoid == 22u,
+        "Client %u got both put notify replies in order", n);
+}
+
+static void testPutNotifyBusy(void)
+{
+    SOCKET socks[NSTALLED];
+    unsigned sids[NSTALLED];
+    epicsTimeStamp start, done;
+    char buf[8];
+    unsigned i;
+    double delay;
+
+    testDiag("Clients with a put notify still busy");
+    for (i = 0u; i < NSTALLED; i++) {
+        char name[32];
+
+        epicsSnprintf(name, sizeof(name), SLOW_NAME, i);
+        socks[i] = connectChannel(name, 0, &sids[i]);
+        if (socks[i] == INVALID_SOCKET)
+            testAbort("Can't connect to %s", name);
+    }
+    for (i = 0u; i < NSTALLED; i++) {
+        /* the second waits for the first to complete */
+        putDouble(buf, 1.0);
+        caTestWriteNotify(socks[i], sids[i], DBR_DOUBLE, 1u, 20u,
+            buf, sizeof(buf));
+        putDouble(buf, 2.0);
+        caTestWriteNotify(socks[i], sids[i], DBR_DOUBLE, 1u, 21u,
+            buf, sizeof(buf));
+    }
+    epicsThreadSleep(0.1);
+
+    testDiag("Other clients are served meanwhile");
+    epicsTimeGetCurrent(&start);
+    testRequests(3.5);
+    epicsTimeGetCurrent(&done);
+    delay = epicsTimeDiffInSeconds(&done, &start);
+    testOk(delay < 1.5, "Served in %.2f seconds", delay);
+
+    for (i = 0u; i < NSTALLED; i++)
+        readPutNotifies(socks[i], i);
+    for (i = 0u; i < NSTALLED; i++)
+        epicsSocketDestroy(socks[i]);
+}
+
+MAIN(rsrvIoPoolTest)
+{
+    char port[16];
+
+    testPlan(28);
+
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT);
+    epicsEnvSet("EPICS_CA_SERVER_PORT", port);
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT + 1u);
+    epicsEnvSet("EPICS_CAS_BEACON_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "1000000");
+
+    testdbPrepare();
+    testdbReadDatabase("rsrvTestIoc.dbd", NULL, NULL);
+    rsrvTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvTest.db", NULL, NULL);
+
+    iocshCmd("var rsrvIoThreads 2");
+    eltc(0);
+    if (iocInit())
+        testAbort("iocInit() fails");
+    eltc(1);
+
+    if (!osiSockAttach())
+        testAbort("osiSockAttach() fails");
+
+    testRequests(0.5);
+    testStalled();
+    testAbandoned();
+    testPutNotifyBusy();
+
+    osiSockRelease();
+
+    /* the CA server can't be stopped */
+    return testDone();
+}
@@ -0,0 +1,257 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Large array updates sent by the CA server, from the send buffer or
+ * by reference to a shared snapshot, in many partial sends
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "osiSock.h"
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTypes.h"
+#include "iocsh.h"
+#include "iocInit.h"
+#include "caProto.h"
+#include "db_access.h"
+#include "db_access_routines.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "testMain.h"
+
+#include "caTestClient.h"
+
+void rsrvTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define TEST_PORT 55166
+#define PV_NAME "rsrvTest:wf"
+#define NELM 20000
+
+static epicsInt32 values[NELM];
+
+static void putWaveform(epicsInt32 k)
+{
+    int i;
+
+    for (i = 0; i < NELM; i++)
+        values[i] = k * 100000 + i;
+    testdbPutArrFieldOk(PV_NAME, DBF_LONG, NELM, values);
+}
+
+static epicsUInt32 getUInt32(const char *p)
+{
+    const unsigned char *u = (const unsigned char *) p;
+
+    return ((epicsUInt32) u[0] << 24) | ((epicsUInt32) u[1] << 16) |
+        ((epicsUInt32) u[2] << 8) | u[3];
+}
+
+static double getDouble(const char *p)
+{
+    epicsUInt64 bits = ((epicsUInt64) getUInt32(p) << 32) | getUInt32(p + 4);
+    double d;
+
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+/* The k of an update if all of its values match, else -1 */
+static epicsInt32 updateValue(const caTestMsg *pMsg)
+{
+    const char *p = pMsg->payload + dbr_value_offset[pMsg->type];
+    unsigned size = dbr_value_size[pMsg->type];
+    epicsInt32 k;
+    unsigned i;
+
+    if (pMsg->count != NELM ||
+            pMsg->size < dbr_value_offset[pMsg->type] + NELM * size)
+        return -1;
+    if (pMsg->type == DBR_DOUBLE) {
+        k = (epicsInt32) (getDouble(p) / 100000);
+        for (i = 0; i < NELM; i++, p += size) {
+            if (getDouble(p) != k * 100000.0 + i)
+                return -1;
+        }
+    }
+    else {
+        k = (epicsInt32) getUInt32(p) / 100000;
+        for (i = 0; i < NELM; i++, p += size) {
+            if ((epicsInt32) getUInt32(p) != k * 100000 + (epicsInt32) i)
+                return -1;
+        }
+    }
+    return k;
+}
+
+/* Read updates until each of n subscriptions had one, return their k */
+static void readUpdates(SOCKET sock, unsigned n, epicsInt32 *k)
+{
+    caTestMsg msg;
+    unsigned i, nseen = 0u;
+
+    for (i = 0u; i < n; i++)
+        k[i] = -2;
+    memset(&msg, 0, sizeof(msg));
+    while (nseen < n && !caTestRead(sock, &msg, 5.0)) {
+        if (msg.cmd != CA_PROTO_EVENT_ADD || msg.avail >= n)
+            continue;
+        if (k[msg.avail] == -2)
+            nseen++;
+        k[msg.avail] = updateValue(&msg);
+    }
+    caTestMsgFree(&msg);
+}
+
+static SOCKET connectChannel(int rcvBuf, unsigned *psid)
+{
+    SOCKET sock = caTestConnect(TEST_PORT, rcvBuf);
+    unsigned type = 0u, count = 0u;
+    long sid = caTestCreateChannel(sock, PV_NAME, 1u, &type, &count);
+
+    testOk(sid >= 0 && type == DBR_LONG && count == NELM,
+        "Channel connected, type %u count %u", type, count);
+    *psid = (unsigned) sid;
+    return sock;
+}
+
+static void testCopy(void)
+{
+    SOCKET sock;
+    unsigned sid;
+    epicsInt32 k;
+
+    testDiag("Updates copied into the send buffer");
+    iocshCmd("var dbEventArraySnapshot 0");
+    iocshCmd("var rsrvSendMax 999");
+
+    putWaveform(1);
+    sock = connectChannel(0, &sid);
+    caTestSubscribe(sock, sid, DBR_TIME_LONG, NELM, 0u);
+    readUpdates(sock, 1u, &k);
+    testOk(k == 1, "Initial update intact (%d)", k);
+
+    putWaveform(2);
+    readUpdates(sock, 1u, &k);
+    testOk(k == 2, "Update intact (%d)", k);
+
+    epicsSocketDestroy(sock);
+}
+
+static void testShared(void)
+{
+    SOCKET sock;
+    unsigned sid;
+    epicsInt32 k[3];
+
+    testDiag("Updates sent by reference to a snapshot");
+    iocshCmd("var dbEventArraySnapshot 1");
+    iocshCmd("var rsrvSendMax 999");
+
+    sock = connectChannel(0, &sid);
+    caTestSubscribe(sock, sid, DBR_TIME_LONG, NELM, 0u);
+    caTestSubscribe(sock, sid, DBR_LONG, 0u, 1u);
+    /* needs conversion, so it is copied */
+    caTestSubscribe(sock, sid, DBR_DOUBLE, NELM, 2u);
+    readUpdates(sock, 3u, k);
+    testOk(k[0] == 2 && k[1] == 2 && k[2] == 2,
+        "Initial updates intact (%d, %d, %d)", k[0], k[1], k[2]);
+
+    putWaveform(3);
+    readUpdates(sock, 3u, k);
+    testOk(k[0] == 3 && k[1] == 3,
+        "Updates by reference intact (%d, %d)", k[0], k[1]);
+    testOk(k[2] == 3, "Converted update intact (%d)", k[2]);
+
+    epicsSocketDestroy(sock);
+}
+
+static void testStalled(void)
+{
+    SOCKET sock;
+    unsigned sid, i;
+    epicsInt32 last[2] = {-1, -1};
+    int intact = 1, ordered = 1;
+    caTestMsg msg;
+
+    testDiag("Record updates while the client isn't reading");
+    iocshCmd("var dbEventArraySnapshot 1");
+    iocshCmd("var rsrvSendMax 0");
+
+    sock = connectChannel(4096, &sid);
+    caTestSubscribe(sock, sid, DBR_LONG, NELM, 0u);
+    caTestSubscribe(sock, sid, DBR_TIME_LONG, NELM, 1u);
+    readUpdates(sock, 2u, last);
+
+    /* the server blocks in the middle of sending 4, holding references */
+    for (i = 4u; i <= 6u; i++) {
+        putWaveform(i);
+        epicsThreadSleep(0.2);
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    while (!caTestRead(sock, &msg, 2.0)) {
+        epicsInt32 k;
+
+        if (msg.cmd != CA_PROTO_EVENT_ADD || msg.avail > 1u)
+            continue;
+        k = updateValue(&msg);
+        if (k < 0)
+            intact = 0;
+        else if (k <= last[msg.avail])
+            ordered = 0;
+        last[msg.avail] = k;
+    }
+    caTestMsgFree(&msg);
+    testOk(intact, "All updates intact");
+    testOk(ordered && last[0] == 6 && last[1] == 6,
+        "Updates in order, last (%d, %d)", last[0], last[1]);
+
+    epicsSocketDestroy(sock);
+}
+
+MAIN(rsrvTcpTest)
+{
+    char port[16];
+
+    testPlan(16);
+
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT);
+    epicsEnvSet("EPICS_CA_SERVER_PORT", port);
+    epicsSnprintf(port, sizeof(port), "%u", TEST_PORT + 1u);
+    epicsEnvSet("EPICS_CAS_BEACON_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "1000000");
+
+    testdbPrepare();
+    testdbReadDatabase("rsrvTestIoc.dbd", NULL, NULL);
+    rsrvTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvTest.db", NULL, NULL);
+
+    eltc(0);
+    if (iocInit())
+        testAbort("iocInit() fails");
+    eltc(1);
+
+    if (!osiSockAttach())
+        testAbort("osiSockAttach() fails");
+
+    testCopy();
+    testShared();
+    testStalled();
+
+    osiSockRelease();
+
+    /* the CA server can't be stopped */
+    return testDone();
+}
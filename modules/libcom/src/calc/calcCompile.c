@@ -0,0 +1,610 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Translate postfix expressions into instructions for calcPerformCompiled()
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsTypes.h"
+#include "postfix.h"
+#include "postfixPvt.h"
+
+/* Values on the stack while compiling.  Constants and arguments are not
+ * pushed until an operation needs them on the runtime stack, so that it
+ * can take them as operands instead.  Pending values are always above
+ * all of the values which are on the runtime stack.
+ */
+typedef enum {
+    VALUE_RUNTIME,
+    VALUE_CONST,
+    VALUE_ARG
+} valueKind;
+
+typedef struct {
+    valueKind kind;
+    int arg;
+    double k;
+} value;
+
+/* Conditionals become jumps to the RPN positions which calcPerform()
+ * would continue from, found the same way as cond_search() does.  The
+ * stack depth and first instruction of each jump target are recorded.
+ */
+typedef struct {
+    int depth;              /* -1 if not a target */
+    unsigned int label;     /* first instruction at this position */
+} rpnTarget;
+
+typedef struct {
+    calcInsn *insn;
+    unsigned int ninsn;
+    unsigned int barrier;   /* first instruction after the last jump target */
+    value stack[CALCPERFORM_STACK+1];
+    int depth;
+    rpnTarget *targets;     /* one per byte of RPN */
+} compiler;
+
+/* Length of an RPN instruction */
+static int rpnLength(const char *pinst)
+{
+    switch (*pinst) {
+    case LITERAL_DOUBLE:
+        return 1 + sizeof(double);
+    case LITERAL_INT:
+        return 1 + sizeof(epicsInt32);
+    case MIN:
+    case MAX:
+    case FINITE:
+    case ISNAN:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+/* Find the position after the matching conditional, cf. cond_search() */
+static const char * rpnSearch(const char *pinst, int match)
+{
+    int count = 1;
+    int op;
+
+    while ((op = *pinst) != END_EXPRESSION) {
+        pinst += rpnLength(pinst);
+        if (op == match && --count == 0)
+            return pinst;
+        if (op == COND_IF)
+            count++;
+    }
+    return NULL;
+}
+
+/* Number of values an RPN operator takes from the stack, -1 if unknown */
+static int rpnOperands(const char *pinst)
+{
+    switch (*pinst) {
+    case CONST_PI:
+    case CONST_D2R:
+    case CONST_R2D:
+        return 0;
+
+    case UNARY_NEG:
+    case ABS_VAL:
+    case EXP:
+    case LOG_10:
+    case LOG_E:
+    case SQU_RT:
+    case ACOS:
+    case ASIN:
+    case ATAN:
+    case COS:
+    case COSH:
+    case SIN:
+    case SINH:
+    case TAN:
+    case TANH:
+    case CEIL:
+    case FLOOR:
+    case ISINF:
+    case NINT:
+    case REL_NOT:
+    case BIT_NOT:
+        return 1;
+
+    case ADD:
+    case SUB:
+    case MULT:
+    case DIV:
+    case MODULO:
+    case POWER:
+    case ATAN2:
+    case FMOD:
+    case REL_OR:
+    case REL_AND:
+    case BIT_OR:
+    case BIT_AND:
+    case BIT_EXCL_OR:
+    case RIGHT_SHIFT_ARITH:
+    case LEFT_SHIFT_ARITH:
+    case RIGHT_SHIFT_LOGIC:
+    case NOT_EQ:
+    case LESS_THAN:
+    case LESS_OR_EQ:
+    case EQUAL:
+    case GR_OR_EQ:
+    case GR_THAN:
+        return 2;
+
+    case MAX:
+    case MIN:
+    case FINITE:
+    case ISNAN:
+        return pinst[1];
+
+    default:
+        return -1;
+    }
+}
+
+/* The _ARG opcode of operators which have operand forms, or 0 */
+static int argForm(int op)
+{
+    switch (op) {
+    case ADD:           return ADD_ARG;
+    case SUB:           return SUB_ARG;
+    case MULT:          return MULT_ARG;
+    case DIV:           return DIV_ARG;
+    case NOT_EQ:        return NOT_EQ_ARG;
+    case LESS_THAN:     return LESS_THAN_ARG;
+    case LESS_OR_EQ:    return LESS_OR_EQ_ARG;
+    case EQUAL:         return EQUAL_ARG;
+    case GR_OR_EQ:      return GR_OR_EQ_ARG;
+    case GR_THAN:       return GR_THAN_ARG;
+    default:            return 0;
+    }
+}
+
+/* Apply an operator to constants, using calcPerform() so that the result
+ * is exactly what it would have been at runtime.
+ */
+static int fold(const char *pinst, const value *pargs, int nargs,
+    double *presult)
+{
+    char rpn[CALCPERFORM_STACK * (1 + sizeof(double)) + 3];
+    char *pout = rpn;
+    int i;
+
+    for (i = 0; i < nargs; i++) {
+        *pout++ = LITERAL_DOUBLE;
+        memcpy(pout, &pargs[i].k, sizeof(double));
+        pout += sizeof(double);
+    }
+    memcpy(pout, pinst, rpnLength(pinst));
+    pout += rpnLength(pinst);
+    *pout = END_EXPRESSION;
+    return calcPerform(NULL, presult, rpn) ? -1 : 0;
+}
+
+static calcInsn * emit(compiler *pc, int op)
+{
+    calcInsn *pinsn = &pc->insn[pc->ninsn++];
+
+    memset(pinsn, 0, sizeof(calcInsn));
+    pinsn->op = op;
+    return pinsn;
+}
+
+/* Push a pending value onto the runtime stack */
+static void materialize(compiler *pc, value *pval)
+{
+    if (pval->kind == VALUE_CONST)
+        emit(pc, PUSH_CONST)->k = pval->k;
+    else if (pval->kind == VALUE_ARG)
+        emit(pc, PUSH_ARG)->a = pval->arg;
+    pval->kind = VALUE_RUNTIME;
+}
+
+/* Push the pending values below the top n */
+static void materializeBelow(compiler *pc, int n)
+{
+    int i;
+
+    for (i = 1; i <= pc->depth - n; i++)
+        materialize(pc, &pc->stack[i]);
+}
+
+/* Fuse a*b+c, with the product computed by a MULT_ARGS instruction */
+static void fuseMulAdd(compiler *pc)
+{
+    calcInsn *padd = &pc->insn[pc->ninsn - 1];
+    calcInsn *pmul = padd - 1;
+    calcInsn *ppush = padd - 2;
+
+    if (pc->ninsn >= 2 && pc->ninsn - 2 >= pc->barrier &&
+        pmul->op == MULT_ARGS) {
+        /* product + c */
+        if (padd->op == ADD_ARG) {
+            pmul->op = MULADD_ARGS;
+            pmul->c = padd->a;
+        }
+        else if (padd->op == ADD_CONST) {
+            pmul->op = MULADD_ARGS_CONST;
+            pmul->k = padd->k;
+        }
+        else
+            return;
+        pc->ninsn--;
+    }
+    else if (pc->ninsn >= 3 && pc->ninsn - 3 >= pc->barrier &&
+        pmul->op == MULT_ARGS && padd->op == ADD) {
+        /* c + product, addition is commutative */
+        if (ppush->op == PUSH_ARG) {
+            ppush->op = MULADD_ARGS;
+            ppush->c = ppush->a;
+        }
+        else if (ppush->op == PUSH_CONST) {
+            ppush->op = MULADD_ARGS_CONST;
+        }
+        else
+            return;
+        ppush->a = pmul->a;
+        ppush->b = pmul->b;
+        pc->ninsn -= 2;
+    }
+}
+
+/* Compile an operator taking n values from the stack */
+static int compileOperator(compiler *pc, const char *pinst, int n)
+{
+    value *pargs;
+    int op = *pinst;
+    int form = argForm(op);
+    int i;
+
+    if (n < 0 || pc->depth < n || pc->depth - n >= CALCPERFORM_STACK)
+        return -1;
+    pargs = &pc->stack[pc->depth - n + 1];
+
+    for (i = 0; i < n; i++) {
+        if (pargs[i].kind != VALUE_CONST)
+            break;
+    }
+    if (i == n) {
+        double result;
+
+        if (fold(pinst, pargs, n, &result))
+            return -1;
+        pc->depth -= n;
+        pargs = &pc->stack[++pc->depth];
+        pargs->kind = VALUE_CONST;
+        pargs->k = result;
+        return 0;
+    }
+
+    materializeBelow(pc, n);
+    if (n == 2 && form && pargs[1].kind != VALUE_RUNTIME) {
+        if (pargs[0].kind == VALUE_ARG && pargs[1].kind == VALUE_ARG) {
+            calcInsn *pinsn = emit(pc, form + (ADD_ARGS - ADD_ARG));
+
+            pinsn->a = pargs[0].arg;
+            pinsn->b = pargs[1].arg;
+        }
+        else {
+            materialize(pc, &pargs[0]);
+            if (pargs[1].kind == VALUE_ARG)
+                emit(pc, form)->a = pargs[1].arg;
+            else
+                emit(pc, form + (ADD_CONST - ADD_ARG))->k = pargs[1].k;
+        }
+    }
+    else {
+        for (i = 0; i < n; i++)
+            materialize(pc, &pargs[i]);
+        emit(pc, op)->a = n;
+    }
+    if (op == ADD)
+        fuseMulAdd(pc);
+
+    pc->depth -= n;
+    pc->stack[++pc->depth].kind = VALUE_RUNTIME;
+    return 0;
+}
+
+/* Emit a jump to the position after the matching match */
+static int jump(compiler *pc, const char *prpn, const char *pinst,
+    int op, int match)
+{
+    const char *ptarget = rpnSearch(pinst + 1, match);
+    rpnTarget *pt;
+
+    if (!ptarget)
+        return -1;
+    pt = &pc->targets[ptarget - prpn];
+    if (pt->depth < 0)
+        pt->depth = pc->depth;
+    else if (pt->depth != pc->depth)
+        return -1;
+    /* patched once the target has been compiled */
+    if (op != NOT_GENERATED)
+        emit(pc, op)->jump = ptarget - prpn;
+    return 0;
+}
+
+static int compile(compiler *pc, const char *prpn)
+{
+    const char *pinst = prpn;
+    int reachable = 1;
+    unsigned int i;
+    int op;
+
+    for (;;) {
+        value *ptop;
+        rpnTarget *pt = &pc->targets[pinst - prpn];
+
+        if (pt->depth >= 0) {
+            if (!reachable)
+                pc->depth = pt->depth;
+            else {
+                materializeBelow(pc, 0);
+                if (pc->depth != pt->depth)
+                    return -1;
+            }
+            pt->label = pc->barrier = pc->ninsn;
+            reachable = 1;
+        }
+        else if (!reachable)
+            return -1;
+
+        op = *pinst;
+        if (op == END_EXPRESSION)
+            break;
+        ptop = &pc->stack[pc->depth];
+
+        switch (op) {
+
+        case LITERAL_DOUBLE:
+            if (pc->depth >= CALCPERFORM_STACK) return -1;
+            ptop[1].kind = VALUE_CONST;
+            memcpy(&ptop[1].k, pinst + 1, sizeof(double));
+            pc->depth++;
+            break;
+
+        case LITERAL_INT: {
+            epicsInt32 itop;
+
+            if (pc->depth >= CALCPERFORM_STACK) return -1;
+            memcpy(&itop, pinst + 1, sizeof(epicsInt32));
+            ptop[1].kind = VALUE_CONST;
+            ptop[1].k = itop;
+            pc->depth++;
+            break;
+        }
+
+        case FETCH_A:
+        case FETCH_B:
+        case FETCH_C:
+        case FETCH_D:
+        case FETCH_E:
+        case FETCH_F:
+        case FETCH_G:
+        case FETCH_H:
+        case FETCH_I:
+        case FETCH_J:
+        case FETCH_K:
+        case FETCH_L:
+            if (pc->depth >= CALCPERFORM_STACK) return -1;
+            ptop[1].kind = VALUE_ARG;
+            ptop[1].arg = op - FETCH_A;
+            pc->depth++;
+            break;
+
+        case FETCH_VAL:
+        case RANDOM:
+            if (pc->depth >= CALCPERFORM_STACK) return -1;
+            materializeBelow(pc, 0);
+            emit(pc, op);
+            ptop[1].kind = VALUE_RUNTIME;
+            pc->depth++;
+            break;
+
+        case STORE_A:
+        case STORE_B:
+        case STORE_C:
+        case STORE_D:
+        case STORE_E:
+        case STORE_F:
+        case STORE_G:
+        case STORE_H:
+        case STORE_I:
+        case STORE_J:
+        case STORE_K:
+        case STORE_L:
+            /* pending arguments must be read before the store */
+            if (pc->depth < 1) return -1;
+            materializeBelow(pc, 0);
+            emit(pc, STORE_ARG)->a = op - STORE_A;
+            pc->depth--;
+            break;
+
+        case COND_IF:
+            if (pc->depth < 1) return -1;
+            if (ptop->kind == VALUE_CONST) {
+                /* no test needed, skip the dead branch */
+                materializeBelow(pc, 1);
+                pc->depth--;
+                if (ptop->k != 0.0) {
+                    /* nothing targets the else branch, see COND_ELSE */
+                    if (!rpnSearch(pinst + 1, COND_ELSE))
+                        return -1;
+                    break;
+                }
+                if (jump(pc, prpn, pinst, NOT_GENERATED, COND_ELSE))
+                    return -1;
+                pinst = rpnSearch(pinst + 1, COND_ELSE);
+                reachable = 0;
+                continue;
+            }
+            materializeBelow(pc, 0);
+            pc->depth--;
+            if (jump(pc, prpn, pinst, JUMP_IF_ZERO, COND_ELSE))
+                return -1;
+            break;
+
+        case COND_ELSE:
+            materializeBelow(pc, 0);
+            if (pc->targets[pinst + 1 - prpn].depth < 0) {
+                /* the condition was true, skip the dead else branch */
+                if (jump(pc, prpn, pinst, NOT_GENERATED, COND_END))
+                    return -1;
+                pinst = rpnSearch(pinst + 1, COND_END);
+                reachable = 0;
+                continue;
+            }
+            if (jump(pc, prpn, pinst, JUMP, COND_END))
+                return -1;
+            reachable = 0;
+            break;
+
+        case COND_END:
+            break;
+
+        default:
+            if (compileOperator(pc, pinst, rpnOperands(pinst)))
+                return -1;
+            break;
+        }
+        pinst += rpnLength(pinst);
+    }
+
+    if (pc->depth != 1)
+        return -1;
+    materializeBelow(pc, 0);
+    emit(pc, END_EXPRESSION);
+
+    for (i = 0; i < pc->ninsn; i++) {
+        calcInsn *pinsn = &pc->insn[i];
+
+        if (pinsn->op == JUMP || pinsn->op == JUMP_IF_ZERO)
+            pinsn->jump = pc->targets[pinsn->jump].label;
+    }
+    return 0;
+}
+
+LIBCOM_API calcCompiled *
+    calcCompile(const char *pinst)
+{
+    calcCompiled *pcompiled;
+    compiler *pc;
+    unsigned int n = 1;
+    const char *prpn;
+    size_t i, len;
+
+    if (!pinst)
+        return NULL;
+
+    /* At most one instruction per RPN instruction */
+    for (prpn = pinst; *prpn != END_EXPRESSION; prpn += rpnLength(prpn))
+        n++;
+    len = prpn - pinst + 1;
+
+    pc = calloc(1, sizeof(compiler));
+    pcompiled = malloc(offsetof(calcCompiled, insn) + n * sizeof(calcInsn));
+    if (!pc || !pcompiled ||
+        !(pc->targets = malloc(len * sizeof(rpnTarget)))) {
+        if (pc)
+            free(pc->targets);
+        free(pc);
+        free(pcompiled);
+        return NULL;
+    }
+    for (i = 0; i < len; i++)
+        pc->targets[i].depth = -1;
+    pc->insn = pcompiled->insn;
+
+    if (compile(pc, pinst)) {
+        free(pcompiled);
+        pcompiled = NULL;
+    }
+    else
+        pcompiled->ninsn = pc->ninsn;
+    free(pc->targets);
+    free(pc);
+    return pcompiled;
+}
+
+LIBCOM_API void
+    calcCompiledFree(calcCompiled *pcompiled)
+{
+    free(pcompiled);
+}
+
+LIBCOM_API void
+    calcCompiledDump(const calcCompiled *pcompiled)
+{
+    static const char *names[] = {
+        "PUSH_CONST", "PUSH_ARG", "STORE_ARG", "JUMP", "JUMP_IF_ZERO",
+        "ADD_ARG", "ADD_CONST", "ADD_ARGS",
+        "SUB_ARG", "SUB_CONST", "SUB_ARGS",
+        "MULT_ARG", "MULT_CONST", "MULT_ARGS",
+        "DIV_ARG", "DIV_CONST", "DIV_ARGS",
+        "NOT_EQ_ARG", "NOT_EQ_CONST", "NOT_EQ_ARGS",
+        "LESS_THAN_ARG", "LESS_THAN_CONST", "LESS_THAN_ARGS",
+        "LESS_OR_EQ_ARG", "LESS_OR_EQ_CONST", "LESS_OR_EQ_ARGS",
+        "EQUAL_ARG", "EQUAL_CONST", "EQUAL_ARGS",
+        "GR_OR_EQ_ARG", "GR_OR_EQ_CONST", "GR_OR_EQ_ARGS",
+        "GR_THAN_ARG", "GR_THAN_CONST", "GR_THAN_ARGS",
+        "MULADD_ARGS", "MULADD_ARGS_CONST"
+    };
+    unsigned int i;
+
+    for (i = 0; i < pcompiled->ninsn; i++) {
+        const calcInsn *pinsn = &pcompiled->insn[i];
+        int op = pinsn->op;
+
+        printf("\t%3u  ", i);
+        if (op > NOT_GENERATED && op < CALC_INSN_LAST)
+            printf("%s", names[op - PUSH_CONST]);
+        else
+            printf("opcode %d", op);
+
+        switch (op) {
+        case PUSH_CONST:
+        case ADD_CONST: case SUB_CONST: case MULT_CONST: case DIV_CONST:
+        case NOT_EQ_CONST: case LESS_THAN_CONST: case LESS_OR_EQ_CONST:
+        case EQUAL_CONST: case GR_OR_EQ_CONST: case GR_THAN_CONST:
+            printf(" %g\n", pinsn->k);
+            break;
+        case PUSH_ARG: case STORE_ARG:
+        case ADD_ARG: case SUB_ARG: case MULT_ARG: case DIV_ARG:
+        case NOT_EQ_ARG: case LESS_THAN_ARG: case LESS_OR_EQ_ARG:
+        case EQUAL_ARG: case GR_OR_EQ_ARG: case GR_THAN_ARG:
+            printf(" %c\n", 'A' + pinsn->a);
+            break;
+        case ADD_ARGS: case SUB_ARGS: case MULT_ARGS: case DIV_ARGS:
+        case NOT_EQ_ARGS: case LESS_THAN_ARGS: case LESS_OR_EQ_ARGS:
+        case EQUAL_ARGS: case GR_OR_EQ_ARGS: case GR_THAN_ARGS:
+            printf(" %c, %c\n", 'A' + pinsn->a, 'A' + pinsn->b);
+            break;
+        case MULADD_ARGS:
+            printf(" %c, %c, %c\n", 'A' + pinsn->a, 'A' + pinsn->b,
+                'A' + pinsn->c);
+            break;
+        case MULADD_ARGS_CONST:
+            printf(" %c, %c, %g\n", 'A' + pinsn->a, 'A' + pinsn->b, pinsn->k);
+            break;
+        case JUMP:
+        case JUMP_IF_ZERO:
+            printf(" %d\n", (int) pinsn->jump);
+            break;
+        default:
+            printf("\n");
+        }
+    }
+}
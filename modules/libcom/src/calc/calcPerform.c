@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include "osiUnistd.h"
+#include "compilerSpecific.h"
 #include "dbDefs.h"
 #include "epicsMath.h"
 #include "epicsTypes.h"
@@ -38,6 +39,285 @@ static int cond_search(const char **ppinst, int match);
 #  pragma optimize("g", off)
 #endif
 
+/* calcStackOp
+ *
+ * Apply an operator to the values on top of the stack, shared by
+ * calcPerform() and calcPerformCompiled().  The var-arg operators
+ * take nargs values.  Returns the new stack pointer, or NULL for an
+ * unknown operator.
+ */
+static EPICS_ALWAYS_INLINE double *
+    calcStackOp(int op, int nargs, double *ptop)
+{
+    double top;                         /* value from top of stack */
+    epicsInt32 itop;                    /* integer from top of stack */
+
+    switch (op){
+
+    case UNARY_NEG:
+        *ptop = - *ptop;
+        break;
+
+    case ADD:
+        top = *ptop--;
+        *ptop += top;
+        break;
+
+    case SUB:
+        top = *ptop--;
+        *ptop -= top;
+        break;
+
+    case MULT:
+        top = *ptop--;
+        *ptop *= top;
+        break;
+
+    case DIV:
+        top = *ptop--;
+        *ptop /= top;
+        break;
+
+    case MODULO:
+        itop = (epicsInt32) *ptop--;
+        if (itop)
+            *ptop = (epicsInt32) *ptop % itop;
+        else
+            *ptop = epicsNAN;
+        break;
+
+    case POWER:
+        top = *ptop--;
+        *ptop = pow(*ptop, top);
+        break;
+
+    case ABS_VAL:
+        *ptop = fabs(*ptop);
+        break;
+
+    case EXP:
+        *ptop = exp(*ptop);
+        break;
+
+    case LOG_10:
+        *ptop = log10(*ptop);
+        break;
+
+    case LOG_E:
+        *ptop = log(*ptop);
+        break;
+
+    case MAX:
+        while (--nargs) {
+            top = *ptop--;
+            if (*ptop < top || isnan(top))
+                *ptop = top;
+        }
+        break;
+
+    case MIN:
+        while (--nargs) {
+            top = *ptop--;
+            if (*ptop > top || isnan(top))
+                *ptop = top;
+        }
+        break;
+
+    case SQU_RT:
+        *ptop = sqrt(*ptop);
+        break;
+
+    case ACOS:
+        *ptop = acos(*ptop);
+        break;
+
+    case ASIN:
+        *ptop = asin(*ptop);
+        break;
+
+    case ATAN:
+        *ptop = atan(*ptop);
+        break;
+
+    case ATAN2:
+        top = *ptop--;
+        *ptop = atan2(top, *ptop);  /* Ouch!: Args backwards! */
+        break;
+
+    case COS:
+        *ptop = cos(*ptop);
+        break;
+
+    case SIN:
+        *ptop = sin(*ptop);
+        break;
+
+    case TAN:
+        *ptop = tan(*ptop);
+        break;
+
+    case COSH:
+        *ptop = cosh(*ptop);
+        break;
+
+    case SINH:
+        *ptop = sinh(*ptop);
+        break;
+
+    case TANH:
+        *ptop = tanh(*ptop);
+        break;
+
+    case CEIL:
+        *ptop = ceil(*ptop);
+        break;
+
+    case FLOOR:
+        *ptop = floor(*ptop);
+        break;
+
+    case FMOD:
+        top = *ptop--;
+        *ptop = fmod(*ptop, top);
+        break;
+
+    case FINITE:
+        top = finite(*ptop);
+        while (--nargs) {
+            --ptop;
+            top = top && finite(*ptop);
+        }
+        *ptop = top;
+        break;
+
+    case ISINF:
+        *ptop = isinf(*ptop);
+        break;
+
+    case ISNAN:
+        top = isnan(*ptop);
+        while (--nargs) {
+            --ptop;
+            top = top || isnan(*ptop);
+        }
+        *ptop = top;
+        break;
+
+    case NINT:
+        top = *ptop;
+        *ptop = (epicsInt32) (top >= 0 ? top + 0.5 : top - 0.5);
+        break;
+
+    case RANDOM:
+        *++ptop = calcRandom();
+        break;
+
+    case REL_OR:
+        top = *ptop--;
+        *ptop = *ptop || top;
+        break;
+
+    case REL_AND:
+        top = *ptop--;
+        *ptop = *ptop && top;
+        break;
+
+    case REL_NOT:
+        *ptop = ! *ptop;
+        break;
+
+    /* Be VERY careful converting double to int in case bit 31 is set!
+     * Out-of-range errors give very different results on different systems.
+     * Convert negative doubles to signed and positive doubles to unsigned
+     * first to avoid overflows if bit 32 is set.
+     * The result is always signed, values with bit 31 set are negative
+     * to avoid problems when writing the value to signed integer fields
+     * like longout.VAL or ao.RVAL. However unsigned fields may give
+     * problems on some architectures. (Fewer than giving problems with
+     * signed integer. Maybe the conversion functions should handle
+     * overflows better.)
+     */
+    #define d2i(x) ((x)<0?(epicsInt32)(x):(epicsInt32)(epicsUInt32)(x))
+    #define d2ui(x) ((x)<0?(epicsUInt32)(epicsInt32)(x):(epicsUInt32)(x))
+
+    case BIT_OR:
+        top = *ptop--;
+        *ptop = (double)(d2i(*ptop) | d2i(top));
+        break;
+
+    case BIT_AND:
+        top = *ptop--;
+        *ptop = (double)(d2i(*ptop) & d2i(top));
+        break;
+
+    case BIT_EXCL_OR:
+        top = *ptop--;
+        *ptop = (double)(d2i(*ptop) ^ d2i(top));
+        break;
+
+    case BIT_NOT:
+        *ptop = (double)~d2i(*ptop);
+        break;
+
+    /* In C the shift operators decide on an arithmetic or logical shift
+     * based on whether the integer is signed or unsigned.
+     * With signed integers, a right-shift is arithmetic and will
+     * extend the sign bit into the left-hand end of the value. When used
+     * with unsigned values a logical shift is performed. The
+     * double-casting through signed/unsigned here is important, see above.
+     */
+
+    case RIGHT_SHIFT_ARITH:
+        top = *ptop--;
+        *ptop = (double)(d2i(*ptop) >> (d2i(top) & 31));
+        break;
+
+    case LEFT_SHIFT_ARITH:
+        top = *ptop--;
+        *ptop = (double)(d2i(*ptop) << (d2i(top) & 31));
+        break;
+
+    case RIGHT_SHIFT_LOGIC:
+        top = *ptop--;
+        *ptop = (double)(d2ui(*ptop) >> (d2ui(top) & 31u));
+        break;
+
+    case NOT_EQ:
+        top = *ptop--;
+        *ptop = *ptop != top;
+        break;
+
+    case LESS_THAN:
+        top = *ptop--;
+        *ptop = *ptop < top;
+        break;
+
+    case LESS_OR_EQ:
+        top = *ptop--;
+        *ptop = *ptop <= top;
+        break;
+
+    case EQUAL:
+        top = *ptop--;
+        *ptop = *ptop == top;
+        break;
+
+    case GR_OR_EQ:
+        top = *ptop--;
+        *ptop = *ptop >= top;
+        break;
+
+    case GR_THAN:
+        top = *ptop--;
+        *ptop = *ptop > top;
+        break;
+
+    default:
+        return NULL;
+    }
+    return ptop;
+}
+
 /* calcPerform
  *
  * Evalutate the postfix expression
@@ -47,10 +327,9 @@ LIBCOM_API long
 {
     double stack[CALCPERFORM_STACK+1];  /* zero'th entry not used */
     double *ptop;                       /* stack pointer */
-    double top;                         /* value from top of stack */
     epicsInt32 itop;                    /* integer from top of stack */
     int op;
-    int nargs;
+    int nargs = 0;
 
     /* initialize */
     ptop = stack;
@@ -116,283 +395,133 @@ LIBCOM_API long
             *++ptop = 180./PI;
             break;
 
-        case UNARY_NEG:
-            *ptop = - *ptop;
-            break;
-
-        case ADD:
-            top = *ptop--;
-            *ptop += top;
-            break;
-
-        case SUB:
-            top = *ptop--;
-            *ptop -= top;
-            break;
-
-        case MULT:
-            top = *ptop--;
-            *ptop *= top;
-            break;
-
-        case DIV:
-            top = *ptop--;
-            *ptop /= top;
-            break;
-
-        case MODULO:
-            itop = (epicsInt32) *ptop--;
-            if (itop)
-                *ptop = (epicsInt32) *ptop % itop;
-            else
-                *ptop = epicsNAN;
-            break;
-
-        case POWER:
-            top = *ptop--;
-            *ptop = pow(*ptop, top);
-            break;
-
-        case ABS_VAL:
-            *ptop = fabs(*ptop);
-            break;
-
-        case EXP:
-            *ptop = exp(*ptop);
+        case COND_IF:
+            if (*ptop-- == 0.0 &&
+                cond_search(&pinst, COND_ELSE)) return -1;
             break;
 
-        case LOG_10:
-            *ptop = log10(*ptop);
+        case COND_ELSE:
+            if (cond_search(&pinst, COND_END)) return -1;
             break;
 
-        case LOG_E:
-            *ptop = log(*ptop);
+        case COND_END:
             break;
 
         case MAX:
-            nargs = *pinst++;
-            while (--nargs) {
-                top = *ptop--;
-                if (*ptop < top || isnan(top))
-                    *ptop = top;
-            }
-            break;
-
         case MIN:
-            nargs = *pinst++;
-            while (--nargs) {
-                top = *ptop--;
-                if (*ptop > top || isnan(top))
-                    *ptop = top;
-            }
-            break;
-
-        case SQU_RT:
-            *ptop = sqrt(*ptop);
-            break;
-
-        case ACOS:
-            *ptop = acos(*ptop);
-            break;
-
-        case ASIN:
-            *ptop = asin(*ptop);
-            break;
-
-        case ATAN:
-            *ptop = atan(*ptop);
-            break;
-
-        case ATAN2:
-            top = *ptop--;
-            *ptop = atan2(top, *ptop);  /* Ouch!: Args backwards! */
-            break;
-
-        case COS:
-            *ptop = cos(*ptop);
-            break;
-
-        case SIN:
-            *ptop = sin(*ptop);
-            break;
-
-        case TAN:
-            *ptop = tan(*ptop);
-            break;
-
-        case COSH:
-            *ptop = cosh(*ptop);
-            break;
-
-        case SINH:
-            *ptop = sinh(*ptop);
-            break;
-
-        case TANH:
-            *ptop = tanh(*ptop);
-            break;
-
-        case CEIL:
-            *ptop = ceil(*ptop);
-            break;
-
-        case FLOOR:
-            *ptop = floor(*ptop);
-            break;
-
-        case FMOD:
-            top = *ptop--;
-            *ptop = fmod(*ptop, top);
-            break;
-
         case FINITE:
-            nargs = *pinst++;
-            top = finite(*ptop);
-            while (--nargs) {
-                --ptop;
-                top = top && finite(*ptop);
-            }
-            *ptop = top;
-            break;
-
-        case ISINF:
-            *ptop = isinf(*ptop);
-            break;
-
         case ISNAN:
             nargs = *pinst++;
-            top = isnan(*ptop);
-            while (--nargs) {
-                --ptop;
-                top = top || isnan(*ptop);
+            /* fall through */
+        default:
+            ptop = calcStackOp(op, nargs, ptop);
+            if (!ptop) {
+                errlogPrintf("calcPerform: Bad Opcode %d at %p\n", op, pinst-1);
+                return -1;
             }
-            *ptop = top;
-            break;
-
-        case NINT:
-            top = *ptop;
-            *ptop = (epicsInt32) (top >= 0 ? top + 0.5 : top - 0.5);
-            break;
-
-        case RANDOM:
-            *++ptop = calcRandom();
-            break;
-
-        case REL_OR:
-            top = *ptop--;
-            *ptop = *ptop || top;
-            break;
-
-        case REL_AND:
-            top = *ptop--;
-            *ptop = *ptop && top;
-            break;
-
-        case REL_NOT:
-            *ptop = ! *ptop;
-            break;
-
-        /* Be VERY careful converting double to int in case bit 31 is set!
-         * Out-of-range errors give very different results on different systems.
-         * Convert negative doubles to signed and positive doubles to unsigned
-         * first to avoid overflows if bit 32 is set.
-         * The result is always signed, values with bit 31 set are negative
-         * to avoid problems when writing the value to signed integer fields
-         * like longout.VAL or ao.RVAL. However unsigned fields may give
-         * problems on some architectures. (Fewer than giving problems with
-         * signed integer. Maybe the conversion functions should handle
-         * overflows better.)
-         */
-        #define d2i(x) ((x)<0?(epicsInt32)(x):(epicsInt32)(epicsUInt32)(x))
-        #define d2ui(x) ((x)<0?(epicsUInt32)(epicsInt32)(x):(epicsUInt32)(x))
-
-        case BIT_OR:
-            top = *ptop--;
-            *ptop = (double)(d2i(*ptop) | d2i(top));
-            break;
-
-        case BIT_AND:
-            top = *ptop--;
-            *ptop = (double)(d2i(*ptop) & d2i(top));
-            break;
-
-        case BIT_EXCL_OR:
-            top = *ptop--;
-            *ptop = (double)(d2i(*ptop) ^ d2i(top));
-            break;
-
-        case BIT_NOT:
-            *ptop = (double)~d2i(*ptop);
             break;
+        }
+    }
 
-        /* In C the shift operators decide on an arithmetic or logical shift
-         * based on whether the integer is signed or unsigned.
-         * With signed integers, a right-shift is arithmetic and will
-         * extend the sign bit into the left-hand end of the value. When used
-         * with unsigned values a logical shift is performed. The
-         * double-casting through signed/unsigned here is important, see above.
-         */
+    /* The stack should now have one item on it, the expression value */
+    if (ptop != stack + 1)
+        return -1;
+    *presult = *ptop;
+    return 0;
+}
 
-        case RIGHT_SHIFT_ARITH:
-            top = *ptop--;
-            *ptop = (double)(d2i(*ptop) >> (d2i(top) & 31));
+/* calcPerformCompiled
+ *
+ * Evaluate an expression compiled by calcCompile()
+ */
+#define CALC_ADD(x, y) ((x) + (y))
+#define CALC_SUB(x, y) ((x) - (y))
+#define CALC_MULT(x, y) ((x) * (y))
+#define CALC_DIV(x, y) ((x) / (y))
+#define CALC_NOT_EQ(x, y) ((x) != (y))
+#define CALC_LESS_THAN(x, y) ((x) < (y))
+#define CALC_LESS_OR_EQ(x, y) ((x) <= (y))
+#define CALC_EQUAL(x, y) ((x) == (y))
+#define CALC_GR_OR_EQ(x, y) ((x) >= (y))
+#define CALC_GR_THAN(x, y) ((x) > (y))
+
+#define CALC_OPERAND_FORMS(OP) \
+        case OP##_ARG: \
+            *ptop = CALC_##OP(*ptop, parg[pc->a]); \
+            break; \
+        case OP##_CONST: \
+            *ptop = CALC_##OP(*ptop, pc->k); \
+            break; \
+        case OP##_ARGS: \
+            *++ptop = CALC_##OP(parg[pc->a], parg[pc->b]); \
             break;
 
-        case LEFT_SHIFT_ARITH:
-            top = *ptop--;
-            *ptop = (double)(d2i(*ptop) << (d2i(top) & 31));
-            break;
+LIBCOM_API long
+    calcPerformCompiled(double *parg, double *presult,
+        const calcCompiled *pcompiled)
+{
+    double stack[CALCPERFORM_STACK+1];  /* zero'th entry not used */
+    double *ptop = stack;               /* stack pointer */
+    const calcInsn *pc;
+    int op;
 
-        case RIGHT_SHIFT_LOGIC:
-            top = *ptop--;
-            *ptop = (double)(d2ui(*ptop) >> (d2ui(top) & 31u));
-            break;
+    for (pc = pcompiled->insn; (op = pc->op) != END_EXPRESSION; pc++) {
+        switch (op) {
 
-        case NOT_EQ:
-            top = *ptop--;
-            *ptop = *ptop != top;
+        case PUSH_CONST:
+            *++ptop = pc->k;
             break;
 
-        case LESS_THAN:
-            top = *ptop--;
-            *ptop = *ptop < top;
+        case PUSH_ARG:
+            *++ptop = parg[pc->a];
             break;
 
-        case LESS_OR_EQ:
-            top = *ptop--;
-            *ptop = *ptop <= top;
+        case FETCH_VAL:
+            *++ptop = *presult;
             break;
 
-        case EQUAL:
-            top = *ptop--;
-            *ptop = *ptop == top;
+        case STORE_ARG:
+            parg[pc->a] = *ptop--;
             break;
 
-        case GR_OR_EQ:
-            top = *ptop--;
-            *ptop = *ptop >= top;
+        case JUMP:
+            pc = pcompiled->insn + pc->jump - 1;
             break;
 
-        case GR_THAN:
-            top = *ptop--;
-            *ptop = *ptop > top;
+        case JUMP_IF_ZERO:
+            if (*ptop-- == 0.0)
+                pc = pcompiled->insn + pc->jump - 1;
             break;
 
-        case COND_IF:
-            if (*ptop-- == 0.0 &&
-                cond_search(&pinst, COND_ELSE)) return -1;
-            break;
+        CALC_OPERAND_FORMS(ADD)
+        CALC_OPERAND_FORMS(SUB)
+        CALC_OPERAND_FORMS(MULT)
+        CALC_OPERAND_FORMS(DIV)
+        CALC_OPERAND_FORMS(NOT_EQ)
+        CALC_OPERAND_FORMS(LESS_THAN)
+        CALC_OPERAND_FORMS(LESS_OR_EQ)
+        CALC_OPERAND_FORMS(EQUAL)
+        CALC_OPERAND_FORMS(GR_OR_EQ)
+        CALC_OPERAND_FORMS(GR_THAN)
 
-        case COND_ELSE:
-            if (cond_search(&pinst, COND_END)) return -1;
+        case MULADD_ARGS:
+            *++ptop = parg[pc->a] * parg[pc->b];
+            *ptop += parg[pc->c];
             break;
 
-        case COND_END:
+        case MULADD_ARGS_CONST:
+            *++ptop = parg[pc->a] * parg[pc->b];
+            *ptop += pc->k;
             break;
 
         default:
-            errlogPrintf("calcPerform: Bad Opcode %d at %p\n", op, pinst-1);
-            return -1;
+            ptop = calcStackOp(op, pc->a, ptop);
+            if (!ptop) {
+                errlogPrintf("calcPerformCompiled: Bad Opcode %d at %p\n",
+                    op, (const void *) pc);
+                return -1;
+            }
+            break;
         }
     }
 
@@ -321,6 +321,55 @@ LIBCOM_API long
 LIBCOM_API long
     calcPerform(double *parg, double *presult, const char *ppostfix);
 
+/** \brief Compiled form of a postfix expression, see calcCompile() */
+typedef struct calcCompiled calcCompiled;
+
+/** \brief Compile a postfix expression for faster evaluation
+ *
+ * Translates the postfix expression into instructions which
+ * calcPerformCompiled() evaluates faster than calcPerform() evaluates the
+ * postfix expression.  Sub-expressions with constant operands are
+ * calculated here, conditionals with a constant condition keep only the
+ * branch that will be taken, and common operations take their operands
+ * straight from the arguments or from a constant.  The results are
+ * the same as those of calcPerform().
+ *
+ * \param ppostfix The postfix expression created by postfix().
+ * \return The compiled expression, to be freed with calcCompiledFree(),
+ * or NULL if the expression could not be compiled.  calcPerform() should be
+ * used in that case, and will report any error in the expression.
+ */
+LIBCOM_API calcCompiled *
+    calcCompile(const char *ppostfix);
+
+/** \brief Run the calculation engine on a compiled expression
+ *
+ * Like calcPerform(), for an expression compiled by calcCompile().
+ * \param parg Pointer to an array of double values for the arguments A-L.
+ * \param presult Where to put the calculated result.
+ * \param pcompiled The expression compiled by calcCompile().
+ * \return Status value 0 for OK, or non-zero if an error is discovered
+ * during the evaluation process.
+ */
+LIBCOM_API long
+    calcPerformCompiled(double *parg, double *presult,
+        const calcCompiled *pcompiled);
+
+/** \brief Free a compiled expression
+ *
+ * \param pcompiled The expression compiled by calcCompile(), may be NULL.
+ */
+LIBCOM_API void
+    calcCompiledFree(calcCompiled *pcompiled);
+
+/** \brief Disassemble a compiled expression
+ *
+ * Print the instructions of a compiled expression to stdout.
+ * \param pcompiled The expression compiled by calcCompile().
+ */
+LIBCOM_API void
+    calcCompiledDump(const calcCompiled *pcompiled);
+
 /** \brief Find the inputs and outputs of an expression
  *
  * Software using the calc subsystem may need to know what expression
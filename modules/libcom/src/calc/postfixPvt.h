@@ -26,6 +26,7 @@
 #ifndef INCpostfixPvth
 #define INCpostfixPvth
 
+#include "epicsTypes.h"
 
 /* RPN opcodes */
 typedef enum {
@@ -104,4 +105,48 @@ typedef enum {
     NOT_GENERATED
 } rpn_opcode;
 
+/* Compiled expressions
+ *
+ * calcCompile() translates RPN into an array of calcInsn.  Operations
+ * on the stack keep their rpn_opcode.  The opcodes below take operands
+ * directly from the arguments A-L (the "registers") or from a constant,
+ * which saves the pushes of those operands.  The ARGS forms push the
+ * result of an operation on two arguments.  Conditionals are jumps.
+ */
+typedef enum {
+    PUSH_CONST = NOT_GENERATED + 1,
+    PUSH_ARG,
+    STORE_ARG,
+    JUMP,
+    JUMP_IF_ZERO,
+    /* Arithmetic and relationals: top op arg, top op const, arg op arg */
+    ADD_ARG, ADD_CONST, ADD_ARGS,
+    SUB_ARG, SUB_CONST, SUB_ARGS,
+    MULT_ARG, MULT_CONST, MULT_ARGS,
+    DIV_ARG, DIV_CONST, DIV_ARGS,
+    NOT_EQ_ARG, NOT_EQ_CONST, NOT_EQ_ARGS,
+    LESS_THAN_ARG, LESS_THAN_CONST, LESS_THAN_ARGS,
+    LESS_OR_EQ_ARG, LESS_OR_EQ_CONST, LESS_OR_EQ_ARGS,
+    EQUAL_ARG, EQUAL_CONST, EQUAL_ARGS,
+    GR_OR_EQ_ARG, GR_OR_EQ_CONST, GR_OR_EQ_ARGS,
+    GR_THAN_ARG, GR_THAN_CONST, GR_THAN_ARGS,
+    /* a*b+c and a*b+const */
+    MULADD_ARGS, MULADD_ARGS_CONST,
+    CALC_INSN_LAST
+} calc_insn_opcode;
+
+typedef struct calcInsn {
+    unsigned char op;       /* rpn_opcode or calc_insn_opcode */
+    unsigned char a;        /* argument index or number of var-args */
+    unsigned char b;        /* second argument index */
+    unsigned char c;        /* third argument index */
+    epicsInt32 jump;        /* index of the next instruction if taken */
+    double k;               /* constant operand */
+} calcInsn;
+
+struct calcCompiled {
+    unsigned int ninsn;
+    calcInsn insn[1];       /* ninsn entries, the last is END_EXPRESSION */
+};
+
 #endif /* INCpostfixPvth */
@@ -21,6 +21,8 @@
 #include "epicsMath.h"
 #include "epicsStdio.h"
 
+static size_t UInt32ToDec(epicsUInt32 val, char *pdest);
+
 /*
  * These routines convert numbers up to +/- 10,000,000.
  * They defer to sprintf() for numbers requiring more than
@@ -29,6 +31,39 @@
 static epicsInt32 frac_multiplier[] =
     {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
 
+/*
+ * Two decimal digits at a time halves the number of divisions.
+ */
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* Writes exactly ndigits digits of val, with leading zeros */
+static void
+    fixedToDec(epicsUInt32 val, char *pdest, int ndigits)
+{
+    char *pend = pdest + ndigits;
+
+    while (ndigits >= 2) {
+        epicsUInt32 hundredth = val / 100;
+
+        pend -= 2;
+        memcpy(pend, &digit_pairs[2 * (val - hundredth * 100)], 2);
+        val = hundredth;
+        ndigits -= 2;
+    }
+    if (ndigits)
+        pend[-1] = (char) (val % 10 + '0');
+}
+
 int cvtFloatToString(float flt_value, char *pdest,
     epicsUInt16 precision)
 {
@@ -108,29 +143,17 @@ int cvtFloatToString(float flt_value, char *pdest,
     return((int)(pdest - startAddr));
 }
 
-int cvtDoubleToString(
-    double flt_value,
-    char  *pdest,
-    epicsUInt16 precision)
+/* Can doubleToFixed() handle this conversion? */
+#define DOUBLE_FIXED_OK(val, precision) \
+    (!isnan(val) && (precision) <= 8 && \
+     (val) <= 10000000.0 && (val) >= -10000000.0)
+
+static int
+    doubleToFixed(double flt_value, char *pdest, epicsUInt16 precision)
 {
-    epicsUInt16 got_one,i;
-    epicsInt32  whole,iplace,number,fraction,fplace;
+    epicsInt32  whole,fraction,fplace;
     double      ftemp;
-    char        *startAddr;
-
-    /* can this routine handle this conversion */
-    if (isnan(flt_value) || precision > 8 || flt_value > 10000000.0 || flt_value < -10000000.0) {
-        if (precision > 8 || flt_value > 1e16 || flt_value < -1e16) {
-            if(precision>17) precision=17;
-            sprintf(pdest,"%*.*e",precision+7,precision,
-            flt_value);
-        } else {
-            if(precision>3) precision=3;
-            sprintf(pdest,"%.*f",precision,flt_value);
-        }
-        return((int)strlen(pdest));
-    }
-    startAddr = pdest;
+    char        *startAddr = pdest;
 
     /* determine the sign */
     if (flt_value < 0){
@@ -154,40 +177,62 @@ int cvtDoubleToString(
     }
 
     /* whole numbers */
-    got_one = 0;
-    for (iplace = 10000000; iplace >= 1; iplace /= 10){
-        if (whole >= iplace){
-            got_one = 1;
-            number = whole / iplace;
-            whole = whole - (number * iplace);
-            *pdest = number + '0';
-            pdest++;
-        }else if (got_one){
-            *pdest = '0';
-            pdest++;
-        }
-    }
-    if (!got_one){
-        *pdest = '0';
-        pdest++;
-    }
+    if (whole)
+        pdest += UInt32ToDec(whole, pdest);
+    else
+        *pdest++ = '0';
 
     /* fraction */
     if (precision > 0){
-    /* convert fractional portion to ASCII */
-        *pdest = '.';
-        pdest++;
-        for (fplace /= 10, i = precision; i > 0; fplace /= 10,i--){
-            number = fraction / fplace;
-            fraction -= number * fplace;
-            *pdest = number + '0';
-            pdest++;
-        }
+        *pdest++ = '.';
+        fixedToDec(fraction, pdest, precision);
+        pdest += precision;
     }
     *pdest = 0;
 
     return((int)(pdest - startAddr));
 }
+
+static int
+    doubleToSprintf(double flt_value, char *pdest, epicsUInt16 precision)
+{
+    if (precision > 8 || flt_value > 1e16 || flt_value < -1e16) {
+        if(precision>17) precision=17;
+        sprintf(pdest,"%*.*e",precision+7,precision,
+        flt_value);
+    } else {
+        if(precision>3) precision=3;
+        sprintf(pdest,"%.*f",precision,flt_value);
+    }
+    return((int)strlen(pdest));
+}
+
+int cvtDoubleToString(
+    double flt_value,
+    char  *pdest,
+    epicsUInt16 precision)
+{
+    /* can this routine handle this conversion */
+    if (!DOUBLE_FIXED_OK(flt_value, precision))
+        return doubleToSprintf(flt_value, pdest, precision);
+
+    return doubleToFixed(flt_value, pdest, precision);
+}
+
+void cvtDoubleArrayToStrings(const double *pval, size_t count,
+    char *pdest, size_t stride, epicsUInt16 precision)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, pdest += stride) {
+        double val = pval[i];
+
+        if (DOUBLE_FIXED_OK(val, precision))
+            doubleToFixed(val, pdest, precision);
+        else
+            doubleToSprintf(val, pdest, precision);
+    }
+}
 
 /*
  * These routines are provided for backwards compatibility,
@@ -257,22 +302,28 @@ int cvtDoubleToCompactString(double val, char *pdest, epicsUInt16 precision)
 static size_t
     UInt32ToDec(epicsUInt32 val, char *pdest)
 {
-    int i;
     char digit[10];
+    char *pfirst = digit + sizeof(digit);
     size_t len;
 
-    for (i = 0; val; i++) {
-        epicsUInt32 tenth = val / 10;
+    while (val >= 100) {
+        epicsUInt32 hundredth = val / 100;
 
-        digit[i] = val - tenth * 10 + '0';
-        val = tenth;
+        pfirst -= 2;
+        memcpy(pfirst, &digit_pairs[2 * (val - hundredth * 100)], 2);
+        val = hundredth;
     }
-    len = i;
-
-    while (i > 0)
-        *pdest++ = digit[--i];
+    if (val >= 10) {
+        pfirst -= 2;
+        memcpy(pfirst, &digit_pairs[2 * val], 2);
+    }
+    else if (val) {
+        *--pfirst = (char) (val + '0');
+    }
+    len = digit + sizeof(digit) - pfirst;
 
-    *pdest = 0;
+    memcpy(pdest, pfirst, len);
+    pdest[len] = 0;
     return len;
 }
 
@@ -380,6 +431,30 @@ size_t
     return 1 + UInt32ToDec(-val, pdest);
 }
 
+void
+    cvtInt32ArrayToStrings(const epicsInt32 *pval, size_t count,
+        char *pdest, size_t stride)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, pdest += stride) {
+        epicsInt32 val = pval[i];
+
+        if (val > 0) {
+            UInt32ToDec(val, pdest);
+        }
+        else if (val < 0) {
+            /* also right for -0x80000000 */
+            *pdest = '-';
+            UInt32ToDec(0u - (epicsUInt32) val, pdest + 1);
+        }
+        else {
+            pdest[0] = '0';
+            pdest[1] = 0;
+        }
+    }
+}
+
 
 size_t
     cvtUInt64ToString(epicsUInt64 val, char *pdest)
@@ -66,6 +66,29 @@ LIBCOM_API size_t
 LIBCOM_API size_t
     cvtUInt64ToHexString(epicsUInt64 val, char *pdest);
 
+/** \brief Convert an array of doubles to strings
+ *
+ * Each string is written as by cvtDoubleToString(), the first at \p pdest and
+ * each following one \p stride characters after the previous one.
+ * \p stride must be at least the longest string plus its nul;
+ * MAX_STRING_SIZE is always enough.
+ * Conversions that cvtDoubleToString() hands to sprintf() are still done
+ * that way, the rest avoid the per-call overheads.
+ * \since UNRELEASED
+ */
+LIBCOM_API void
+    cvtDoubleArrayToStrings(const double *pval, size_t count,
+        char *pdest, size_t stride, epicsUInt16 prec);
+/** \brief Convert an array of epicsInt32 to strings
+ *
+ * Each string is written as by cvtInt32ToString(), laid out as for
+ * cvtDoubleArrayToStrings().
+ * \since UNRELEASED
+ */
+LIBCOM_API void
+    cvtInt32ArrayToStrings(const epicsInt32 *pval, size_t count,
+        char *pdest, size_t stride);
+
 /* Support the original names */
 
 #define cvtCharToString(val, str) cvtInt32ToString(val, str)
@@ -51,6 +51,14 @@
 //
 // 3) Setting N to zero causes the free list to be bypassed
 //
+// 4) tsThreadFreeList < T, N > has the same interface, but keeps a few free
+// items for each thread which uses it so that most calls don't take a lock.
+// Surplus items are returned to the shared list in batches. Use it instead
+// of a tsFreeList with a real mutex when several threads allocate or
+// release. The per thread caches are only used if N is at least 16, and
+// only by threads created with epicsThreadCreate(), which return their
+// cached items when they exit. Other threads always use the shared list.
+//
 
 #ifdef EPICS_FREELIST_DEBUG
 #   define tsFreeListDebugBypass 1
@@ -68,6 +76,7 @@
 #include "compilerDependencies.h"
 #include "epicsMutex.h"
 #include "epicsGuard.h"
+#include "freeList.h"
 
 // ms visual studio 6.0 and before incorrectly
 // warn about a missing delete operator if only the
@@ -188,4 +197,71 @@ void tsFreeList < T, N, MUTEX >::release ( void * pCadaver )
     }
 }
 
+template < class T, unsigned N = 0x400 >
+class tsThreadFreeList {
+public:
+    tsThreadFreeList ();
+    ~tsThreadFreeList ();
+    void * allocate ( size_t size );
+    void release ( void * p );
+    void release ( void * p, size_t size );
+private:
+    void * pFreeListPvt;
+    tsThreadFreeList ( const tsThreadFreeList & );
+    tsThreadFreeList & operator = ( const tsThreadFreeList & );
+};
+
+template < class T, unsigned N >
+inline tsThreadFreeList < T, N > :: tsThreadFreeList () :
+    pFreeListPvt ( 0 )
+{
+    // freeListLib provides the per thread caches
+    freeListInitPvt ( & this->pFreeListPvt, sizeof ( T ),
+        tsFreeListDebugBypass ? 0 : N );
+}
+
+template < class T, unsigned N >
+inline tsThreadFreeList < T, N > :: ~tsThreadFreeList ()
+{
+    freeListCleanup ( this->pFreeListPvt );
+}
+
+template < class T, unsigned N >
+inline void * tsThreadFreeList < T, N >::allocate ( size_t size )
+{
+    void * p;
+    if ( size != sizeof ( T ) ) {
+        p = ::operator new ( size );
+    }
+    else {
+        p = freeListMalloc ( this->pFreeListPvt );
+        if ( ! p ) {
+            throw std::bad_alloc ();
+        }
+    }
+    tsFreeListMemSetNew ( p, size );
+    return p;
+}
+
+template < class T, unsigned N >
+inline void tsThreadFreeList < T, N >::release ( void * pCadaver, size_t size )
+{
+    if ( size != sizeof ( T ) ) {
+        tsFreeListMemSetDelete ( pCadaver, size );
+        ::operator delete ( pCadaver );
+    }
+    else {
+        this->release ( pCadaver );
+    }
+}
+
+template < class T, unsigned N >
+inline void tsThreadFreeList < T, N >::release ( void * pCadaver )
+{
+    if ( pCadaver ) {
+        tsFreeListMemSetDelete ( pCadaver, sizeof ( T ) );
+        freeListFree ( this->pFreeListPvt, pCadaver );
+    }
+}
+
 #endif // tsFreeList_h
@@ -38,6 +38,8 @@
 #include "errlog.h"
 #include "epicsStdio.h"
 #include "epicsExit.h"
+#include "epicsAtomic.h"
+#include "epicsTime.h"
 #include "osiUnistd.h"
 
 
@@ -45,8 +47,13 @@
 #define MIN_MESSAGE_SIZE 256
 #define MAX_MESSAGE_SIZE 0x00ffffff
 
-/* errlog buffers contain null terminated strings, each prefixed
- * with a 1 byte header containing flags.
+/* Each thread which logs has its own staging ring.  Only that thread
+ * adds entries and only errlogThread removes them, so logging takes no
+ * lock.  Threads which don't run epicsAtThreadExit() routines would never
+ * give a ring back, so they share pvt.shared under pvt.sharedLock.  An entry is an entryHdr, a 1 byte header containing flags and
+ * a null terminated string.  Entries don't wrap around the end of a ring:
+ * when less than pvt.entryMax bytes are left there, the next entry starts
+ * at the beginning.
  */
 /* State of entries in a buffer. */
 #define ERL_STATE_MASK  0xc0
@@ -56,6 +63,25 @@
 /* should this message be echoed to the console? */
 #define ERL_LOCALECHO   0x20
 
+#define ENTRY_ALIGN(n) (((n) + sizeof(size_t) - 1u) & ~(sizeof(size_t) - 1u))
+
+/* Call sites tracked by each thread for rate limiting,
+ * in sets of RATE_WAYS slots selected by the site address */
+#define RATE_SLOTS 16
+#define RATE_WAYS 4
+
+/* The return address of an errlog routine tells its call sites apart,
+ * even those which pass the same format string.
+ */
+#if defined(__GNUC__)
+#  define ERRLOG_CALLER() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define ERRLOG_CALLER() _ReturnAddress()
+#else
+#  define ERRLOG_CALLER() NULL
+#endif
+
 /*Declare storage for errVerbose */
 int errVerbose = 0;
 
@@ -71,21 +97,65 @@ typedef struct listenerNode{
 } listenerNode;
 
 typedef struct {
+    size_t len;     /* of the whole entry */
+    size_t seq;     /* orders the entries of all threads */
+} entryHdr;
+
+typedef struct {
+    /* the call site, with its format string */
+    const void *caller;
+    const char *format;
+    epicsUInt64 start;  /* of the current interval */
+    unsigned count;
+    size_t suppressed;
+    char like[40];      /* escaped format or message, for the report */
+} rateSlot;
+
+typedef struct stageRing {
+    struct stageRing *next;
     char *base;
-    size_t pos;
-} buffer_t;
+
+    /* written by the owning thread */
+    size_t head;
+    size_t nLost;
+    size_t pending;     /* position of the entry being written */
+    rateSlot rate[RATE_SLOTS];
+
+    /* written by errlogThread */
+    size_t tail;
+    size_t limit;       /* head when the current pass started */
+    size_t nLostSeen;
+
+    int exited;
+} stageRing;
 
 static struct {
     /* const after errlogInit() */
     size_t maxMsgSize;
-    /* alloc size of both buffer_t::base */
+    /* alloc size of each stageRing::base */
     size_t bufSize;
+    /* space reserved for writing an entry */
+    size_t entryMax;
+    epicsThreadPrivateId ringId;
     int    errlogInitFailed;
 
+    /* pushed by new threads, unlinked by errlogThread */
+    stageRing *rings;
+    /* for threads without a ring of their own, always on rings */
+    stageRing *shared;
+    epicsMutexId sharedLock;
+    size_t msgSeq;
+    /* set when errlogThread has been woken up */
+    int workPending;
+    /* messages per second and call site, or 0 */
+    int rateLimit;
+    /* messages which could not get a ring */
+    size_t nLost;
+
     epicsMutexId listenerLock;
     ELLLIST      listenerList;
 
-    /* notify when log->size!=0 */
+    /* notify when a ring is not empty */
     epicsEventId waitForWork;
     /* signals when worker increments flushSeq */
     epicsEventId waitForSeq;
@@ -101,53 +171,80 @@ static struct {
     /* A loop counter maintained by errlogThread. */
     epicsUInt32 flushSeq;
     size_t nFlushers;
-    size_t nLost;
-
-    /* 'log' and 'print' combine to form a double buffer. */
-    buffer_t *log;
-    buffer_t *print;
-
-    /* actual storage which 'log' and 'print' point to */
-    buffer_t bufs[2];
 } pvt;
 
-/* Returns an pointer to pvt.maxMsgSize bytes, or NULL if ring buffer is full.
- * When !NULL, caller _must_ later msgbufCommit()
- */
-static
-char* msgbufAlloc(void)
+static void ringExit(void *raw)
 {
-    char *ret = NULL;
+    stageRing *ring = raw;
 
-    if (epicsInterruptIsInterruptContext()) {
-        epicsInterruptContextMessage
-            ("errlog called from interrupt level\n");
-        return ret;
-    }
+    /* errlogThread frees the ring once it is empty.
+     * Later messages from this thread get a new ring.
+     */
+    epicsThreadPrivateSet(pvt.ringId, NULL);
+    epicsAtomicSetIntT(&ring->exited, 1);
+}
 
-    errlogInit(0);
-    epicsMutexMustLock(pvt.msgQueueLock); /* matched in msgbufCommit() */
-    if(pvt.bufSize - pvt.log->pos >= 1+pvt.maxMsgSize) {
-        /* there is enough space for the worst cast */
-        ret = pvt.log->base + pvt.log->pos;
-        ret[0] = ERL_STATE_WRITE;
-        ret++;
+/* Returns the staging ring of the calling thread, allocated on first use */
+static
+stageRing* ringSelf(void)
+{
+    stageRing *ring = epicsThreadPrivateGet(pvt.ringId);
+    stageRing *head;
+
+    if(ring)
+        return ring;
+    if(!epicsAtThreadExitRuns())
+        return pvt.shared;
+
+    ring = calloc(1, sizeof(*ring));
+    if(ring)
+        ring->base = malloc(pvt.bufSize);
+    if(!ring || !ring->base || epicsAtThreadExit(ringExit, ring)) {
+        if(ring)
+            free(ring->base);
+        free(ring);
+        return NULL;
     }
+    epicsThreadPrivateSet(pvt.ringId, ring);
+
+    do {
+        head = epicsAtomicGetPtrT((EpicsAtomicPtrT*)&pvt.rings);
+        ring->next = head;
+    } while(epicsAtomicCmpAndSwapPtrT((EpicsAtomicPtrT*)&pvt.rings,
+                                      head, ring) != head);
+    return ring;
+}
 
-    if(!ret) {
-        pvt.nLost++;
-        epicsMutexUnlock(pvt.msgQueueLock);
+/* Returns a pointer to pvt.maxMsgSize bytes, or NULL if the ring is full.
+ * When !NULL, caller _must_ later msgbufCommit()
+ */
+static
+char* stageAlloc(stageRing *ring)
+{
+    size_t pos = ring->head;
+    size_t tail = epicsAtomicGetSizeT(&ring->tail);
+    size_t left = pvt.bufSize - pos % pvt.bufSize;
+
+    /* don't overwrite an entry before errlogThread is done with it */
+    epicsAtomicReadMemoryBarrier();
+
+    if(left < pvt.entryMax)
+        pos += left;
+    if(pos + pvt.entryMax - tail > pvt.bufSize) {
+        ring->nLost++;
+        return NULL;
     }
-    return ret;
+    ring->pending = pos;
+    return ring->base + pos % pvt.bufSize + sizeof(entryHdr) + 1u;
 }
 
 static
-size_t msgbufCommit(size_t nchar, int localEcho)
+size_t stageCommit(stageRing *ring, size_t nchar, int localEcho)
 {
     int isOkToBlock = epicsThreadIsOkToBlock();
-    int wasEmpty = pvt.log->pos==0;
     int atExit = pvt.atExit;
-    char *start = pvt.log->base + pvt.log->pos;
+    entryHdr *hdr = (entryHdr*)(ring->base + ring->pending % pvt.bufSize);
+    char *start = (char*)(hdr + 1);
 
     /* nchar returned by snprintf() is >= maxMsgSize when truncated */
     if(nchar >= pvt.maxMsgSize) {
@@ -162,30 +259,144 @@ size_t msgbufCommit(size_t nchar, int localEcho)
 
     if(localEcho && isOkToBlock && atExit) {
         /* errlogThread is not running, so we print directly
-         * and then abandon the buffer.
+         * and then abandon the entry.
          */
-        fprintf(pvt.console, "%s", start);
+        fprintf(pvt.console, "%s", start + 1u);
 
     } else if(!atExit) {
         start[0u] = ERL_STATE_READY | (localEcho ? ERL_LOCALECHO : 0);
+        hdr->len = ENTRY_ALIGN(sizeof(entryHdr) + 1u + nchar + 1u);
+        hdr->seq = epicsAtomicIncrSizeT(&pvt.msgSeq);
 
-        pvt.log->pos += 1u + nchar + 1u;
+        epicsAtomicWriteMemoryBarrier();
+        epicsAtomicSetSizeT(&ring->head, ring->pending + hdr->len);
+
+        /* only the first message of a batch wakes up errlogThread */
+        if(epicsAtomicCmpAndSwapIntT(&pvt.workPending, 0, 1) == 0)
+            epicsEventMustTrigger(pvt.waitForWork);
 
     } else {
         /* listeners will not see messages logged during errlog shutdown */
     }
 
-    epicsMutexUnlock(pvt.msgQueueLock); /* matched in msgbufAlloc() */
+    return nchar;
+}
 
-    if(wasEmpty && !atExit)
-        epicsEventMustTrigger(pvt.waitForWork);
+static
+size_t msgbufCommit(stageRing *ring, size_t nchar, int localEcho)
+{
+    nchar = stageCommit(ring, nchar, localEcho);
 
-    if(localEcho && isOkToBlock && !atExit)
+    if(ring == pvt.shared)
+        epicsMutexUnlock(pvt.sharedLock);
+
+    if(localEcho && epicsThreadIsOkToBlock() && !pvt.atExit)
         errlogFlush();
 
     return nchar;
 }
 
+static
+void rateReport(stageRing *ring, rateSlot *slot)
+{
+    char *buf = stageAlloc(ring);
+
+    if(buf) {
+        int nchar = epicsSnprintf(buf, pvt.maxMsgSize,
+                                  "errlog: suppressed %zu messages like \"%s\"\n",
+                                  slot->suppressed, slot->like);
+        stageCommit(ring, nchar, pvt.toConsole);
+    }
+}
+
+/* Returns 0 if the call site, the caller together with the format, has
+ * already logged pvt.rateLimit messages during the last second.  The
+ * report of suppressed messages shows text.
+ */
+static
+int rateCheck(stageRing *ring, const void *caller, const char *format,
+              const char *text)
+{
+    int limit = pvt.rateLimit;
+    rateSlot *set, *slot;
+    epicsUInt64 now;
+    size_t hash;
+    int i;
+
+    if(limit <= 0 || !format)
+        return 1;
+
+    now = epicsMonotonicGet();
+    hash = ((size_t)caller ^ (size_t)format) >> 3;
+    set = &ring->rate[(hash % (RATE_SLOTS / RATE_WAYS)) * RATE_WAYS];
+    slot = NULL;
+    for(i = 0; i < RATE_WAYS; i++) {
+        if(set[i].caller == caller && set[i].format == format) {
+            slot = &set[i];
+            break;
+        }
+    }
+    if(!slot) {
+        /* replace the slot whose interval started first */
+        slot = set;
+        for(i = 1; i < RATE_WAYS && slot->format; i++) {
+            if(!set[i].format || set[i].start < slot->start)
+                slot = &set[i];
+        }
+    }
+    if(slot->caller != caller || slot->format != format ||
+            now - slot->start >= 1000000000u) {
+        if(slot->suppressed)
+            rateReport(ring, slot);
+        if(slot->format != format || slot->caller != caller)
+            epicsStrnEscapedFromRaw(slot->like, sizeof(slot->like), text,
+                                    strlen(text));
+        slot->caller = caller;
+        slot->format = format;
+        slot->start = now;
+        slot->count = 0u;
+        slot->suppressed = 0u;
+    }
+    if(++slot->count <= (unsigned)limit)
+        return 1;
+    slot->suppressed++;
+    return 0;
+}
+
+/* Returns a pointer to pvt.maxMsgSize bytes in the ring of the calling
+ * thread, or NULL if the message is dropped.
+ * When !NULL, caller _must_ later msgbufCommit(*pring, ...)
+ */
+static
+char* msgbufAlloc(const void *caller, const char *format, const char *text,
+                  stageRing **pring)
+{
+    stageRing *ring;
+    char *buf;
+
+    if (epicsInterruptIsInterruptContext()) {
+        epicsInterruptContextMessage
+            ("errlog called from interrupt level\n");
+        return NULL;
+    }
+
+    errlogInit(0);
+    ring = ringSelf();
+    if(!ring) {
+        epicsAtomicIncrSizeT(&pvt.nLost);
+        return NULL;
+    }
+    if(ring == pvt.shared)
+        epicsMutexMustLock(pvt.sharedLock);
+
+    buf = rateCheck(ring, caller, format, text) ? stageAlloc(ring) : NULL;
+    if(!buf && ring == pvt.shared)
+        epicsMutexUnlock(pvt.sharedLock);
+
+    *pring = ring;
+    return buf;
+}
+
 static
 void errlogSequence(void)
 {
@@ -312,31 +523,65 @@ void errlogStripANSI(char *msg)
     }
 }
 
+/* The routines below pass the return address of the public entry point
+ * which the application called to these.
+ */
+static
+int vprintfSite(const void *caller, int console, const char *pFormat,
+                va_list pvar)
+{
+    int nchar = 0;
+    stageRing *ring = NULL;
+    char *buf = msgbufAlloc(caller, pFormat, pFormat, &ring);
+
+    if(buf) {
+        nchar = epicsVsnprintf(buf, pvt.maxMsgSize, pFormat, pvar);
+        nchar = msgbufCommit(ring, nchar, console && pvt.toConsole);
+    }
+    return nchar;
+}
+
+static
+int sevVprintfSite(const void *caller, errlogSevEnum severity,
+                   const char *pFormat, va_list pvar)
+{
+    int nchar = 0;
+    stageRing *ring = NULL;
+    char *buf = msgbufAlloc(caller, pFormat, pFormat, &ring);
+
+    if(buf) {
+        nchar = sprintf(buf, "sevr=%s ", errlogGetSevEnumString(severity));
+        if(nchar < pvt.maxMsgSize)
+            nchar += epicsVsnprintf(buf + nchar, pvt.maxMsgSize - nchar, pFormat, pvar);
+        nchar = msgbufCommit(ring, nchar, pvt.toConsole);
+    }
+    return nchar;
+}
+
 int errlogPrintf(const char *pFormat, ...)
 {
     int ret;
     va_list args;
     va_start(args, pFormat);
-    ret = errlogVprintf(pFormat, args);
+    ret = vprintfSite(ERRLOG_CALLER(), 1, pFormat, args);
     va_end(args);
     return ret;
 }
 
 int errlogVprintf(const char *pFormat,va_list pvar)
 {
-    int nchar = 0;
-    char *buf = msgbufAlloc();
-
-    if(buf) {
-        nchar = epicsVsnprintf(buf, pvt.maxMsgSize, pFormat, pvar);
-        nchar = msgbufCommit(nchar, pvt.toConsole);
-    }
-    return nchar;
+    return vprintfSite(ERRLOG_CALLER(), 1, pFormat, pvar);
 }
 
 int errlogMessage(const char *message)
 {
-    errlogPrintf("%s", message);
+    stageRing *ring = NULL;
+    char *buf = msgbufAlloc(ERRLOG_CALLER(), "%s", message, &ring);
+
+    if(buf) {
+        int nchar = epicsSnprintf(buf, pvt.maxMsgSize, "%s", message);
+        msgbufCommit(ring, nchar, pvt.toConsole);
+    }
     return 0;
 }
 
@@ -345,21 +590,14 @@ int errlogPrintfNoConsole(const char *pFormat, ...)
     va_list pvar;
     int nchar;
     va_start(pvar, pFormat);
-    nchar = errlogVprintfNoConsole(pFormat, pvar);
+    nchar = vprintfSite(ERRLOG_CALLER(), 0, pFormat, pvar);
     va_end(pvar);
     return nchar;
 }
 
 int errlogVprintfNoConsole(const char *pFormat, va_list pvar)
 {
-    int nchar = 0;
-    char *buf = msgbufAlloc();
-
-    if(buf) {
-        nchar = epicsVsnprintf(buf, pvt.maxMsgSize, pFormat, pvar);
-        nchar = msgbufCommit(nchar, 0);
-    }
-    return nchar;
+    return vprintfSite(ERRLOG_CALLER(), 0, pFormat, pvar);
 }
 
 
@@ -368,23 +606,14 @@ int errlogSevPrintf(errlogSevEnum severity, const char *pFormat, ...)
     va_list pvar;
     int nchar;
     va_start(pvar, pFormat);
-    nchar = errlogSevVprintf(severity, pFormat, pvar);
+    nchar = sevVprintfSite(ERRLOG_CALLER(), severity, pFormat, pvar);
     va_end(pvar);
     return nchar;
 }
 
 int errlogSevVprintf(errlogSevEnum severity, const char *pFormat, va_list pvar)
 {
-    int nchar = 0;
-    char *buf = msgbufAlloc();
-
-    if(buf) {
-        nchar = sprintf(buf, "sevr=%s ", errlogGetSevEnumString(severity));
-        if(nchar < pvt.maxMsgSize)
-            nchar += epicsVsnprintf(buf + nchar, pvt.maxMsgSize - nchar, pFormat, pvar);
-        nchar = msgbufCommit(nchar, pvt.toConsole);
-    }
-    return nchar;
+    return sevVprintfSite(ERRLOG_CALLER(), severity, pFormat, pvar);
 }
 
 
@@ -484,12 +713,19 @@ int errlogSetConsole(FILE *stream)
     return 0;
 }
 
+void errlogSetRateLimit(int maxPerSecond)
+{
+    errlogInit(0);
+    epicsAtomicSetIntT(&pvt.rateLimit, maxPerSecond > 0 ? maxPerSecond : 0);
+}
+
 void errPrintf(long status, const char *pFileName, int lineno,
     const char *pformat, ...)
 {
     va_list pvar;
     int     nchar = 0;
-    char *buf = msgbufAlloc();
+    stageRing *ring = NULL;
+    char *buf = msgbufAlloc(ERRLOG_CALLER(), pformat, pformat, &ring);
 
     va_start(pvar, pformat);
 
@@ -504,7 +740,7 @@ void errPrintf(long status, const char *pFileName, int lineno,
                               name, status ? " " : "", pFileName, lineno);
         if(nchar < pvt.maxMsgSize)
             nchar += epicsVsnprintf(buf + nchar, pvt.maxMsgSize - nchar, pformat, pvar);
-        msgbufCommit(nchar, pvt.toConsole);
+        msgbufCommit(ring, nchar, pvt.toConsole);
     }
 
     va_end(pvar);
@@ -547,8 +783,9 @@ static void errlogInitPvt(void *arg)
      */
 
     pvt.errlogInitFailed = TRUE;
-    pvt.bufSize = pconfig->bufsize;
+    pvt.bufSize = ENTRY_ALIGN(pconfig->bufsize);
     pvt.maxMsgSize = pconfig->maxMsgSize;
+    pvt.entryMax = ENTRY_ALIGN(sizeof(entryHdr) + 1u + pvt.maxMsgSize);
     ellInit(&pvt.listenerList);
     pvt.toConsole = TRUE;
     pvt.console = stderr;
@@ -557,10 +794,17 @@ static void errlogInitPvt(void *arg)
     pvt.listenerLock = epicsMutexCreate();
     pvt.msgQueueLock = epicsMutexCreate();
     pvt.waitForSeq = epicsEventCreate(epicsEventEmpty);
-    pvt.log = &pvt.bufs[0];
-    pvt.print = &pvt.bufs[1];
-    pvt.log->base = calloc(1, pvt.bufSize);
-    pvt.print->base = calloc(1, pvt.bufSize);
+    pvt.ringId = epicsThreadPrivateCreate();
+    pvt.sharedLock = epicsMutexCreate();
+    pvt.shared = calloc(1, sizeof(*pvt.shared));
+    if(pvt.shared) {
+        pvt.shared->base = malloc(pvt.bufSize);
+        if(!pvt.shared->base) {
+            free(pvt.shared);
+            pvt.shared = NULL;
+        }
+    }
+    pvt.rings = pvt.shared;
 
     errSymBld();    /* Better not to do this lazily... */
 
@@ -568,8 +812,9 @@ static void errlogInitPvt(void *arg)
             && pvt.listenerLock
             && pvt.msgQueueLock
             && pvt.waitForSeq
-            && pvt.log->base
-            && pvt.print->base
+            && pvt.ringId
+            && pvt.sharedLock
+            && pvt.shared
             ) {
         tid = epicsThreadCreateOpt("errlog", (EPICSTHREADFUNC)errlogThread, 0, &topts);
     }
@@ -621,99 +866,158 @@ void errlogFlush(void)
     errlogSequence();
 }
 
-static void errlogThread(void)
+static void errlogHandleMessage(char *base, FILE *console, int ttyConsole)
 {
-    int wakeFlusher;
-    epicsMutexMustLock(pvt.msgQueueLock);
-    while (1) {
-        pvt.flushSeq++;
+    listenerNode *plistenerNode;
+    int stripped = 0;
 
-        if(pvt.log->pos==0u) {
-            if(pvt.atExit)
-                break;
-            wakeFlusher = pvt.nFlushers!=0;
-            epicsMutexUnlock(pvt.msgQueueLock);
-            if(wakeFlusher)
-                epicsEventMustTrigger(pvt.waitForSeq);
-            epicsEventMustWait(pvt.waitForWork);
-            epicsMutexMustLock(pvt.msgQueueLock);
+    if((base[0]&ERL_STATE_MASK) != ERL_STATE_READY) {
+        fprintf(stderr, "Logic Error: errlog buffer corruption. %02x\n",
+                (unsigned)base[0]);
+        return;
+    }
 
-        } else {
-            /* snapshot and swap buffers for use while unlocked */
-            size_t nLost = pvt.nLost;
-            FILE *console = pvt.toConsole ? pvt.console : NULL;
-            int ttyConsole = pvt.ttyConsole;
-            size_t pos = 0u;
-            buffer_t *print;
-
-            {
-                buffer_t *temp = pvt.log;
-                pvt.log = pvt.print;
-                pvt.print = print = temp;
-            }
+    if(base[0]&ERL_LOCALECHO && console) {
+        if(!ttyConsole) {
+            errlogStripANSI(base+1u);
+            stripped = 1;
+        }
+        fprintf(console, "%s", base+1u);
+    }
 
-            pvt.nLost = 0u;
-            epicsMutexUnlock(pvt.msgQueueLock);
+    if(!stripped)
+        errlogStripANSI(base+1u);
 
-            while(pos < print->pos) {
-                listenerNode *plistenerNode;
-                char* base = print->base + pos;
-                size_t mlen = epicsStrnLen(base+1u, pvt.bufSize - pos);
-                int stripped = 0;
+    epicsMutexMustLock(pvt.listenerLock);
+    plistenerNode = (listenerNode *)ellFirst(&pvt.listenerList);
+    while (plistenerNode) {
+        listenerNode *next;
 
-                if((base[0]&ERL_STATE_MASK) != ERL_STATE_READY || mlen>=pvt.bufSize - pos) {
-                    fprintf(stderr, "Logic Error: errlog buffer corruption. %02x, %zu\n",
-                            (unsigned)base[0], mlen);
-                    /* try to reset and recover */
-                    break;
-                }
+        plistenerNode->active = 1;
+        (*plistenerNode->listener)(plistenerNode->pPrivate, base+1u);
+        plistenerNode->active = 0;
 
-                if(base[0]&ERL_LOCALECHO && console) {
-                    if(!ttyConsole) {
-                        errlogStripANSI(base+1u);
-                        stripped = 1;
-                    }
-                    fprintf(console, "%s", base+1u);
-                }
+        next = (listenerNode *)ellNext(&plistenerNode->node);
+        if(plistenerNode->removed) {
+            /* listener() called errlogRemoveListeners() */
+            ellDelete(&pvt.listenerList, &plistenerNode->node);
+            free(plistenerNode);
+        }
+        plistenerNode = next;
+    }
+    epicsMutexUnlock(pvt.listenerLock);
+}
 
-                if(!stripped)
-                    errlogStripANSI(base+1u);
+/* Handle the messages which all threads had logged when the pass started,
+ * in the order they were logged.  Returns the number of messages.
+ */
+static size_t errlogDrain(FILE *console, int ttyConsole, size_t *pnLost)
+{
+    stageRing *first, *ring, *prev;
+    size_t nDone = 0u;
+    size_t nLost = epicsAtomicGetSizeT(&pvt.nLost);
 
-                epicsMutexMustLock(pvt.listenerLock);
-                plistenerNode = (listenerNode *)ellFirst(&pvt.listenerList);
-                while (plistenerNode) {
-                    listenerNode *next;
+    if(nLost)
+        epicsAtomicSubSizeT(&pvt.nLost, nLost);
 
-                    plistenerNode->active = 1;
-                    (*plistenerNode->listener)(plistenerNode->pPrivate, base+1u);
-                    plistenerNode->active = 0;
+    /* later messages trigger waitForWork again */
+    epicsAtomicCmpAndSwapIntT(&pvt.workPending, 1, 0);
 
-                    next = (listenerNode *)ellNext(&plistenerNode->node);
-                    if(plistenerNode->removed) {
-                        /* listener() called errlogRemoveListeners() */
-                        ellDelete(&pvt.listenerList, &plistenerNode->node);
-                        free(plistenerNode);
-                    }
-                    plistenerNode = next;
-                }
-                epicsMutexUnlock(pvt.listenerLock);
+    first = epicsAtomicGetPtrT((EpicsAtomicPtrT*)&pvt.rings);
+    for(ring = first; ring; ring = ring->next) {
+        size_t lost = epicsAtomicGetSizeT(&ring->nLost);
 
-                pos += 1u + mlen+1u;
+        ring->limit = epicsAtomicGetSizeT(&ring->head);
+        nLost += lost - ring->nLostSeen;
+        ring->nLostSeen = lost;
+    }
+    epicsAtomicReadMemoryBarrier();
+
+    while(1) {
+        stageRing *oldest = NULL;
+        entryHdr *hdr, *oldestHdr = NULL;
+
+        for(ring = first; ring; ring = ring->next) {
+            size_t left;
+
+            if(ring->tail == ring->limit)
+                continue;
+            left = pvt.bufSize - ring->tail % pvt.bufSize;
+            if(left < pvt.entryMax) {
+                /* the writer skipped to the beginning */
+                epicsAtomicSetSizeT(&ring->tail, ring->tail + left);
+                if(ring->tail == ring->limit)
+                    continue;
+            }
+            hdr = (entryHdr*)(ring->base + ring->tail % pvt.bufSize);
+            if(!oldest || (ptrdiff_t)(hdr->seq - oldestHdr->seq) < 0) {
+                oldest = ring;
+                oldestHdr = hdr;
             }
+        }
+        if(!oldest)
+            break;
 
-            memset(print->base, 0, pvt.bufSize);
-            print->pos = 0u;
+        errlogHandleMessage((char*)(oldestHdr + 1), console, ttyConsole);
+        nDone++;
 
-            if(nLost && console)
-                fprintf(console, "errlog: lost %zu messages\n", nLost);
+        epicsAtomicWriteMemoryBarrier();
+        epicsAtomicSetSizeT(&oldest->tail, oldest->tail + oldestHdr->len);
+    }
+
+    /* Free the rings of threads which have exited.  New rings are only
+     * pushed in front of first, so it stays on the list.
+     */
+    prev = first;
+    while(prev && (ring = prev->next) != NULL) {
+        if(epicsAtomicGetIntT(&ring->exited) &&
+                ring->tail == epicsAtomicGetSizeT(&ring->head)) {
+            prev->next = ring->next;
+            free(ring->base);
+            free(ring);
+        } else {
+            prev = ring;
+        }
+    }
 
-            if(console)
-                fflush(console);
+    *pnLost = nLost;
+    return nDone;
+}
 
-            epicsMutexMustLock(pvt.msgQueueLock);
+static void errlogThread(void)
+{
+    int wakeFlusher;
+    epicsMutexMustLock(pvt.msgQueueLock);
+    while (1) {
+        /* snapshot for use while unlocked */
+        FILE *console = pvt.toConsole ? pvt.console : NULL;
+        int ttyConsole = pvt.ttyConsole;
+        int atExit = pvt.atExit;
+        size_t nLost, nDone;
 
+        pvt.flushSeq++;
+        wakeFlusher = pvt.nFlushers!=0;
+        epicsMutexUnlock(pvt.msgQueueLock);
+
+        nDone = errlogDrain(console, ttyConsole, &nLost);
+
+        if(nLost && console)
+            fprintf(console, "errlog: lost %zu messages\n", nLost);
+
+        if((nDone || nLost) && console)
+            fflush(console);
+
+        if(wakeFlusher)
+            epicsEventMustTrigger(pvt.waitForSeq);
+
+        if(!nDone && !nLost) {
+            if(atExit)
+                break;
+            epicsEventMustWait(pvt.waitForWork);
         }
+        epicsMutexMustLock(pvt.msgQueueLock);
     }
+    epicsMutexMustLock(pvt.msgQueueLock);
     wakeFlusher = pvt.nFlushers!=0;
     epicsMutexUnlock(pvt.msgQueueLock);
     if(wakeFlusher)
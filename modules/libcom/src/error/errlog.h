@@ -204,9 +204,31 @@ LIBCOM_API int eltc(int yesno);
  */
 LIBCOM_API int errlogSetConsole(FILE *stream);
 
+/**
+ * Limits how many messages may be logged from one call site.
+ *
+ * A call site is the place which calls ::errlogPrintf or one of its
+ * relatives, together with the format string it passes. Calls from different
+ * places which pass the same format string are limited separately, as are
+ * calls of ::errlogMessage. A routine which logs on behalf of its callers
+ * counts as one place, so it is limited per format string. Where the compiler
+ * doesn't tell the caller's address, only the format string is used. When a
+ * thread logs more than maxPerSecond messages from the same call site within
+ * one second, the excess messages are discarded and counted. The count is
+ * logged when the call site logs again after the end of that second.
+ *
+ * \param maxPerSecond Maximum messages per second, or 0 for no limit (default)
+ * \since UNRELEASED
+ */
+LIBCOM_API void errlogSetRateLimit(int maxPerSecond);
 /**
  * Can be used to initialize the error logging system with a larger buffer. The default buffer size is 1280 bytes.
  *
+ * Each thread which logs messages gets its own buffer of this size, so that
+ * logging never has to wait for another thread. Threads not created by
+ * epicsThreadCreate() share one more buffer of this size under a lock.
+ * Messages which don't fit are discarded and counted.
+ *
  * \param bufsize The desired buffer size
  */
 LIBCOM_API int errlogInit(int bufsize);
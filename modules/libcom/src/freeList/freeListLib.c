@@ -12,6 +12,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdio.h>
 
 #include "valgrind/valgrind.h"
 
@@ -24,6 +25,10 @@
 
 #include "cantProceed.h"
 #include "epicsMutex.h"
+#include "epicsThread.h"
+#include "epicsExit.h"
+#include "ellLib.h"
+#include "dbDefs.h"
 #include "freeList.h"
 #include "adjustment.h"
 #include "errlog.h"
@@ -41,19 +46,236 @@ int freeListBypass
 
 epicsExportAddress(int, freeListBypass);
 
+/* Each thread keeps up to MAGAZINE_MAX free elements of a list in a
+ * "magazine" which it can use without taking the list lock.  Lists
+ * which allocate fewer than 4*MAGAZINE_MIN elements at a time are
+ * not cached, so large buffers aren't held by idle threads.
+ */
+#define MAGAZINE_MIN 4
+#define MAGAZINE_MAX 32
+
 typedef struct allocMem {
     struct allocMem     *next;
     void                *memory;
 }allocMem;
-typedef struct {
+typedef struct freeListPvt {
     int         size;
     int         nmalloc;
     void        *head;
     allocMem    *mallochead;
     size_t      nBlocksAvailable;
     epicsMutexId lock;
+    int         magazineSize; /* 0 if no per-thread caches */
+    size_t      slot;       /* index in each threadCache */
+    ELLLIST     magazines;  /* guarded by cacheLock */
 }FREELISTPVT;
 
+typedef struct magazine {
+    ELLNODE     node;       /* in owner->magazines */
+    FREELISTPVT *owner;     /* NULL when the list was cleaned up */
+    const char  *thread;
+    size_t      hits;       /* allocations from the magazine */
+    size_t      misses;     /* allocations which refilled it */
+    size_t      flushes;    /* frees which emptied it */
+    int         count;
+    void        *items[MAGAZINE_MAX];
+}magazine;
+
+/* Per-thread array of magazines, indexed by FREELISTPVT::slot */
+typedef struct threadCache {
+    size_t      nmags;
+    magazine    **mags;
+    char        name[32];
+}threadCache;
+
+static epicsThreadOnceId cacheOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId cacheId;
+static epicsMutexId cacheLock;
+/* slot owners, guarded by cacheLock */
+static FREELISTPVT **slots;
+static size_t nslots;
+
+static void cacheInit(void *unused)
+{
+    cacheId = epicsThreadPrivateCreate();
+    cacheLock = epicsMutexMustCreate();
+}
+
+/* Give a slot to a new list.  Returns 0 on success. */
+static int slotAlloc(FREELISTPVT *pfl)
+{
+    size_t i;
+
+    for(i=0; i<nslots; i++) {
+        if(!slots[i])
+            break;
+    }
+    if(i==nslots) {
+        FREELISTPVT **temp = realloc(slots, (nslots+16)*sizeof(*slots));
+        if(!temp)
+            return -1;
+        memset(temp+nslots, 0, 16*sizeof(*slots));
+        slots = temp;
+        nslots += 16;
+    }
+    slots[i] = pfl;
+    pfl->slot = i;
+    return 0;
+}
+
+/* Called with pfl->lock held.  Returns NULL if out of memory. */
+static void * popFree(FREELISTPVT *pfl)
+{
+    void        *ptemp;
+    void        **ppnext;
+    allocMem    *pallocmem;
+    int         i;
+
+    ptemp = pfl->head;
+    if(ptemp==0) {
+        /* layout of each block. nmalloc+1 REDZONEs for nmallocs.
+         * The first sizeof(void*) bytes are used to store a pointer
+         * to the next free block.
+         *
+         * | RED | size0 ------ | RED | size1 | ... | RED |
+         * |     | next | ----- |
+         */
+        ptemp = (void *)malloc(pfl->nmalloc*(pfl->size+REDZONE)+REDZONE);
+        if(ptemp==0)
+            return(0);
+        pallocmem = (allocMem *)calloc(1,sizeof(allocMem));
+        if(pallocmem==0) {
+            free(ptemp);
+            return(0);
+        }
+        pallocmem->memory = ptemp; /* real allocation */
+        ptemp = REDZONE + (char *) ptemp; /* skip first REDZONE */
+        if(pfl->mallochead)
+            pallocmem->next = pfl->mallochead;
+        pfl->mallochead = pallocmem;
+        for(i=0; i<pfl->nmalloc; i++) {
+            ppnext = ptemp;
+            VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, sizeof(void*));
+            *ppnext = pfl->head;
+            pfl->head = ptemp;
+            ptemp = ((char *)ptemp) + pfl->size+REDZONE;
+        }
+        ptemp = pfl->head;
+        pfl->nBlocksAvailable += pfl->nmalloc;
+    }
+    ppnext = pfl->head;
+    pfl->head = *ppnext;
+    pfl->nBlocksAvailable--;
+    VALGRIND_MEMPOOL_FREE(pfl, ptemp);
+    return(ptemp);
+}
+
+/* Called with pfl->lock held */
+static void pushFree(FREELISTPVT *pfl, void *pmem)
+{
+    void        **ppnext;
+
+    VALGRIND_MEMPOOL_ALLOC(pfl, pmem, sizeof(void*));
+    ppnext = pmem;
+    *ppnext = pfl->head;
+    pfl->head = pmem;
+    pfl->nBlocksAvailable++;
+}
+
+/* Return the cached elements of a thread to their lists */
+static void threadCacheFree(void *arg)
+{
+    threadCache *ptc = arg;
+    size_t i;
+
+    epicsThreadPrivateSet(cacheId, NULL);
+    epicsMutexMustLock(cacheLock);
+    for(i=0; i<ptc->nmags; i++) {
+        magazine *pmag = ptc->mags[i];
+        FREELISTPVT *pfl;
+
+        if(!pmag)
+            continue;
+        pfl = pmag->owner;
+        if(pfl) {
+            epicsMutexMustLock(pfl->lock);
+            while(pmag->count)
+                pushFree(pfl, pmag->items[--pmag->count]);
+            epicsMutexUnlock(pfl->lock);
+            ellDelete(&pfl->magazines, &pmag->node);
+        }
+        free(pmag);
+    }
+    epicsMutexUnlock(cacheLock);
+    free(ptc->mags);
+    free(ptc);
+}
+
+/* Slow path of getMagazine().  Returns NULL if out of memory, or if
+ * the thread wouldn't return its magazines when it exits.
+ */
+static magazine * attachMagazine(FREELISTPVT *pfl, threadCache *ptc)
+{
+    magazine *pmag;
+
+    if(!ptc) {
+        /* threads not created by epicsThreadCreate() use the list lock */
+        if(!epicsAtThreadExitRuns())
+            return NULL;
+        ptc = calloc(1, sizeof(*ptc));
+        if(!ptc)
+            return NULL;
+        strncpy(ptc->name, epicsThreadGetNameSelf(), sizeof(ptc->name)-1);
+        if(epicsAtThreadExit(threadCacheFree, ptc)) {
+            free(ptc);
+            return NULL;
+        }
+        epicsThreadPrivateSet(cacheId, ptc);
+    }
+    if(pfl->slot >= ptc->nmags) {
+        size_t n = pfl->slot + 1;
+        magazine **temp;
+
+        if(n < 2*ptc->nmags)
+            n = 2*ptc->nmags;
+        temp = realloc(ptc->mags, n*sizeof(*temp));
+        if(!temp)
+            return NULL;
+        memset(temp+ptc->nmags, 0, (n-ptc->nmags)*sizeof(*temp));
+        ptc->mags = temp;
+        ptc->nmags = n;
+    }
+    pmag = ptc->mags[pfl->slot];
+    if(!pmag) {
+        pmag = calloc(1, sizeof(*pmag));
+        if(!pmag)
+            return NULL;
+        pmag->thread = ptc->name;
+        ptc->mags[pfl->slot] = pmag;
+    }
+
+    /* any previous owner of this slot has been cleaned up */
+    epicsMutexMustLock(cacheLock);
+    pmag->owner = pfl;
+    pmag->count = 0;
+    pmag->hits = pmag->misses = pmag->flushes = 0u;
+    ellAdd(&pfl->magazines, &pmag->node);
+    epicsMutexUnlock(cacheLock);
+    return pmag;
+}
+
+/* The magazine of the calling thread for this list */
+static EPICS_ALWAYS_INLINE magazine * getMagazine(FREELISTPVT *pfl)
+{
+    threadCache *ptc = epicsThreadPrivateGet(cacheId);
+    magazine *pmag;
+
+    if(ptc && pfl->slot < ptc->nmags &&
+            (pmag = ptc->mags[pfl->slot]) && pmag->owner==pfl)
+        return pmag;
+    return attachMagazine(pfl, ptc);
+}
+
 LIBCOM_API void epicsStdCall 
     freeListInitPvt(void **ppvt,int size,int nmalloc)
 {
@@ -81,6 +303,15 @@ LIBCOM_API void epicsStdCall
     pfl->mallochead = NULL;
     pfl->nBlocksAvailable = 0u;
     pfl->lock = epicsMutexMustCreate();
+    ellInit(&pfl->magazines);
+    if(pfl->nmalloc/4 >= MAGAZINE_MIN) {
+        epicsThreadOnce(&cacheOnce, cacheInit, NULL);
+        epicsMutexMustLock(cacheLock);
+        if(cacheId && slotAlloc(pfl)==0)
+            pfl->magazineSize = pfl->nmalloc/4 < MAGAZINE_MAX ?
+                pfl->nmalloc/4 : MAGAZINE_MAX;
+        epicsMutexUnlock(cacheLock);
+    }
     *ppvt = (void *)pfl;
     VALGRIND_CREATE_MEMPOOL(pfl, REDZONE, 0);
 }
@@ -100,55 +331,37 @@ LIBCOM_API void * epicsStdCall freeListCalloc(void *pvt)
 LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
+    magazine    *pmag;
     void        *ptemp;
-    void        **ppnext;
-    allocMem    *pallocmem;
-    int         i;
 
     if(!pfl->nmalloc)
         return malloc(pfl->size);
 
-    epicsMutexMustLock(pfl->lock);
-    ptemp = pfl->head;
-    if(ptemp==0) {
-        /* layout of each block. nmalloc+1 REDZONEs for nmallocs.
-         * The first sizeof(void*) bytes are used to store a pointer
-         * to the next free block.
-         *
-         * | RED | size0 ------ | RED | size1 | ... | RED |
-         * |     | next | ----- |
-         */
-        ptemp = (void *)malloc(pfl->nmalloc*(pfl->size+REDZONE)+REDZONE);
-        if(ptemp==0) {
+    if(pfl->magazineSize && (pmag = getMagazine(pfl))) {
+        if(pmag->count) {
+            pmag->hits++;
+        } else {
+            /* refill half of the magazine */
+            pmag->misses++;
+            epicsMutexMustLock(pfl->lock);
+            while(pmag->count < pfl->magazineSize/2) {
+                ptemp = popFree(pfl);
+                if(!ptemp)
+                    break;
+                pmag->items[pmag->count++] = ptemp;
+            }
             epicsMutexUnlock(pfl->lock);
-            return(0);
+            if(!pmag->count)
+                return(0);
         }
-        pallocmem = (allocMem *)calloc(1,sizeof(allocMem));
-        if(pallocmem==0) {
-            epicsMutexUnlock(pfl->lock);
-            free(ptemp);
+        ptemp = pmag->items[--pmag->count];
+    } else {
+        epicsMutexMustLock(pfl->lock);
+        ptemp = popFree(pfl);
+        epicsMutexUnlock(pfl->lock);
+        if(!ptemp)
             return(0);
-        }
-        pallocmem->memory = ptemp; /* real allocation */
-        ptemp = REDZONE + (char *) ptemp; /* skip first REDZONE */
-        if(pfl->mallochead)
-            pallocmem->next = pfl->mallochead;
-        pfl->mallochead = pallocmem;
-        for(i=0; i<pfl->nmalloc; i++) {
-            ppnext = ptemp;
-            VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, sizeof(void*));
-            *ppnext = pfl->head;
-            pfl->head = ptemp;
-            ptemp = ((char *)ptemp) + pfl->size+REDZONE;
-        }
-        ptemp = pfl->head;
-        pfl->nBlocksAvailable += pfl->nmalloc;
     }
-    ppnext = pfl->head;
-    pfl->head = *ppnext;
-    pfl->nBlocksAvailable--;
-    epicsMutexUnlock(pfl->lock);
-    VALGRIND_MEMPOOL_FREE(pfl, ptemp);
     VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, pfl->size);
     return(ptemp);
 }
@@ -156,7 +369,7 @@ LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
 LIBCOM_API void epicsStdCall freeListFree(void *pvt,void*pmem)
 {
     FREELISTPVT *pfl = pvt;
-    void        **ppnext;
+    magazine    *pmag;
 
     if(!pfl->nmalloc) {
         free(pmem);
@@ -164,13 +377,22 @@ LIBCOM_API void epicsStdCall freeListFree(void *pvt,void*pmem)
     }
 
     VALGRIND_MEMPOOL_FREE(pvt, pmem);
-    VALGRIND_MEMPOOL_ALLOC(pvt, pmem, sizeof(void*));
+
+    if(pfl->magazineSize && (pmag = getMagazine(pfl))) {
+        if(pmag->count == pfl->magazineSize) {
+            /* return half of the magazine */
+            pmag->flushes++;
+            epicsMutexMustLock(pfl->lock);
+            while(pmag->count > pfl->magazineSize/2)
+                pushFree(pfl, pmag->items[--pmag->count]);
+            epicsMutexUnlock(pfl->lock);
+        }
+        pmag->items[pmag->count++] = pmem;
+        return;
+    }
 
     epicsMutexMustLock(pfl->lock);
-    ppnext = pmem;
-    *ppnext = pfl->head;
-    pfl->head = pmem;
-    pfl->nBlocksAvailable++;
+    pushFree(pfl, pmem);
     epicsMutexUnlock(pfl->lock);
 }
 
@@ -182,6 +404,20 @@ LIBCOM_API void epicsStdCall freeListCleanup(void *pvt)
 
     VALGRIND_DESTROY_MEMPOOL(pvt);
 
+    if(pfl->magazineSize) {
+        ELLNODE *cur;
+
+        /* detach the magazines, their threads will find out later */
+        epicsMutexMustLock(cacheLock);
+        while((cur = ellGet(&pfl->magazines)) != NULL) {
+            magazine *pmag = CONTAINER(cur, magazine, node);
+            pmag->owner = NULL;
+            pmag->count = 0;
+        }
+        slots[pfl->slot] = NULL;
+        epicsMutexUnlock(cacheLock);
+    }
+
     phead = pfl->mallochead;
     while(phead) {
         pnext = phead->next;
@@ -197,9 +433,54 @@ LIBCOM_API size_t epicsStdCall freeListItemsAvail(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
     size_t nBlocksAvailable;
+    ELLNODE *cur;
+
+    if(pfl->magazineSize)
+        epicsMutexMustLock(cacheLock);
     epicsMutexMustLock(pfl->lock);
     nBlocksAvailable = pfl->nBlocksAvailable;
     epicsMutexUnlock(pfl->lock);
+    for(cur = ellFirst(&pfl->magazines); cur; cur = ellNext(cur)) {
+        magazine *pmag = CONTAINER(cur, magazine, node);
+        nBlocksAvailable += pmag->count;
+    }
+    if(pfl->magazineSize)
+        epicsMutexUnlock(cacheLock);
     return nBlocksAvailable;
 }
 
+LIBCOM_API void epicsStdCall freeListShow(void *pvt, unsigned level)
+{
+    FREELISTPVT *pfl = pvt;
+    size_t hits = 0u, misses = 0u, cached = 0u;
+    ELLNODE *cur;
+
+    epicsMutexMustLock(pfl->lock);
+    printf("Free list %p of %d byte elements, allocated %d at a time\n"
+           "  %lu elements available\n",
+           pvt, pfl->size, pfl->nmalloc,
+           (unsigned long)pfl->nBlocksAvailable);
+    epicsMutexUnlock(pfl->lock);
+
+    if(!pfl->magazineSize)
+        return;
+
+    epicsMutexMustLock(cacheLock);
+    for(cur = ellFirst(&pfl->magazines); cur; cur = ellNext(cur)) {
+        magazine *pmag = CONTAINER(cur, magazine, node);
+        size_t total = pmag->hits + pmag->misses;
+
+        if(level > 0)
+            printf("  thread %-16s %2d cached, %lu allocated, %.1f%% hits, %lu flushes\n",
+                   pmag->thread, pmag->count, (unsigned long)total,
+                   total ? 100.0*pmag->hits/total : 0.0,
+                   (unsigned long)pmag->flushes);
+        hits += pmag->hits;
+        misses += pmag->misses;
+        cached += pmag->count;
+    }
+    printf("  %lu elements cached by %d threads, up to %d each, %.1f%% hits\n",
+           (unsigned long)cached, ellCount(&pfl->magazines), pfl->magazineSize,
+           hits + misses ? 100.0*hits/(hits + misses) : 0.0);
+    epicsMutexUnlock(cacheLock);
+}
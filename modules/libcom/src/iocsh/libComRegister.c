@@ -286,6 +286,19 @@ static void errlogInit2CallFunc(const iocshArgBuf *args)
     errlogInit2(args[0].ival, args[1].ival);
 }
 
+/* errlogRateLimit */
+static const iocshArg errlogRateLimitArg0 = { "maxPerSecond",iocshArgInt};
+static const iocshArg * const errlogRateLimitArgs[] = {&errlogRateLimitArg0};
+static const iocshFuncDef errlogRateLimitFuncDef = {
+    "errlogRateLimit", 1, errlogRateLimitArgs,
+    "Limit the messages logged by each thread from one call site\n"
+    "  maxPerSecond - messages per second, 0 = unlimited (default)\n"
+};
+static void errlogRateLimitCallFunc(const iocshArgBuf *args)
+{
+    errlogSetRateLimit(args[0].ival);
+}
+
 /* errlog */
 IOCSH_STATIC_FUNC void errlog(const char *message)
 {
@@ -498,6 +511,7 @@ void epicsStdCall libComRegister(void)
     iocshRegister(&eltcFuncDef, eltcCallFunc);
     iocshRegister(&errlogInitFuncDef,errlogInitCallFunc);
     iocshRegister(&errlogInit2FuncDef,errlogInit2CallFunc);
+    iocshRegister(&errlogRateLimitFuncDef,errlogRateLimitCallFunc);
     iocshRegister(&errlogFuncDef, errlogCallFunc);
     iocshRegister(&iocLogPrefixFuncDef, iocLogPrefixCallFunc);
 
@@ -0,0 +1,44 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Batch framing between logClient and iocLogServer, private to both.
+ *
+ * A client which wants batch framing starts the connection with the
+ * text line LOG_HELLO, followed by " compress" if it can compress, and
+ * a newline.  A server which understands it replies with LOG_REPLY_SIZE
+ * bytes: LOG_REPLY_MAGIC, two zero bytes and a byte of LOG_FRAME_*
+ * flags it accepts.  Old servers log the line and close their sending
+ * end without replying.  Other servers may not reply at all, so the
+ * client only waits 2 seconds for the reply.  Either way it then
+ * continues with plain text on the same connection.
+ *
+ * After the reply the client sends frames of LOG_FRAME_HDR_SIZE bytes:
+ * LOG_FRAME_MAGIC, a byte of LOG_FRAME_* flags and the payload size as
+ * a 32 bit big-endian integer, followed by the payload.  If the first
+ * bytes after the hello don't start with LOG_FRAME_MAGIC, the client
+ * gave up waiting for the reply, and the server takes them as text.
+ *
+ * The payload of an uncompressed frame is the log text.  A compressed
+ * payload is a sequence of records, each replacing one line (or the
+ * final partial line) of the text.  A record consists of the number of
+ * leading characters shared with the previous line of the same frame and
+ * the number of following characters, both as base-128 varints, followed
+ * by those characters.  Log storms tend to repeat long line prefixes.
+ */
+#ifndef INC_iocLogFrame_H
+#define INC_iocLogFrame_H
+
+#define LOG_HELLO "iocLogClient-batch-v1"
+#define LOG_REPLY_MAGIC "ILB1"
+#define LOG_REPLY_SIZE 7u
+
+#define LOG_FRAME_MAGIC "IL"
+#define LOG_FRAME_HDR_SIZE 7u
+#define LOG_FRAME_MAX_PAYLOAD 0x10000u
+
+#define LOG_FRAME_COMPRESSED 0x01u
+
+#endif /* INC_iocLogFrame_H */
@@ -0,0 +1,317 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* iocLogLoad.c */
+
+/*
+ *  Load generator for benchmarking a log server.
+ *
+ *  Simulates many IOCs connected to the server named by EPICS_IOC_LOG_INET
+ *  and EPICS_IOC_LOG_PORT, each sending messages as fast as the server
+ *  accepts them.  The sockets have small send buffers and block when the
+ *  server falls behind, and the clock stops when the server has received
+ *  everything, so the reported rate is the ingest rate of the server.
+ *  The clients send text like logClient, or frames as described in
+ *  iocLogFrame.h.
+ */
+
+#define EPICS_PRIVATE_API
+
+#include    <stdlib.h>
+#include    <string.h>
+#include    <stdio.h>
+
+#include    "dbDefs.h"
+#include    "envDefs.h"
+#include    "osiSock.h"
+#include    "epicsThread.h"
+#include    "epicsEvent.h"
+#include    "epicsTime.h"
+
+#include    "iocLogFrame.h"
+
+#define MAX_SENDERS 8u
+#define LINES_PER_SEND 64u
+#define SEND_BUF_SIZE 0x4000
+
+enum loadMode {
+    loadText,
+    loadBatch,
+    loadCompressed
+};
+
+struct sender {
+    SOCKET *socks;
+    unsigned nClients;
+    unsigned nMessages;
+    unsigned first;         /* number of socks[0] */
+    enum loadMode mode;
+    size_t bytesSent;
+    int failed;
+    epicsEventId done;
+};
+
+static unsigned putVarint (unsigned char *out, unsigned value)
+{
+    unsigned n = 0u;
+
+    while (value >= 0x80u) {
+        out[n++] = (unsigned char) (value | 0x80u);
+        value >>= 7;
+    }
+    out[n++] = (unsigned char) value;
+    return n;
+}
+
+/*
+ *  encodeLines()
+ *
+ *  Put nLines messages into buf, returns the number of bytes.
+ */
+static size_t encodeLines (unsigned char *buf, enum loadMode mode,
+    unsigned client, unsigned first, unsigned nLines)
+{
+    unsigned char *payload = buf;
+    size_t size;
+    char prev[128];
+    size_t prevLen = 0u;
+    unsigned i;
+
+    if (mode != loadText) {
+        payload += LOG_FRAME_HDR_SIZE;
+    }
+
+    size = 0u;
+    for (i = first; i < first + nLines; i++) {
+        char line[128];
+        size_t len, shared = 0u;
+
+        len = (size_t) sprintf (line, "iocLogLoad client %u: dev:ai%u "
+            "read timeout, message %u\n", client, i % 64u, i);
+        if (mode != loadCompressed) {
+            memcpy (&payload[size], line, len);
+            size += len;
+            continue;
+        }
+        while (shared < prevLen && line[shared] == prev[shared]) {
+            shared++;
+        }
+        size += putVarint (&payload[size], (unsigned) shared);
+        size += putVarint (&payload[size], (unsigned) (len - shared));
+        memcpy (&payload[size], &line[shared], len - shared);
+        size += len - shared;
+        memcpy (prev, line, len);
+        prevLen = len;
+    }
+
+    if (mode == loadText) {
+        return size;
+    }
+    memcpy (buf, LOG_FRAME_MAGIC, 2u);
+    buf[2] = mode == loadCompressed ? LOG_FRAME_COMPRESSED : 0u;
+    buf[3] = (unsigned char) (size >> 24);
+    buf[4] = (unsigned char) (size >> 16);
+    buf[5] = (unsigned char) (size >> 8);
+    buf[6] = (unsigned char) size;
+    return LOG_FRAME_HDR_SIZE + size;
+}
+
+static void senderThread (void *pParam)
+{
+    struct sender *psender = (struct sender *) pParam;
+    unsigned char buf[LOG_FRAME_HDR_SIZE + 128u * LINES_PER_SEND];
+    unsigned i, j;
+
+    for (i = 0u; i < psender->nMessages && !psender->failed;
+            i += LINES_PER_SEND) {
+        unsigned nLines = psender->nMessages - i;
+
+        if (nLines > LINES_PER_SEND) {
+            nLines = LINES_PER_SEND;
+        }
+        for (j = 0u; j < psender->nClients; j++) {
+            size_t size = encodeLines (buf, psender->mode,
+                psender->first + j, i, nLines);
+            size_t nSent = 0u;
+
+            while (nSent < size) {
+                int status = send (psender->socks[j], (char *) &buf[nSent],
+                    (int) (size - nSent), 0);
+                if (status <= 0) {
+                    psender->failed = TRUE;
+                    break;
+                }
+                nSent += status;
+            }
+            psender->bytesSent += nSent;
+        }
+    }
+    epicsEventMustTrigger (psender->done);
+}
+
+/*
+ *  connectClient()
+ *
+ *  Returns a connected socket, after asking for batch framing
+ *  unless mode is loadText.
+ */
+static SOCKET connectClient (const struct sockaddr_in *paddr,
+    enum loadMode mode)
+{
+    SOCKET sock = epicsSocketCreate (AF_INET, SOCK_STREAM, 0);
+    int sendBufSize = SEND_BUF_SIZE;
+    unsigned char reply[LOG_REPLY_SIZE];
+    const char *hello;
+    size_t nRecv = 0u;
+
+    if (sock == INVALID_SOCKET) {
+        return sock;
+    }
+    if (setsockopt (sock, SOL_SOCKET, SO_SNDBUF, (char *) &sendBufSize,
+            sizeof (sendBufSize)) < 0) {
+        fprintf (stderr, "iocLogLoad: failed to set SO_SNDBUF\n");
+    }
+    if (connect (sock, (struct sockaddr *) paddr, sizeof (*paddr)) < 0) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (sockErrBuf, sizeof (sockErrBuf));
+        fprintf (stderr, "iocLogLoad: failed to connect: %s\n", sockErrBuf);
+        epicsSocketDestroy (sock);
+        return INVALID_SOCKET;
+    }
+    if (mode == loadText) {
+        return sock;
+    }
+
+    hello = mode == loadCompressed ? LOG_HELLO " compress\n" : LOG_HELLO "\n";
+    if (send (sock, hello, (int) strlen (hello), 0) != (int) strlen (hello)) {
+        epicsSocketDestroy (sock);
+        return INVALID_SOCKET;
+    }
+    while (nRecv < LOG_REPLY_SIZE) {
+        int status = recv (sock, (char *) &reply[nRecv],
+            (int) (LOG_REPLY_SIZE - nRecv), 0);
+        if (status <= 0) {
+            break;
+        }
+        nRecv += status;
+    }
+    if (nRecv < LOG_REPLY_SIZE || memcmp (reply, LOG_REPLY_MAGIC, 4u) != 0 ||
+            (mode == loadCompressed && !(reply[6] & LOG_FRAME_COMPRESSED))) {
+        fprintf (stderr, "iocLogLoad: the server doesn't support %s\n",
+            mode == loadCompressed ? "compressed batches" : "batches");
+        epicsSocketDestroy (sock);
+        return INVALID_SOCKET;
+    }
+    return sock;
+}
+
+static int loadTest (unsigned nClients, unsigned nMessages,
+    enum loadMode mode)
+{
+    static const char * const modeName[] =
+        {"text", "batched", "batched, compressed"};
+    struct sockaddr_in addr;
+    long port = 7004;
+    SOCKET *socks;
+    struct sender senders[MAX_SENDERS];
+    unsigned nSenders = nClients < MAX_SENDERS ? nClients : MAX_SENDERS;
+    unsigned i;
+    size_t bytesSent = 0u;
+    int failed = FALSE;
+    epicsTimeStamp start, end;
+    double elapsed, nTotal;
+
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    if (envGetInetAddrConfigParam (&EPICS_IOC_LOG_INET, &addr.sin_addr) < 0) {
+        fprintf (stderr, "iocLogLoad: EPICS_IOC_LOG_INET is not set\n");
+        return -1;
+    }
+    (void) envGetLongConfigParam (&EPICS_IOC_LOG_PORT, &port);
+    addr.sin_port = htons ((unsigned short) port);
+
+    socks = calloc (nClients, sizeof (*socks));
+    if (!socks) {
+        fprintf (stderr, "iocLogLoad: out of memory\n");
+        return -1;
+    }
+    for (i = 0u; i < nClients; i++) {
+        socks[i] = connectClient (&addr, mode);
+        if (socks[i] == INVALID_SOCKET) {
+            fprintf (stderr, "iocLogLoad: client %u not connected\n", i);
+            return -1;
+        }
+    }
+    printf ("%u clients (%s), %u messages each\n", nClients,
+        modeName[mode], nMessages);
+
+    epicsTimeGetCurrent (&start);
+    for (i = 0u; i < nSenders; i++) {
+        unsigned first = nClients * i / nSenders;
+
+        senders[i].first = first;
+        senders[i].socks = &socks[first];
+        senders[i].nClients = nClients * (i + 1u) / nSenders - first;
+        senders[i].nMessages = nMessages;
+        senders[i].mode = mode;
+        senders[i].bytesSent = 0u;
+        senders[i].failed = FALSE;
+        senders[i].done = epicsEventMustCreate (epicsEventEmpty);
+        epicsThreadMustCreate ("logLoad", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize (epicsThreadStackMedium),
+            senderThread, &senders[i]);
+    }
+    for (i = 0u; i < nSenders; i++) {
+        epicsEventMustWait (senders[i].done);
+        bytesSent += senders[i].bytesSent;
+        failed |= senders[i].failed;
+    }
+    /* wait until the server has received everything */
+    for (i = 0u; i < nClients && !failed; i++) {
+        while (epicsSocketUnsentCount (socks[i]) > 0) {
+            epicsThreadSleep (0.001);
+        }
+    }
+    epicsTimeGetCurrent (&end);
+    elapsed = epicsTimeDiffInSeconds (&end, &start);
+
+    for (i = 0u; i < nClients; i++) {
+        epicsSocketDestroy (socks[i]);
+    }
+    free (socks);
+
+    if (failed) {
+        fprintf (stderr, "iocLogLoad: lost contact with the server\n");
+        return -1;
+    }
+    nTotal = (double) nClients * nMessages;
+    printf ("%.0f messages in %.3f sec, %.0f messages/sec, "
+        "%.2f MB/sec sent\n", nTotal, elapsed, nTotal / elapsed,
+        bytesSent / elapsed / 1e6);
+    return 0;
+}
+
+int main (int argc, char **argv)
+{
+    const char *pUsage = "[<client count> [<messages per client> "
+        "[<0 text, 1 batched, 2 compressed>]]]";
+    unsigned nClients = 100u;
+    unsigned nMessages = 10000u;
+    unsigned mode = loadText;
+    int status;
+
+    if ( ( argc > 1 && sscanf ( argv[1], " %u ", &nClients ) != 1 ) ||
+            ( argc > 2 && sscanf ( argv[2], " %u ", &nMessages ) != 1 ) ||
+            ( argc > 3 && sscanf ( argv[3], " %u ", &mode ) != 1 ) ||
+            argc > 4 || nClients == 0u || mode > loadCompressed ) {
+        printf ( "usage: %s %s\n", argv[0], pUsage);
+        return -1;
+    }
+
+    osiSockAttach ();
+    status = loadTest (nClients, nMessages, (enum loadMode) mode);
+    osiSockRelease ();
+    return status;
+}
@@ -29,35 +29,102 @@
 #include    <signal.h>
 #endif
 
+#ifdef __linux__
+#include    <sys/epoll.h>
+#define     USE_EPOLL
+#endif
+
 #include    "dbDefs.h"
 #include    "epicsAssert.h"
 #include    "fdmgr.h"
 #include    "envDefs.h"
 #include    "osiSock.h"
 #include    "epicsStdio.h"
+#include    "epicsThread.h"
+#include    "epicsMutex.h"
+#include    "epicsEvent.h"
+#include    "ellLib.h"
+
+#include    "iocLogFrame.h"
 
 static unsigned short ioc_log_port;
 static long ioc_log_file_limit;
 static char ioc_log_file_name[512];
 static char ioc_log_file_command[256];
+static long ioc_log_file_rotate;
+
+/*
+ * Formatted messages are collected in blocks of LOG_BLOCK_SIZE bytes
+ * which a writer thread writes to the file, so the event loop never
+ * waits for the disk unless all LOG_BLOCK_COUNT blocks are full.
+ */
+#define LOG_BLOCK_SIZE 0x40000u
+#define LOG_BLOCK_COUNT 8u
+
+struct logBlock {
+    ELLNODE node;
+    long offset;        /* file position of data[0] */
+    int rotate;         /* rotate the log files before writing */
+    size_t len;
+    char data[LOG_BLOCK_SIZE];
+};
 
+/*
+ * A file descriptor in the event loop
+ */
+struct logHandler {
+    SOCKET fd;
+    void (*callback)(void *pParam);
+    void *pParam;
+};
+
+
+enum clientState {
+    clientNew,      /* waiting for the first line */
+    clientText,
+    clientBatch     /* sending frames, see iocLogFrame.h */
+};
 
 struct iocLogClient {
     SOCKET insock;
+    struct logHandler handler;
     struct ioc_log_server *pserver;
     size_t nChar;
     char recvbuf[1024];
     char name[32];
     char ascii_time[32];
+    enum clientState state;
+    /* clientBatch only */
+    int framed;     /* received a frame */
+    size_t nFrame;
+    unsigned char *frameBuf;
+    char *segBuf;
 };
 
 struct ioc_log_server {
     char outfile[256];
-    long filePos;
-    FILE *poutfile;
+    long filePos;       /* where the next message goes */
+    FILE *poutfile;     /* used by the writer thread */
+    long writePos;      /* file position of the writer thread */
+#ifdef USE_EPOLL
+    int epfd;
+#else
     void *pfdctx;
+#endif
     SOCKET sock;
+    struct logHandler handler;
     long max_file_size;
+    long rotate;        /* number of old files kept, 0 to wrap around */
+
+    struct logBlock *fill;  /* block the event loop is filling */
+    int nextRotate;     /* the next block starts a new file */
+    epicsMutexId lock;
+    ELLLIST fullBlocks; /* waiting for the writer thread */
+    ELLLIST freeBlocks;
+    unsigned nBlocks;
+    int writing;        /* the writer thread has a block */
+    epicsEventId wakeWriter;
+    epicsEventId blockDone;
 };
 
 #define IOCLS_ERROR (-1)
@@ -72,6 +139,20 @@ static void handleLogFileError(void);
 static void envFailureNotify(const ENV_PARAM *pparam);
 static void freeLogClient(struct iocLogClient *pclient);
 static void writeMessagesToLog (struct iocLogClient *pclient);
+static void checkHello (struct iocLogClient *pclient);
+static int readFrames (struct iocLogClient *pclient);
+static int eventInit (struct ioc_log_server *pserver);
+static int eventAdd (struct ioc_log_server *pserver,
+    struct logHandler *phandler);
+static void eventDel (struct ioc_log_server *pserver,
+    struct logHandler *phandler);
+static void eventPend (struct ioc_log_server *pserver, double timeout);
+static int writerInit (struct ioc_log_server *pserver);
+static struct logBlock *fillBlock (struct ioc_log_server *pserver,
+    size_t size);
+static void submitBlock (struct ioc_log_server *pserver);
+static void syncWriter (struct ioc_log_server *pserver);
+static int writerIdle (struct ioc_log_server *pserver);
 
 #ifdef UNIX
 static int setupSIGHUP(struct ioc_log_server *);
@@ -79,6 +160,7 @@ static void sighupHandler(int);
 static void serviceSighupRequest(void *pParam);
 static int getDirectory(void);
 static int sighupPipe[2];
+static struct logHandler sighupPipeHandler;
 #endif
 
 
@@ -91,7 +173,6 @@ static int sighupPipe[2];
 int main(void)
 {
     struct sockaddr_in serverAddr;  /* server's address */
-    struct timeval timeout;
     int status;
     struct ioc_log_server *pserver;
 
@@ -111,13 +192,20 @@ int main(void)
         return IOCLS_ERROR;
     }
 
-    pserver->pfdctx = (void *) fdmgr_init();
-    if (!pserver->pfdctx) {
+    status = eventInit(pserver);
+    if (status < 0) {
         fprintf(stderr, "iocLogServer: %s\n", strerror(errno));
         free(pserver);
         return IOCLS_ERROR;
     }
 
+    status = writerInit(pserver);
+    if (status < 0) {
+        fprintf(stderr, "iocLogServer: failed to start the writer\n");
+        free(pserver);
+        return IOCLS_ERROR;
+    }
+
     /*
      * Open the socket. Use ARPA Internet address format and stream
      * sockets. Format described in <sys/socket.h>.
@@ -153,8 +241,9 @@ int main(void)
         return IOCLS_ERROR;
     }
 
-    /* listen and accept new connections */
-    status = listen(pserver->sock, 10);
+    /* listen and accept new connections, many IOCs
+     * may reconnect at once after a server restart */
+    status = listen(pserver->sock, SOMAXCONN);
     if (status < 0) {
         char sockErrBuf[64];
         epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
@@ -197,12 +286,10 @@ int main(void)
         return IOCLS_ERROR;
     }
 
-    status = fdmgr_add_callback(
-            pserver->pfdctx,
-            pserver->sock,
-            fdi_read,
-            acceptNewClient,
-            pserver);
+    pserver->handler.fd = pserver->sock;
+    pserver->handler.callback = acceptNewClient;
+    pserver->handler.pParam = pserver;
+    status = eventAdd(pserver, &pserver->handler);
     if (status < 0) {
         fprintf(stderr,
             "iocLogServer: failed to add read callback\n");
@@ -212,13 +299,117 @@ int main(void)
 
 
     while (TRUE) {
-        timeout.tv_sec = 60; /* 1 min */
-        timeout.tv_usec = 0;
-        fdmgr_pend_event(pserver->pfdctx, &timeout);
-        fflush(pserver->poutfile);
+        /*
+         * While the writer is busy, messages collect in the
+         * current block so that the file is written in large
+         * pieces.  Hand it over as soon as the writer is idle.
+         */
+        if (pserver->fill && pserver->fill->len) {
+            if (writerIdle(pserver)) {
+                submitBlock(pserver);
+            }
+            eventPend(pserver, 0.05);
+        }
+        else {
+            eventPend(pserver, 60.0); /* 1 min */
+        }
+    }
+}
+
+#ifdef USE_EPOLL
+
+/*
+ * The event loop uses epoll on Linux, which has no limit on the number
+ * of connected clients and doesn't scan every socket for each event.
+ */
+static int eventInit (struct ioc_log_server *pserver)
+{
+    pserver->epfd = epoll_create1(EPOLL_CLOEXEC);
+    return pserver->epfd < 0 ? IOCLS_ERROR : IOCLS_OK;
+}
+
+static int eventAdd (struct ioc_log_server *pserver,
+    struct logHandler *phandler)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = phandler;
+    return epoll_ctl(pserver->epfd, EPOLL_CTL_ADD, phandler->fd, &event) < 0 ?
+        IOCLS_ERROR : IOCLS_OK;
+}
+
+static void eventDel (struct ioc_log_server *pserver,
+    struct logHandler *phandler)
+{
+    struct epoll_event event;
+
+    if (epoll_ctl(pserver->epfd, EPOLL_CTL_DEL, phandler->fd, &event) < 0) {
+        fprintf(stderr, "%s:%d epoll_ctl() failed: %s\n",
+            __FILE__, __LINE__, strerror(errno));
+    }
+}
+
+static void eventPend (struct ioc_log_server *pserver, double timeout)
+{
+    struct epoll_event events[256];
+    int i, n;
+
+    n = epoll_wait(pserver->epfd, events, NELEMENTS(events),
+        (int) (timeout * 1000.0));
+    if (n < 0 && errno != EINTR) {
+        fprintf(stderr, "%s:%d epoll_wait() failed: %s\n",
+            __FILE__, __LINE__, strerror(errno));
+        epicsThreadSleep(1.0);
+    }
+
+    /* each descriptor is reported once, so callbacks which
+     * free their own handler don't affect later events
+     */
+    for (i = 0; i < n; i++) {
+        struct logHandler *phandler = events[i].data.ptr;
+        (*phandler->callback)(phandler->pParam);
+    }
+}
+
+#else /* USE_EPOLL */
+
+static int eventInit (struct ioc_log_server *pserver)
+{
+    pserver->pfdctx = (void *) fdmgr_init();
+    return pserver->pfdctx ? IOCLS_OK : IOCLS_ERROR;
+}
+
+static int eventAdd (struct ioc_log_server *pserver,
+    struct logHandler *phandler)
+{
+    return fdmgr_add_callback(pserver->pfdctx, phandler->fd, fdi_read,
+        phandler->callback, phandler->pParam);
+}
+
+static void eventDel (struct ioc_log_server *pserver,
+    struct logHandler *phandler)
+{
+    int status = fdmgr_clear_callback(pserver->pfdctx, phandler->fd,
+        fdi_read);
+    if (status!=IOCLS_OK) {
+        fprintf(stderr, "%s:%d fdmgr_clear_callback() failed\n",
+            __FILE__, __LINE__);
     }
 }
 
+static void eventPend (struct ioc_log_server *pserver, double timeout)
+{
+    struct timeval tv;
+
+    tv.tv_sec = (long) timeout;
+    tv.tv_usec = (long) ((timeout - tv.tv_sec) * 1e6);
+    fdmgr_pend_event(pserver->pfdctx, &tv);
+}
+
+#endif /* USE_EPOLL */
+
 /*
  * seekLatestLine (struct ioc_log_server *pserver)
  */
@@ -353,12 +544,36 @@ static int seekLatestLine (struct ioc_log_server *pserver)
 static int openLogFile (struct ioc_log_server *pserver)
 {
     enum TF_RETURN ret;
+    int status;
 
     if (pserver->poutfile && pserver->poutfile != stderr){
         fclose (pserver->poutfile);
         pserver->poutfile = NULL;
     }
 
+    pserver->max_file_size = ioc_log_file_limit;
+    pserver->rotate = ioc_log_file_limit ? ioc_log_file_rotate : 0;
+    pserver->nextRotate = FALSE;
+
+    if (pserver->rotate) {
+        /*
+         * continue at the end of the current file,
+         * the first message which doesn't fit starts a new one
+         */
+        pserver->poutfile = fopen(ioc_log_file_name, "a");
+        if (!pserver->poutfile) {
+            pserver->poutfile = stderr;
+            return IOCLS_ERROR;
+        }
+        strcpy (pserver->outfile, ioc_log_file_name);
+        if (fseek (pserver->poutfile, 0L, SEEK_END) != 0) {
+            return IOCLS_ERROR;
+        }
+        pserver->filePos = ftell (pserver->poutfile);
+        pserver->writePos = pserver->filePos;
+        return IOCLS_OK;
+    }
+
     pserver->poutfile = fopen(ioc_log_file_name, "r+");
     if (pserver->poutfile) {
         fclose (pserver->poutfile);
@@ -378,9 +593,10 @@ static int openLogFile (struct ioc_log_server *pserver)
         return IOCLS_ERROR;
     }
     strcpy (pserver->outfile, ioc_log_file_name);
-    pserver->max_file_size = ioc_log_file_limit;
 
-    return seekLatestLine (pserver);
+    status = seekLatestLine (pserver);
+    pserver->writePos = pserver->filePos;
+    return status;
 }
 
 
@@ -397,6 +613,208 @@ static void handleLogFileError(void)
 }
 
 
+/*
+ *  rotateLogFiles()
+ *
+ *  Rename the log file to <name>.1, after renaming any <name>.1 to
+ *  <name>.2 and so on, and start a new one.  Called by the writer.
+ */
+static void rotateLogFiles (struct ioc_log_server *pserver)
+{
+    char from[sizeof(pserver->outfile) + 24];
+    char to[sizeof(pserver->outfile) + 24];
+    long i;
+
+    if (pserver->poutfile != stderr) {
+        fclose (pserver->poutfile);
+    }
+
+    for (i = pserver->rotate; i > 1; i--) {
+        sprintf (from, "%s.%ld", pserver->outfile, i - 1);
+        sprintf (to, "%s.%ld", pserver->outfile, i);
+        (void) rename (from, to);   /* may not exist yet */
+    }
+    sprintf (to, "%s.1", pserver->outfile);
+    if (rename (pserver->outfile, to) != 0) {
+        fprintf (stderr, "iocLogServer: failed to rename `%s' because `%s'\n",
+            pserver->outfile, strerror(errno));
+    }
+
+    pserver->poutfile = fopen (pserver->outfile, "a");
+    if (!pserver->poutfile) {
+        handleLogFileError();
+    }
+    pserver->writePos = 0;
+}
+
+
+/*
+ *  writerThread()
+ *
+ *  Write the blocks filled by the event loop to the log file.
+ */
+static void writerThread (void *pParam)
+{
+    struct ioc_log_server *pserver = (struct ioc_log_server *) pParam;
+
+    epicsMutexMustLock (pserver->lock);
+    while (TRUE) {
+        struct logBlock *pblock =
+            (struct logBlock *) ellGet (&pserver->fullBlocks);
+
+        if (!pblock) {
+            epicsMutexUnlock (pserver->lock);
+            epicsEventMustWait (pserver->wakeWriter);
+            epicsMutexMustLock (pserver->lock);
+            continue;
+        }
+        pserver->writing = TRUE;
+        epicsMutexUnlock (pserver->lock);
+
+        if (pblock->rotate) {
+            rotateLogFiles (pserver);
+        }
+        if (pserver->poutfile != stderr &&
+                pblock->offset != pserver->writePos) {
+            if (fseek (pserver->poutfile, pblock->offset, SEEK_SET) != 0) {
+                handleLogFileError();
+            }
+            pserver->writePos = pblock->offset;
+        }
+        if (fwrite (pblock->data, 1, pblock->len, pserver->poutfile) !=
+                pblock->len || fflush (pserver->poutfile) != 0) {
+            handleLogFileError();
+        }
+        pserver->writePos += (long) pblock->len;
+
+        epicsMutexMustLock (pserver->lock);
+        pblock->len = 0u;
+        ellAdd (&pserver->freeBlocks, &pblock->node);
+        pserver->writing = FALSE;
+        epicsEventMustTrigger (pserver->blockDone);
+    }
+}
+
+
+/*
+ *  writerInit()
+ *
+ */
+static int writerInit (struct ioc_log_server *pserver)
+{
+    unsigned i;
+
+    ellInit (&pserver->fullBlocks);
+    ellInit (&pserver->freeBlocks);
+    pserver->lock = epicsMutexCreate ();
+    pserver->wakeWriter = epicsEventCreate (epicsEventEmpty);
+    pserver->blockDone = epicsEventCreate (epicsEventEmpty);
+    if (!pserver->lock || !pserver->wakeWriter || !pserver->blockDone) {
+        return IOCLS_ERROR;
+    }
+
+    for (i = 0u; i < LOG_BLOCK_COUNT; i++) {
+        struct logBlock *pblock = malloc (sizeof(*pblock));
+        if (!pblock) {
+            return IOCLS_ERROR;
+        }
+        ellAdd (&pserver->freeBlocks, &pblock->node);
+    }
+
+    if (!epicsThreadCreate ("logWriter", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize (epicsThreadStackSmall),
+            writerThread, pserver)) {
+        return IOCLS_ERROR;
+    }
+    return IOCLS_OK;
+}
+
+
+/*
+ *  fillBlock()
+ *
+ *  Returns the block to append size bytes to, waiting for the writer
+ *  if all blocks are full.
+ */
+static struct logBlock *fillBlock (struct ioc_log_server *pserver,
+    size_t size)
+{
+    struct logBlock *pblock = pserver->fill;
+
+    assert (size <= LOG_BLOCK_SIZE);
+    if (pblock && pblock->len + size <= LOG_BLOCK_SIZE) {
+        return pblock;
+    }
+    submitBlock (pserver);
+
+    epicsMutexMustLock (pserver->lock);
+    while (!(pblock = (struct logBlock *) ellGet (&pserver->freeBlocks))) {
+        epicsMutexUnlock (pserver->lock);
+        epicsEventMustWait (pserver->blockDone);
+        epicsMutexMustLock (pserver->lock);
+    }
+    epicsMutexUnlock (pserver->lock);
+
+    pblock->offset = pserver->filePos;
+    pblock->rotate = pserver->nextRotate;
+    pblock->len = 0u;
+    pserver->nextRotate = FALSE;
+    pserver->fill = pblock;
+    return pblock;
+}
+
+
+/*
+ *  submitBlock()
+ *
+ *  Pass the current block to the writer.
+ */
+static void submitBlock (struct ioc_log_server *pserver)
+{
+    struct logBlock *pblock = pserver->fill;
+
+    if (!pblock) {
+        return;
+    }
+    pserver->fill = NULL;
+
+    epicsMutexMustLock (pserver->lock);
+    ellAdd (&pserver->fullBlocks, &pblock->node);
+    epicsMutexUnlock (pserver->lock);
+    epicsEventMustTrigger (pserver->wakeWriter);
+}
+
+
+/*
+ *  writerIdle()
+ *
+ */
+static int writerIdle (struct ioc_log_server *pserver)
+{
+    int idle;
+
+    epicsMutexMustLock (pserver->lock);
+    idle = !pserver->writing && ellCount (&pserver->fullBlocks) == 0;
+    epicsMutexUnlock (pserver->lock);
+    return idle;
+}
+
+
+/*
+ *  syncWriter()
+ *
+ *  Wait until the writer has written all messages,
+ *  after which the event loop may use the log file.
+ */
+static void syncWriter (struct ioc_log_server *pserver)
+{
+    submitBlock (pserver);
+    while (!writerIdle (pserver)) {
+        epicsEventMustWait (pserver->blockDone);
+    }
+}
+
+
 
 /*
  *  acceptNewClient()
@@ -459,6 +877,11 @@ static void acceptNewClient ( void *pParam )
 
     pclient->pserver = pserver;
     pclient->nChar = 0u;
+    pclient->state = clientNew;
+    pclient->framed = 0;
+    pclient->nFrame = 0u;
+    pclient->frameBuf = NULL;
+    pclient->segBuf = NULL;
 
     ipAddrToA (&addr, pclient->name, sizeof(pclient->name));
 
@@ -493,28 +916,19 @@ static void acceptNewClient ( void *pParam )
         }
     }
 
-    status = shutdown(pclient->insock, SHUT_WR);
-    if(status<0){
-        char sockErrBuf[64];
-        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
-        fprintf (stderr, "%s:%d shutdown err %s\n", __FILE__, __LINE__,
-                sockErrBuf);
-        epicsSocketDestroy ( pclient->insock );
-        free(pclient);
-
-        return;
-    }
+    /*
+     * the write end is shut down when the first line shows
+     * whether the client wants batch framing
+     */
 
-    status = fdmgr_add_callback(
-            pserver->pfdctx,
-            pclient->insock,
-            fdi_read,
-            readFromClient,
-            pclient);
+    pclient->handler.fd = pclient->insock;
+    pclient->handler.callback = readFromClient;
+    pclient->handler.pParam = pclient;
+    status = eventAdd(pserver, &pclient->handler);
     if (status<0) {
         epicsSocketDestroy ( pclient->insock );
         free(pclient);
-        fprintf(stderr, "%s:%d client fdmgr_add_callback() failed\n",
+        fprintf(stderr, "%s:%d client eventAdd() failed\n",
             __FILE__, __LINE__);
         return;
     }
@@ -533,12 +947,21 @@ static void readFromClient(void *pParam)
     struct iocLogClient *pclient = (struct iocLogClient *)pParam;
     int                 recvLength;
     int                 size;
+    char                *pbuf;
 
     logTime(pclient);
 
-    size = (int) (sizeof(pclient->recvbuf) - pclient->nChar);
+    if (pclient->state == clientBatch) {
+        pbuf = (char *) &pclient->frameBuf[pclient->nFrame];
+        size = (int) (LOG_FRAME_HDR_SIZE + LOG_FRAME_MAX_PAYLOAD -
+            pclient->nFrame);
+    }
+    else {
+        pbuf = &pclient->recvbuf[pclient->nChar];
+        size = (int) (sizeof(pclient->recvbuf) - pclient->nChar);
+    }
     recvLength = recv(pclient->insock,
-              &pclient->recvbuf[pclient->nChar],
+              pbuf,
               size,
               0);
     if (recvLength <= 0) {
@@ -567,23 +990,237 @@ static void readFromClient(void *pParam)
         return;
     }
 
+    if (pclient->state == clientBatch) {
+        pclient->nFrame += (size_t) recvLength;
+        if (readFrames (pclient) < 0) {
+            freeLogClient (pclient);
+        }
+        return;
+    }
+
     pclient->nChar += (size_t) recvLength;
 
+    if (pclient->state == clientNew) {
+        checkHello (pclient);
+        if (pclient->state == clientBatch) {
+            if (readFrames (pclient) < 0) {
+                freeLogClient (pclient);
+            }
+            return;
+        }
+    }
+
     writeMessagesToLog (pclient);
 }
 
+/*
+ * endReplies()
+ */
+static void endReplies (struct iocLogClient *pclient)
+{
+    int status = shutdown(pclient->insock, SHUT_WR);
+    if(status<0){
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        fprintf (stderr, "%s:%d shutdown err %s\n", __FILE__, __LINE__,
+                sockErrBuf);
+    }
+}
+
+/*
+ * checkHello()
+ *
+ * Switch to batch framing if the first line from the client asks for it,
+ * see iocLogFrame.h
+ */
+static void checkHello (struct iocLogClient *pclient)
+{
+    static const size_t helloLen = sizeof(LOG_HELLO) - 1u;
+    unsigned char reply[LOG_REPLY_SIZE];
+    char *pcr = memchr(pclient->recvbuf, '\n', pclient->nChar);
+    size_t lineLen;
+    unsigned flags = 0u;
+    int status;
+
+    if (!pcr) {
+        if (pclient->nChar < sizeof(pclient->recvbuf)) {
+            return;     /* wait for the rest of the line */
+        }
+        pclient->state = clientText;
+        endReplies (pclient);
+        return;
+    }
+
+    lineLen = (size_t) (pcr - pclient->recvbuf);
+    if (lineLen < helloLen ||
+            memcmp(pclient->recvbuf, LOG_HELLO, helloLen) != 0) {
+        pclient->state = clientText;
+        endReplies (pclient);
+        return;
+    }
+
+    pclient->frameBuf = malloc(LOG_FRAME_HDR_SIZE + LOG_FRAME_MAX_PAYLOAD);
+    pclient->segBuf = malloc(LOG_FRAME_MAX_PAYLOAD);
+    if (!pclient->frameBuf || !pclient->segBuf) {
+        /* the client gives up waiting for a reply */
+        pclient->state = clientText;
+        endReplies (pclient);
+        return;
+    }
+
+    *pcr = '\0';
+    if (strstr(pclient->recvbuf + helloLen, " compress")) {
+        flags |= LOG_FRAME_COMPRESSED;
+    }
+
+    memcpy(reply, LOG_REPLY_MAGIC, 4u);
+    reply[4] = reply[5] = 0u;
+    reply[6] = (unsigned char) flags;
+    status = send(pclient->insock, (char *) reply, sizeof(reply), 0);
+    if (status != (int) sizeof(reply)) {
+        fprintf(stderr, "iocLogServer: failed to reply to %s\n",
+            pclient->name);
+    }
+    endReplies (pclient);
+
+    /* anything after the line is the first frame */
+    pclient->state = clientBatch;
+    pclient->nFrame = pclient->nChar - lineLen - 1u;
+    memcpy(pclient->frameBuf, pcr + 1, pclient->nFrame);
+    pclient->nChar = 0u;
+}
+
+/*
+ * writeTextToLog()
+ *
+ * Pass text from a frame through the same line buffer as
+ * the text sent by clients without batch framing.
+ */
+static void writeTextToLog (struct iocLogClient *pclient,
+    const char *text, size_t n)
+{
+    while (n) {
+        size_t count = sizeof(pclient->recvbuf) - pclient->nChar;
+
+        if (count > n) {
+            count = n;
+        }
+        memcpy(&pclient->recvbuf[pclient->nChar], text, count);
+        pclient->nChar += count;
+        text += count;
+        n -= count;
+        writeMessagesToLog (pclient);
+    }
+}
+
+static int getVarint (const unsigned char *payload, size_t size,
+    size_t *ppos, size_t *pvalue)
+{
+    size_t value = 0u;
+    unsigned shift;
+
+    for (shift = 0u; shift < 32u; shift += 7u) {
+        unsigned char c;
+
+        if (*ppos >= size) {
+            return IOCLS_ERROR;
+        }
+        c = payload[(*ppos)++];
+        value |= (size_t) (c & 0x7fu) << shift;
+        if (!(c & 0x80u)) {
+            *pvalue = value;
+            return IOCLS_OK;
+        }
+    }
+    return IOCLS_ERROR;
+}
+
+/*
+ * readFrames()
+ *
+ * Write the messages of all complete frames to the log.
+ * Returns IOCLS_ERROR if the client sent something invalid.
+ */
+static int readFrames (struct iocLogClient *pclient)
+{
+    size_t pos = 0u;
+
+    if (!pclient->framed && pclient->nFrame &&
+            memcmp(pclient->frameBuf, LOG_FRAME_MAGIC,
+                pclient->nFrame < 2u ? pclient->nFrame : 2u) != 0) {
+        /* the client gave up waiting for our reply */
+        size_t n = pclient->nFrame;
+
+        pclient->state = clientText;
+        pclient->nFrame = 0u;
+        writeTextToLog (pclient, (const char *) pclient->frameBuf, n);
+        return IOCLS_OK;
+    }
+
+    while (pclient->nFrame - pos >= LOG_FRAME_HDR_SIZE) {
+        const unsigned char *hdr = &pclient->frameBuf[pos];
+        const unsigned char *payload = hdr + LOG_FRAME_HDR_SIZE;
+        size_t size = ((size_t) hdr[3] << 24) | ((size_t) hdr[4] << 16) |
+            ((size_t) hdr[5] << 8) | hdr[6];
+
+        if (memcmp(hdr, LOG_FRAME_MAGIC, 2u) != 0 ||
+                size > LOG_FRAME_MAX_PAYLOAD) {
+            fprintf(stderr, "iocLogServer: invalid frame from %s\n",
+                pclient->name);
+            return IOCLS_ERROR;
+        }
+        if (pclient->nFrame - pos < LOG_FRAME_HDR_SIZE + size) {
+            break;
+        }
+
+        if (hdr[2] & LOG_FRAME_COMPRESSED) {
+            size_t in = 0u, segLen = 0u;
+
+            while (in < size) {
+                size_t shared, suffix;
+
+                if (getVarint(payload, size, &in, &shared) < 0 ||
+                        getVarint(payload, size, &in, &suffix) < 0 ||
+                        shared > segLen || suffix > size - in) {
+                    fprintf(stderr, "iocLogServer: invalid frame from %s\n",
+                        pclient->name);
+                    return IOCLS_ERROR;
+                }
+                memcpy(&pclient->segBuf[shared], &payload[in], suffix);
+                in += suffix;
+                segLen = shared + suffix;
+                writeTextToLog (pclient, pclient->segBuf, segLen);
+            }
+        }
+        else {
+            writeTextToLog (pclient, (const char *) payload, size);
+        }
+        pos += LOG_FRAME_HDR_SIZE + size;
+        pclient->framed = 1;
+    }
+
+    if (pos) {
+        pclient->nFrame -= pos;
+        memmove(pclient->frameBuf, &pclient->frameBuf[pos], pclient->nFrame);
+    }
+    return IOCLS_OK;
+}
+
 /*
  * writeMessagesToLog()
  */
 static void writeMessagesToLog (struct iocLogClient *pclient)
 {
-    int status;
+    struct ioc_log_server *pserver = pclient->pserver;
     size_t lineIndex = 0;
 
     while (TRUE) {
-        size_t nchar;
+        struct logBlock *pblock;
+        size_t nchar, textLen, nameLen, timeLen;
         size_t nTotChar;
         size_t crIndex;
+        const char *pnil;
+        char *pout;
         int ntci;
 
         if ( lineIndex >= pclient->nChar ) {
@@ -623,57 +1260,67 @@ static void writeMessagesToLog (struct iocLogClient *pclient)
         }
 
         /*
-         * reset the file pointer if we hit the end of the file
+         * a message ends at its first nil, as when it was printed
          */
-        nTotChar = strlen(pclient->name) +
-                strlen(pclient->ascii_time) + nchar + 3u;
+        pnil = memchr ( & pclient->recvbuf[lineIndex], '\0', nchar );
+        textLen = pnil ? (size_t) ( pnil - & pclient->recvbuf[lineIndex] ) : nchar;
+
+        nameLen = strlen(pclient->name);
+        timeLen = strlen(pclient->ascii_time);
+        nTotChar = nameLen + timeLen + textLen + 3u;
         assert (nTotChar <= INT_MAX);
         ntci = (int) nTotChar;
-        if ( pclient->pserver->max_file_size && pclient->pserver->filePos+ntci >= pclient->pserver->max_file_size ) {
-            if ( pclient->pserver->max_file_size >= pclient->pserver->filePos ) {
-                unsigned nPadChar;
+
+        /*
+         * start a new file or reset the file pointer
+         * if we hit the end of the file
+         */
+        if ( pserver->max_file_size && pserver->rotate &&
+                pserver->filePos &&
+                pserver->filePos + ntci > pserver->max_file_size ) {
+            submitBlock ( pserver );
+            pserver->nextRotate = TRUE;
+            pserver->filePos = 0;
+        }
+        else if ( pserver->max_file_size && ! pserver->rotate &&
+                pserver->filePos+ntci >= pserver->max_file_size ) {
+            if ( pserver->max_file_size >= pserver->filePos ) {
+                size_t nPadChar;
                 /*
                  * this gets rid of leftover junk at the end of the file
                  */
-                nPadChar = pclient->pserver->max_file_size - pclient->pserver->filePos;
-                while (nPadChar--) {
-                    status = putc ( ' ', pclient->pserver->poutfile );
-                    if ( status == EOF ) {
-                        handleLogFileError();
-                    }
-                }
+                nPadChar = pserver->max_file_size - pserver->filePos;
+                pblock = fillBlock ( pserver, nPadChar );
+                memset ( & pblock->data[pblock->len], ' ', nPadChar );
+                pblock->len += nPadChar;
             }
 
 #           ifdef DEBUG
                 fprintf ( stderr,
                     "ioc log server: resetting the file pointer\n" );
 #           endif
-            fflush ( pclient->pserver->poutfile );
-            rewind ( pclient->pserver->poutfile );
-            pclient->pserver->filePos = ftell ( pclient->pserver->poutfile );
+            submitBlock ( pserver );
+            pserver->filePos = 0;
         }
 
         /*
-         * NOTE: !! change format string here then must
+         * NOTE: !! change the format here then must
          * change nTotChar calc above !!
          */
-        assert (nchar<INT_MAX);
-        status = fprintf(
-            pclient->pserver->poutfile,
-            "%s %s %.*s\n",
-            pclient->name,
-            pclient->ascii_time,
-            (int) nchar,
-            &pclient->recvbuf[lineIndex]);
-        if (status<0) {
-            handleLogFileError();
-        }
-        else {
-            if (status != ntci) {
-                fprintf(stderr, "iocLogServer: didnt calculate number of characters correctly?\n");
-            }
-            pclient->pserver->filePos += status;
-        }
+        pblock = fillBlock ( pserver, nTotChar );
+        pout = & pblock->data[pblock->len];
+        memcpy ( pout, pclient->name, nameLen );
+        pout += nameLen;
+        *pout++ = ' ';
+        memcpy ( pout, pclient->ascii_time, timeLen );
+        pout += timeLen;
+        *pout++ = ' ';
+        memcpy ( pout, & pclient->recvbuf[lineIndex], textLen );
+        pout += textLen;
+        *pout++ = '\n';
+        pblock->len += nTotChar;
+        pserver->filePos += ntci;
+
         lineIndex += nchar+1u;
     }
 }
@@ -684,8 +1331,6 @@ static void writeMessagesToLog (struct iocLogClient *pclient)
  */
 static void freeLogClient(struct iocLogClient     *pclient)
 {
-    int     status;
-
     /*
      * flush any left overs
      */
@@ -699,17 +1344,12 @@ static void freeLogClient(struct iocLogClient     *pclient)
         writeMessagesToLog (pclient);
     }
 
-    status = fdmgr_clear_callback(
-               pclient->pserver->pfdctx,
-               pclient->insock,
-               fdi_read);
-    if (status!=IOCLS_OK) {
-        fprintf(stderr, "%s:%d fdmgr_clear_callback() failed\n",
-            __FILE__, __LINE__);
-    }
+    eventDel (pclient->pserver, &pclient->handler);
 
     epicsSocketDestroy ( pclient->insock );
 
+    free (pclient->frameBuf);
+    free (pclient->segBuf);
     free (pclient);
 }
 
@@ -783,6 +1423,19 @@ static int getConfig(void)
         return IOCLS_ERROR;
     }
 
+    status = envGetLongConfigParam(
+            &EPICS_IOC_LOG_FILE_ROTATE,
+            &ioc_log_file_rotate);
+    if(status>=0){
+        if (ioc_log_file_rotate < 0) {
+            envFailureNotify (&EPICS_IOC_LOG_FILE_ROTATE);
+            return IOCLS_ERROR;
+        }
+    }
+    else {
+        ioc_log_file_rotate = 0;
+    }
+
     /*
      * its ok to not specify the IOC_LOG_FILE_COMMAND
      */
@@ -843,12 +1496,10 @@ static int setupSIGHUP(struct ioc_log_server *pserver)
                 return IOCLS_ERROR;
         }
 
-    status = fdmgr_add_callback(
-            pserver->pfdctx,
-            sighupPipe[0],
-            fdi_read,
-            serviceSighupRequest,
-            pserver);
+    sighupPipeHandler.fd = sighupPipe[0];
+    sighupPipeHandler.callback = serviceSighupRequest;
+    sighupPipeHandler.pParam = pserver;
+    status = eventAdd(pserver, &sighupPipeHandler);
     if(status<0){
         fprintf(stderr,
             "iocLogServer: failed to add SIGHUP callback\n");
@@ -904,8 +1555,9 @@ static void serviceSighupRequest(void *pParam)
     }
 
     /*
-     * Try (re)opening the file.
+     * Try (re)opening the file once all messages are written.
      */
+    syncWriter(pserver);
     status = openLogFile(pserver);
     if(status<0){
         fprintf(stderr,
@@ -35,12 +35,25 @@
 #include "epicsExport.h"
 
 #include "logClient.h"
+#include "iocLogFrame.h"
 
 int logClientDebug = 0;
 epicsExportAddress (int, logClientDebug);
 
+/*
+ * Set before the client connects to ask the server for batch framing,
+ * optionally compressed, see iocLogFrame.h
+ */
+int logClientBatch = 0;
+epicsExportAddress (int, logClientBatch);
+int logClientCompress = 1;
+epicsExportAddress (int, logClientCompress);
+
+#define FRAME_BUF_SIZE 0x8000u
+
 typedef struct {
     char                msgBuf[0x4000];
+    char                *frameBuf;
     struct sockaddr_in  addr;
     char                name[64];
     epicsMutexId        mutex;
@@ -55,10 +68,17 @@ typedef struct {
     unsigned            shutdown;
     unsigned            shutdownConfirm;
     int                 connFailStatus;
+    /* batch framing, frameBuf holds complete frames */
+    unsigned            batched;
+    unsigned            compressed;
+    unsigned            frameLen;
+    unsigned            frameSent;
+    logClientStats      stats;
 } logClient;
 
 static const double      LOG_RESTART_DELAY = 5.0; /* sec */
 static const double      LOG_SERVER_SHUTDOWN_TIMEOUT = 30.0; /* sec */
+static const double      LOG_NEGOTIATE_TIMEOUT = 2.0; /* sec */
 
 /*
  * If set using iocLogPrefix() this string is prepended to all log messages:
@@ -162,13 +182,15 @@ static void logClientDestroy (logClientId id)
     epicsEventDestroy ( pClient->stateChangeNotify );
     epicsEventDestroy ( pClient->shutdownNotify );
 
+    free ( pClient->frameBuf );
     free ( pClient );
 }
 
 /*
  * This method requires the pClient->mutex be owned already.
+ * Returns -1 if some of the message was lost.
  */
-static void sendMessageChunk(logClient * pClient, const char * message) {
+static int sendMessageChunk(logClient * pClient, const char * message) {
     unsigned strSize;
 
     strSize = strlen ( message );
@@ -185,7 +207,7 @@ static void sendMessageChunk(logClient * pClient, const char * message) {
         if ( msgBufBytesLeft == 0u ) {
             fprintf ( stderr, "log client: messages to \"%s\" are lost\n",
                 pClient->name );
-            break;
+            return -1;
         }
         if ( msgBufBytesLeft > strSize) msgBufBytesLeft = strSize;
         memcpy ( & pClient->msgBuf[pClient->nextMsgIndex],
@@ -194,6 +216,7 @@ static void sendMessageChunk(logClient * pClient, const char * message) {
         strSize -= msgBufBytesLeft;
         message += msgBufBytesLeft;
     }
+    return 0;
 }
 
 /*
@@ -209,34 +232,41 @@ void epicsStdCall logClientSend ( logClientId id, const char * message )
 
     epicsMutexMustLock ( pClient->mutex );
 
-    if (logClientPrefix) {
-        sendMessageChunk(pClient, logClientPrefix);
+    pClient->stats.messages++;
+    if ( ( logClientPrefix &&
+            sendMessageChunk ( pClient, logClientPrefix ) < 0 ) ||
+            sendMessageChunk ( pClient, message ) < 0 ) {
+        pClient->stats.dropped++;
     }
-    sendMessageChunk(pClient, message);
 
     epicsMutexUnlock (pClient->mutex);
 }
 
+static void logClientLostContact ( logClient * pClient )
+{
+    if ( ! pClient->shutdown ) {
+        char sockErrBuf[128];
+        epicsSocketConvertErrnoToString(sockErrBuf, sizeof(sockErrBuf));
+        fprintf(stderr, "log client: lost contact with log server at '%s'\n"
+            " because \"%s\"\n", pClient->name, sockErrBuf);
+    }
+}
 
-void epicsStdCall logClientFlush ( logClientId id )
+/*
+ * This method requires the pClient->mutex be owned already.
+ */
+static void flushText ( logClient * pClient )
 {
     unsigned nSent;
     int status = 0;
 
-    logClient * pClient = ( logClient * ) id;
-
-    if ( ! pClient || ! pClient->connected ) {
-        return;
-    }
-
-    epicsMutexMustLock ( pClient->mutex );
-
     nSent = pClient->backlog;
     while ( nSent < pClient->nextMsgIndex && pClient->connected ) {
         status = send ( pClient->sock, pClient->msgBuf + nSent,
             pClient->nextMsgIndex - nSent, 0 );
         if ( status < 0 ) break;
         nSent += status;
+        pClient->stats.bytesSent += status;
     }
 
     if ( pClient->backlog > 0 && status >= 0 ) {
@@ -248,12 +278,7 @@ void epicsStdCall logClientFlush ( logClientId id )
     }
 
     if ( status < 0 ) {
-        if ( ! pClient->shutdown ) {
-            char sockErrBuf[128];
-            epicsSocketConvertErrnoToString(sockErrBuf, sizeof(sockErrBuf));
-            fprintf(stderr, "log client: lost contact with log server at '%s'\n"
-                " because \"%s\"\n", pClient->name, sockErrBuf);
-        }
+        logClientLostContact ( pClient );
         pClient->backlog = 0;
         logClientClose ( pClient );
     }
@@ -269,6 +294,206 @@ void epicsStdCall logClientFlush ( logClientId id )
                 pClient->nextMsgIndex );
         }
     }
+}
+
+static unsigned putVarint ( unsigned char * out, unsigned value )
+{
+    unsigned n = 0u;
+
+    while ( value >= 0x80u ) {
+        out[n++] = (unsigned char) ( value | 0x80u );
+        value >>= 7;
+    }
+    out[n++] = (unsigned char) value;
+    return n;
+}
+
+static unsigned varintSize ( unsigned value )
+{
+    unsigned n = 1u;
+
+    while ( value >= 0x80u ) {
+        value >>= 7;
+        n++;
+    }
+    return n;
+}
+
+/*
+ * Pack the start of the buffered text into a frame at the end of
+ * frameBuf, see iocLogFrame.h.  Returns the size of the frame, or 0
+ * if there is no room, and sets *pUsed to the number of characters.
+ */
+static unsigned encodeFrame ( logClient * pClient, unsigned * pUsed )
+{
+    unsigned char * frame =
+        (unsigned char *) pClient->frameBuf + pClient->frameLen;
+    unsigned char * payload = frame + LOG_FRAME_HDR_SIZE;
+    const char * text = pClient->msgBuf;
+    unsigned nText = pClient->nextMsgIndex;
+    unsigned space = FRAME_BUF_SIZE - pClient->frameLen;
+    unsigned maxPayload, out = 0u, pos = 0u;
+    unsigned flags = 0u;
+
+    if ( space < LOG_FRAME_HDR_SIZE + 16u ) {
+        return 0u;
+    }
+    maxPayload = space - LOG_FRAME_HDR_SIZE;
+    if ( maxPayload > LOG_FRAME_MAX_PAYLOAD ) {
+        maxPayload = LOG_FRAME_MAX_PAYLOAD;
+    }
+
+    if ( pClient->compressed ) {
+        const char * prev = NULL;
+        unsigned prevLen = 0u;
+
+        while ( pos < nText ) {
+            const char * end = memchr ( text + pos, '\n', nText - pos );
+            unsigned segLen = end ? (unsigned) ( end - text ) + 1u - pos :
+                nText - pos;
+            unsigned shared = 0u, suffix;
+
+            while ( shared < prevLen && shared < segLen &&
+                    prev[shared] == text[pos + shared] ) {
+                shared++;
+            }
+            suffix = segLen - shared;
+            if ( out + varintSize ( shared ) + varintSize ( suffix ) +
+                    suffix > maxPayload ) {
+                /* split a line only if it doesn't fit into a frame */
+                if ( out > 0u ) {
+                    break;
+                }
+                suffix = maxPayload - varintSize ( shared ) -
+                    varintSize ( maxPayload );
+                segLen = shared + suffix;
+            }
+            out += putVarint ( payload + out, shared );
+            out += putVarint ( payload + out, suffix );
+            memcpy ( payload + out, text + pos + shared, suffix );
+            out += suffix;
+            prev = text + pos;
+            prevLen = segLen;
+            pos += segLen;
+        }
+        flags = LOG_FRAME_COMPRESSED;
+    }
+
+    if ( ! pClient->compressed || out >= pos ) {
+        /* compression didn't help */
+        pos = nText < maxPayload ? nText : maxPayload;
+        memcpy ( payload, text, pos );
+        out = pos;
+        flags = 0u;
+    }
+
+    memcpy ( frame, LOG_FRAME_MAGIC, 2u );
+    frame[2] = (unsigned char) flags;
+    frame[3] = (unsigned char) ( out >> 24 );
+    frame[4] = (unsigned char) ( out >> 16 );
+    frame[5] = (unsigned char) ( out >> 8 );
+    frame[6] = (unsigned char) out;
+
+    *pUsed = pos;
+    return LOG_FRAME_HDR_SIZE + out;
+}
+
+static unsigned frameSize ( const char * frame )
+{
+    const unsigned char * hdr = (const unsigned char *) frame;
+
+    return LOG_FRAME_HDR_SIZE + ( ( (unsigned) hdr[3] << 24 ) |
+        ( (unsigned) hdr[4] << 16 ) | ( (unsigned) hdr[5] << 8 ) | hdr[6] );
+}
+
+/*
+ * This method requires the pClient->mutex be owned already.
+ */
+static void flushFrames ( logClient * pClient )
+{
+    unsigned acked, pos = 0u;
+    int status = 0;
+    int unsent;
+
+    while ( pClient->nextMsgIndex > 0u ) {
+        unsigned used;
+        unsigned n = encodeFrame ( pClient, & used );
+
+        if ( n == 0u ) {
+            break;
+        }
+        pClient->frameLen += n;
+        pClient->nextMsgIndex -= used;
+        memmove ( pClient->msgBuf, & pClient->msgBuf[used],
+            pClient->nextMsgIndex );
+    }
+
+    while ( pClient->frameSent < pClient->frameLen && pClient->connected ) {
+        status = send ( pClient->sock, pClient->frameBuf + pClient->frameSent,
+            pClient->frameLen - pClient->frameSent, 0 );
+        if ( status < 0 ) break;
+        pClient->frameSent += status;
+        pClient->stats.bytesSent += status;
+    }
+
+    if ( status < 0 ) {
+        logClientLostContact ( pClient );
+        /* the next connection sends the frames again */
+        pClient->frameSent = 0u;
+        logClientClose ( pClient );
+        return;
+    }
+
+    /*
+     * Keep the frames which the server may not have received yet, so
+     * that they are sent again if the connection breaks.
+     */
+    acked = pClient->frameSent;
+    unsent = epicsSocketUnsentCount ( pClient->sock );
+    if ( unsent > 0 ) {
+        acked = (unsigned) unsent < acked ? acked - unsent : 0u;
+    }
+    while ( pos < acked && pos + frameSize ( pClient->frameBuf + pos ) <= acked ) {
+        pos += frameSize ( pClient->frameBuf + pos );
+    }
+    if ( pos > 0u ) {
+        pClient->frameLen -= pos;
+        pClient->frameSent -= pos;
+        memmove ( pClient->frameBuf, pClient->frameBuf + pos,
+            pClient->frameLen );
+    }
+}
+
+void epicsStdCall logClientFlush ( logClientId id )
+{
+    logClient * pClient = ( logClient * ) id;
+    epicsUInt64 begin;
+    size_t bytesSent;
+
+    if ( ! pClient || ! pClient->connected ) {
+        return;
+    }
+
+    epicsMutexMustLock ( pClient->mutex );
+
+    begin = epicsMonotonicGet ();
+    bytesSent = pClient->stats.bytesSent;
+    if ( pClient->batched ) {
+        flushFrames ( pClient );
+    }
+    else {
+        flushText ( pClient );
+    }
+    if ( pClient->stats.bytesSent != bytesSent ) {
+        double elapsed = ( epicsMonotonicGet () - begin ) * 1e-9;
+
+        pClient->stats.flushes++;
+        pClient->stats.flushTimeTotal += elapsed;
+        if ( elapsed > pClient->stats.flushTimeMax ) {
+            pClient->stats.flushTimeMax = elapsed;
+        }
+    }
+
     epicsMutexUnlock ( pClient->mutex );
 }
 
@@ -302,6 +527,72 @@ static void logClientMakeSock (logClient *pClient)
         fprintf (stderr, "done\n");
 }
 
+/*
+ *  logClientNegotiate()
+ *  Ask the server for batch framing, see iocLogFrame.h
+ */
+static int logClientNegotiate (logClient *pClient)
+{
+    char            hello[64];
+    unsigned char   reply[LOG_REPLY_SIZE];
+    unsigned        nRecv = 0u;
+    int             status;
+
+    if ( ! pClient->frameBuf ) {
+        pClient->frameBuf = malloc ( FRAME_BUF_SIZE );
+        if ( ! pClient->frameBuf ) {
+            return -1;
+        }
+    }
+
+    sprintf ( hello, "%s%s\n", LOG_HELLO,
+        logClientCompress ? " compress" : "" );
+    status = send ( pClient->sock, hello, strlen ( hello ), 0 );
+    if ( status != (int) strlen ( hello ) ) {
+        return -1;
+    }
+
+    /*
+     * Old servers close their end, other servers may not reply at all.
+     * Either way the connection carries text from here on.  A server
+     * which replies too late sees the text and takes it as such.
+     */
+    while ( nRecv < LOG_REPLY_SIZE ) {
+        fd_set          readable;
+        struct timeval  timeout;
+
+        FD_ZERO ( & readable );
+        FD_SET ( pClient->sock, & readable );
+        timeout.tv_sec = (long) LOG_NEGOTIATE_TIMEOUT;
+        timeout.tv_usec = 0;
+        status = select ( (int) pClient->sock + 1, & readable,
+            NULL, NULL, & timeout );
+        if ( status == 0 && nRecv == 0u ) {
+            return 0;   /* text only */
+        }
+        if ( status <= 0 ) {
+            return -1;
+        }
+        status = recv ( pClient->sock, (char *) reply + nRecv,
+            LOG_REPLY_SIZE - nRecv, 0 );
+        if ( status == 0 && nRecv == 0u ) {
+            return 0;   /* text only */
+        }
+        if ( status <= 0 ) {
+            return -1;
+        }
+        nRecv += status;
+    }
+
+    if ( memcmp ( reply, LOG_REPLY_MAGIC, 4u ) != 0 ) {
+        return -1;
+    }
+    pClient->batched = 1u;
+    pClient->compressed = logClientCompress &&
+        ( reply[6] & LOG_FRAME_COMPRESSED );
+    return 0;
+}
+
 /*
  *  logClientConnect()
  */
@@ -354,10 +645,27 @@ static void logClientConnect (logClient *pClient)
         }
     }
 
+    pClient->batched = 0u;
+    pClient->compressed = 0u;
+    if ( logClientBatch && logClientNegotiate ( pClient ) < 0 ) {
+        if ( ! pClient->shutdown ) {
+            fprintf (stderr, "log client: no reply from server '%s'\n",
+                pClient->name);
+        }
+        logClientClose ( pClient );
+        return;
+    }
+
     epicsMutexMustLock (pClient->mutex);
 
     pClient->connected = 1u;
     pClient->connFailStatus = 0;
+    pClient->frameSent = 0u;
+    if ( ! pClient->batched && pClient->frameLen ) {
+        fprintf ( stderr, "log client: %u bytes of batched messages to"
+            " \"%s\" are lost\n", pClient->frameLen, pClient->name );
+        pClient->frameLen = 0u;
+    }
 
     /*
      * discover that the connection has expired
@@ -416,8 +724,9 @@ static void logClientConnect (logClient *pClient)
 
     epicsEventSignal ( pClient->stateChangeNotify );
 
-    fprintf(stderr, "log client: connected to log server at '%s'\n",
-        pClient->name);
+    fprintf(stderr, "log client: connected to log server at '%s'%s\n",
+        pClient->name, pClient->batched ?
+            ( pClient->compressed ? " (batched, compressed)" : " (batched)" ) : "");
 }
 
 /*
@@ -532,12 +841,25 @@ void epicsStdCall logClientShow (logClientId id, unsigned level)
     }
 
     if (level>0) {
+        logClientStats stats;
+
         printf ("log client: sock %s, connect cycles = %u\n",
             pClient->sock==INVALID_SOCKET?"INVALID":"OK",
             pClient->connectCount);
+        logClientGetStats (id, &stats);
+        printf ("log client: %s, %zu messages, %zu dropped, %zu bytes sent\n",
+            stats.batched ? ( stats.compressed ? "batched, compressed" :
+                "batched" ) : "text",
+            stats.messages, stats.dropped, stats.bytesSent);
+        printf ("log client: %zu flushes, %.3f ms average, %.3f ms max\n",
+            stats.flushes, stats.flushes ?
+                stats.flushTimeTotal * 1e3 / stats.flushes : 0.0,
+            stats.flushTimeMax * 1e3);
     }
     if (level>1) {
         printf ("log client: %u bytes in buffer\n", pClient->nextMsgIndex);
+        if (pClient->frameLen)
+            printf ("log client: %u bytes of frames\n", pClient->frameLen);
         if (pClient->nextMsgIndex)
             printf("-------------------------\n"
                 "%.*s-------------------------\n",
@@ -545,6 +867,20 @@ void epicsStdCall logClientShow (logClientId id, unsigned level)
     }
 }
 
+/*
+ * logClientGetStats ()
+ */
+void epicsStdCall logClientGetStats (logClientId id, logClientStats *pStats)
+{
+    logClient *pClient = (logClient *) id;
+
+    epicsMutexMustLock ( pClient->mutex );
+    *pStats = pClient->stats;
+    pStats->batched = pClient->connected && pClient->batched;
+    pStats->compressed = pClient->connected && pClient->compressed;
+    epicsMutexUnlock ( pClient->mutex );
+}
+
 /*
  * iocLogPrefix()
  */
@@ -25,6 +25,8 @@
  */
 #ifndef INClogClienth
 #define INClogClienth 1
+#include <stddef.h>
+
 #include "libComAPI.h"
 #include "osiSock.h" /* for 'struct in_addr' */
 
@@ -85,6 +87,53 @@ LIBCOM_API void epicsStdCall logClientShow (logClientId id, unsigned level);
  */
 LIBCOM_API void epicsStdCall logClientFlush (logClientId id);
 
+/** \brief Counters of a log client, see logClientGetStats()
+ * \since UNRELEASED
+ */
+typedef struct logClientStats {
+    /** \brief Messages passed to logClientSend() */
+    size_t messages;
+    /** \brief Messages discarded because the buffer was full */
+    size_t dropped;
+    /** \brief Bytes written to the socket */
+    size_t bytesSent;
+    /** \brief Flushes which wrote something to the socket */
+    size_t flushes;
+    /** \brief Time spent in those flushes, in seconds */
+    double flushTimeTotal;
+    /** \brief Longest of those flushes, in seconds */
+    double flushTimeMax;
+    /** \brief Non-zero while connected with batch framing */
+    int batched;
+    /** \brief Non-zero while the batches are compressed */
+    int compressed;
+} logClientStats;
+
+/** \brief Ask the log server for batch framing
+ *
+ * When non-zero as a log client connects, it asks the server to accept
+ * many messages per frame, compressed if logClientCompress is also
+ * non-zero (the default).  Servers which don't support batch framing
+ * receive the request as a text message.  If such a server closes its
+ * sending end, or doesn't reply within 2 seconds, the client continues
+ * with the text protocol on the same connection.
+ * \since UNRELEASED
+ */
+LIBCOM_API extern int logClientBatch;
+/** \brief Compress batches, see logClientBatch
+ * \since UNRELEASED
+ */
+LIBCOM_API extern int logClientCompress;
+
+/** \brief Get the counters of a log client
+ *
+ * \param id log client handle
+ * \param pStats filled in with the current counters
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsStdCall logClientGetStats (logClientId id,
+    logClientStats *pStats);
+
 /** \brief Set prefix to be sent infront of every log message
  *
  * Sets a prefix to prepend every log message.  Can only be set
@@ -55,6 +55,9 @@ static epicsThreadOnceId exitLaterOnce = EPICS_THREAD_ONCE_INIT;
 static exitPvt * pExitPvtPerProcess = 0;
 static epicsMutexId exitPvtLock = 0;
 static epicsThreadPrivateId exitPvtPerThread = 0;
+/* set to &runsAtThreadExits in threads which call epicsExitCallAtThreadExits() */
+static epicsThreadPrivateId runsAtThreadExitsPerThread = 0;
+static char runsAtThreadExits;
 
 static int exitLaterStatus;
 
@@ -77,6 +80,8 @@ static void exitPvtOnceFunc(void *pParm)
 {
     exitPvtPerThread = epicsThreadPrivateCreate ();
     assert ( exitPvtPerThread );
+    runsAtThreadExitsPerThread = epicsThreadPrivateCreate ();
+    assert ( runsAtThreadExitsPerThread );
     exitPvtLock = epicsMutexMustCreate ();
 }
 
@@ -132,6 +137,18 @@ LIBCOM_API void epicsExitCallAtThreadExits(void)
     }
 }
 
+LIBCOM_API void epicsExitInitThread(void)
+{
+    epicsExitInit ();
+    epicsThreadPrivateSet ( runsAtThreadExitsPerThread, &runsAtThreadExits );
+}
+
+LIBCOM_API int epicsAtThreadExitRuns(void)
+{
+    epicsExitInit ();
+    return epicsThreadPrivateGet ( runsAtThreadExitsPerThread ) != 0;
+}
+
 static int epicsAtExitPvt(exitPvt *pep, epicsExitFunc func, void *arg, const char *name)
 {
     int status = -1;
@@ -79,6 +79,26 @@ LIBCOM_API int epicsAtExit3(epicsExitFunc func, void *arg, const char* name);
  * some other method.
  */
 LIBCOM_API void epicsExitCallAtThreadExits(void);
+/**
+ * \brief Internal routine that marks the calling thread as one which will
+ * call epicsExitCallAtThreadExits() when its entry routine returns.
+ *
+ * \note  This routine is called automatically before an epicsThread's main
+ * entry routine starts.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsExitInitThread(void);
+/**
+ * \brief Tell whether the routines registered by epicsAtThreadExit() will
+ * be run for the calling thread.
+ *
+ * That is only the case for threads created by epicsThreadCreate().
+ * Code which caches resources for each thread may use this to avoid
+ * leaking them in other threads.
+ * \return Non-zero if the thread exit routines will be run.
+ * \since UNRELEASED
+ */
+LIBCOM_API int epicsAtThreadExitRuns(void);
 /**
  * \brief Register a function and an context value to be run by this thread
  * when it returns from its entry routine.
@@ -20,6 +20,162 @@
 #include "epicsConvert.h"
 
 
+/*
+ * Fast paths for plain decimal numbers, which is what most .db files and
+ * string puts contain.  They return 0 to leave anything else to the C
+ * library, which also sets errno for numbers that might not fit.
+ * The decimal point is always '.' whatever the locale.
+ */
+
+#define IS_DIGIT(c) ((c) >= '0' && (c) <= '9')
+
+/* Decimal digits that always fit */
+#define LONG_DIGITS ((LONG_MAX > 0x7fffffffL) ? 18 : 9)
+#define LLONG_DIGITS 18
+
+static int
+fastParseDecimal(const char *str, int base, int maxDigits, int allowMinus,
+    epicsUInt64 *to, int *negative, char **endp)
+{
+    const char *cp = str;
+    epicsUInt64 value = 0;
+    int nDigits;
+
+    *negative = 0;
+    if (*cp == '-') {
+        if (!allowMinus)
+            return 0;
+        *negative = 1;
+        cp++;
+    }
+    else if (*cp == '+')
+        cp++;
+
+    /* For base 0 a leading 0 means octal or hex */
+    if (!IS_DIGIT(*cp) || (base == 0 && *cp == '0') ||
+        (base != 0 && base != 10))
+        return 0;
+
+    for (nDigits = 0; IS_DIGIT(*cp); cp++) {
+        if (++nDigits > maxDigits)
+            return 0;
+        value = value * 10 + (*cp - '0');
+    }
+
+    *to = value;
+    *endp = (char *) cp;
+    return 1;
+}
+
+/* Without this the multiplications below may get rounded twice */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+
+static const double powersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_MANTISSA (1ULL << 53)
+
+/*
+ * Parses up to 19 significant digits into an integer mantissa and a power
+ * of ten.  When both are exactly representable as doubles, a single
+ * multiplication or division gives the correctly rounded result (Clinger's
+ * fast path).
+ */
+static int
+fastParseDouble(const char *str, double *to, char **endp)
+{
+    const char *cp = str;
+    epicsUInt64 mantissa = 0;
+    int nDigits = 0, exp10 = 0, any = 0, negative = 0;
+    double value;
+
+    if (*cp == '-') {
+        negative = 1;
+        cp++;
+    }
+    else if (*cp == '+')
+        cp++;
+
+    if (cp[0] == '0' && (cp[1] == 'x' || cp[1] == 'X'))
+        return 0;
+
+    for (; *cp == '0'; cp++)
+        any = 1;
+    for (; IS_DIGIT(*cp); cp++) {
+        if (++nDigits > 19)
+            return 0;
+        mantissa = mantissa * 10 + (*cp - '0');
+        any = 1;
+    }
+    if (*cp == '.') {
+        cp++;
+        if (!nDigits) {
+            for (; *cp == '0'; cp++) {
+                exp10--;
+                any = 1;
+            }
+        }
+        for (; IS_DIGIT(*cp); cp++) {
+            if (++nDigits > 19)
+                return 0;
+            mantissa = mantissa * 10 + (*cp - '0');
+            exp10--;
+            any = 1;
+        }
+    }
+    if (!any)
+        return 0;   /* Also Inf and NaN */
+
+    if (*cp == 'e' || *cp == 'E') {
+        const char *ep = cp + 1;
+        int expNegative = 0, exp = 0;
+
+        if (*ep == '-') {
+            expNegative = 1;
+            ep++;
+        }
+        else if (*ep == '+')
+            ep++;
+        if (IS_DIGIT(*ep)) {
+            for (; IS_DIGIT(*ep); ep++) {
+                if (exp < 10000)
+                    exp = exp * 10 + (*ep - '0');
+            }
+            exp10 += expNegative ? -exp : exp;
+            cp = ep;
+        }
+    }
+
+    if (mantissa > MAX_EXACT_MANTISSA)
+        return 0;
+    if (exp10 < 0) {
+        if (exp10 < -22)
+            return 0;
+        value = (double) mantissa / powersOfTen[-exp10];
+    }
+    else {
+        /* Shift some of a large exponent into a small mantissa */
+        while (exp10 > 22 && mantissa <= MAX_EXACT_MANTISSA / 10) {
+            mantissa *= 10;
+            exp10--;
+        }
+        if (exp10 > 22)
+            return 0;
+        value = (double) mantissa * powersOfTen[exp10];
+    }
+
+    *to = negative ? -value : value;
+    *endp = (char *) cp;
+    return 1;
+}
+
+#else
+#define fastParseDouble(str, to, endp) 0
+#endif
+
+
 /* These are the conversion primitives */
 
 LIBCOM_API int
@@ -28,19 +184,26 @@ epicsParseLong(const char *str, long *to, int base, char **units)
     int c;
     char *endp;
     long value;
+    epicsUInt64 fast;
+    int negative;
 
     while ((c = *str) && isspace(c))
         ++str;
 
-    errno = 0;
-    value = strtol(str, &endp, base);
-
-    if (endp == str)
-        return S_stdlib_noConversion;
-    if (errno == EINVAL)    /* Not universally supported */
-        return S_stdlib_badBase;
-    if (errno == ERANGE)
-        return S_stdlib_overflow;
+    if (fastParseDecimal(str, base, LONG_DIGITS, 1, &fast, &negative, &endp)) {
+        value = negative ? -(long) fast : (long) fast;
+    }
+    else {
+        errno = 0;
+        value = strtol(str, &endp, base);
+
+        if (endp == str)
+            return S_stdlib_noConversion;
+        if (errno == EINVAL)    /* Not universally supported */
+            return S_stdlib_badBase;
+        if (errno == ERANGE)
+            return S_stdlib_overflow;
+    }
 
     while ((c = *endp) && isspace(c))
         ++endp;
@@ -59,19 +222,26 @@ epicsParseULong(const char *str, unsigned long *to, int base, char **units)
     int c;
     char *endp;
     unsigned long value;
+    epicsUInt64 fast;
+    int negative;
 
     while ((c = *str) && isspace(c))
         ++str;
 
-    errno = 0;
-    value = strtoul(str, &endp, base);
-
-    if (endp == str)
-        return S_stdlib_noConversion;
-    if (errno == EINVAL)    /* Not universally supported */
-        return S_stdlib_badBase;
-    if (errno == ERANGE)
-        return S_stdlib_overflow;
+    if (fastParseDecimal(str, base, LONG_DIGITS, 0, &fast, &negative, &endp)) {
+        value = (unsigned long) fast;
+    }
+    else {
+        errno = 0;
+        value = strtoul(str, &endp, base);
+
+        if (endp == str)
+            return S_stdlib_noConversion;
+        if (errno == EINVAL)    /* Not universally supported */
+            return S_stdlib_badBase;
+        if (errno == ERANGE)
+            return S_stdlib_overflow;
+    }
 
     while ((c = *endp) && isspace(c))
         ++endp;
@@ -90,19 +260,26 @@ epicsParseLLong(const char *str, long long *to, int base, char **units)
     int c;
     char *endp;
     long long value;
+    epicsUInt64 fast;
+    int negative;
 
     while ((c = *str) && isspace(c))
         ++str;
 
-    errno = 0;
-    value = strtoll(str, &endp, base);
-
-    if (endp == str)
-        return S_stdlib_noConversion;
-    if (errno == EINVAL)    /* Not universally supported */
-        return S_stdlib_badBase;
-    if (errno == ERANGE)
-        return S_stdlib_overflow;
+    if (fastParseDecimal(str, base, LLONG_DIGITS, 1, &fast, &negative, &endp)) {
+        value = negative ? -(long long) fast : (long long) fast;
+    }
+    else {
+        errno = 0;
+        value = strtoll(str, &endp, base);
+
+        if (endp == str)
+            return S_stdlib_noConversion;
+        if (errno == EINVAL)    /* Not universally supported */
+            return S_stdlib_badBase;
+        if (errno == ERANGE)
+            return S_stdlib_overflow;
+    }
 
     while ((c = *endp) && isspace(c))
         ++endp;
@@ -121,19 +298,26 @@ epicsParseULLong(const char *str, unsigned long long *to, int base, char **units
     int c;
     char *endp;
     unsigned long long value;
+    epicsUInt64 fast;
+    int negative;
 
     while ((c = *str) && isspace(c))
         ++str;
 
-    errno = 0;
-    value = strtoull(str, &endp, base);
-
-    if (endp == str)
-        return S_stdlib_noConversion;
-    if (errno == EINVAL)    /* Not universally supported */
-        return S_stdlib_badBase;
-    if (errno == ERANGE)
-        return S_stdlib_overflow;
+    if (fastParseDecimal(str, base, LLONG_DIGITS, 0, &fast, &negative, &endp)) {
+        value = (unsigned long long) fast;
+    }
+    else {
+        errno = 0;
+        value = strtoull(str, &endp, base);
+
+        if (endp == str)
+            return S_stdlib_noConversion;
+        if (errno == EINVAL)    /* Not universally supported */
+            return S_stdlib_badBase;
+        if (errno == ERANGE)
+            return S_stdlib_overflow;
+    }
 
     while ((c = *endp) && isspace(c))
         ++endp;
@@ -156,13 +340,15 @@ epicsParseDouble(const char *str, double *to, char **units)
     while ((c = *str) && isspace(c))
         ++str;
 
-    errno = 0;
-    value = epicsStrtod(str, &endp);
+    if (!fastParseDouble(str, &value, &endp)) {
+        errno = 0;
+        value = epicsStrtod(str, &endp);
 
-    if (endp == str)
-        return S_stdlib_noConversion;
-    if (errno == ERANGE)
-        return (value == 0) ? S_stdlib_underflow : S_stdlib_overflow;
+        if (endp == str)
+            return S_stdlib_noConversion;
+        if (errno == ERANGE)
+            return (value == 0) ? S_stdlib_underflow : S_stdlib_overflow;
+    }
 
     while ((c = *endp) && isspace(c))
         ++endp;
@@ -335,6 +521,41 @@ epicsParseFloat(const char *str, float *to, char **units)
 }
 
 
+/* Bulk conversions of string arrays */
+
+LIBCOM_API int
+epicsParseDoubleArray(const char *strs, size_t stride, size_t count,
+    double *to)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, strs += stride) {
+        char *units;
+        int status = epicsParseDouble(strs, &to[i], &units);
+
+        if (status)
+            return status;
+    }
+    return 0;
+}
+
+LIBCOM_API int
+epicsParseInt32Array(const char *strs, size_t stride, size_t count,
+    epicsInt32 *to, int base)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, strs += stride) {
+        char *units;
+        int status = epicsParseInt32(strs, &to[i], base, &units);
+
+        if (status)
+            return status;
+    }
+    return 0;
+}
+
+
 /* If strtod() works properly, the OS-specific osdStrtod.h does:
  *   #define epicsStrtod strtod
  *
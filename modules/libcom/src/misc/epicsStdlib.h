@@ -157,6 +157,37 @@ LIBCOM_API int
 LIBCOM_API int
     epicsParseUInt64(const char *str, epicsUInt64 *to, int base, char **units);
 
+/**
+ * \brief Convert an array of strings to doubles
+ *
+ * Converts \p count strings, the first at \p strs and each following one
+ * \p stride characters after the previous one, as if by epicsParseDouble()
+ * with a units pointer, so any text after each number is ignored.
+ * Plain decimal numbers are converted without calling strtod().
+ *
+ * \param strs Pointer to the first string
+ * \param stride Distance between the strings, usually MAX_STRING_SIZE
+ * \param count Number of strings
+ * \param to Pointer to an array of \p count doubles
+ * \return Status code of the first string that failed to convert, or 0.
+ * The values before that string have been stored.
+ * \since UNRELEASED
+ */
+LIBCOM_API int
+    epicsParseDoubleArray(const char *strs, size_t stride, size_t count,
+        double *to);
+
+/**
+ * \brief Convert an array of strings to epicsInt32
+ *
+ * As epicsParseDoubleArray(), but converting as by epicsParseInt32()
+ * using number base \p base.
+ * \since UNRELEASED
+ */
+LIBCOM_API int
+    epicsParseInt32Array(const char *strs, size_t stride, size_t count,
+        epicsInt32 *to, int base);
+
 /**  Macro utilizing ::epicsParseFloat to convert */
 #define epicsParseFloat32(str, to, units) epicsParseFloat(str, to, units)
 /**  Macro utilizing ::epicsParseDouble to convert */
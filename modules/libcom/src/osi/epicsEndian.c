@@ -0,0 +1,218 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Byte order reversal of whole arrays, used where the wire format
+ * differs from the host byte order.  The vector loops handle whole
+ * 16 or 32 byte blocks, the scalar loops the rest.
+ */
+
+#include <string.h>
+
+#include "epicsTypes.h"
+#include "epicsEndian.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define SWAP_SSE2
+#endif
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#  define SWAP_AVX2
+#  define SWAP_AVX2_FUNC
+#elif defined(SWAP_SSE2) && defined(__GNUC__) && !defined(_WIN32) && \
+        (defined(__clang__) || __GNUC__ > 4 || \
+         (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+/* Not enabled for the whole build, check for it at runtime */
+#  include <immintrin.h>
+#  define SWAP_AVX2
+#  define SWAP_AVX2_FUNC __attribute__((target("avx2")))
+#  define SWAP_AVX2_CHECK
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define SWAP_NEON
+#endif
+
+#ifdef SWAP_AVX2_CHECK
+static int haveAVX2(void)
+{
+    static int have = -1;
+
+    if (have < 0)
+        have = __builtin_cpu_supports("avx2") ? 1 : 0;
+    return have;
+}
+#else
+#  define haveAVX2() 1
+#endif
+
+/* Scalar, the compiler turns these into byte swap instructions */
+
+static void swap16Scalar(epicsUInt8 *d, const epicsUInt8 *s, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++, s += 2, d += 2) {
+        epicsUInt16 v;
+        memcpy(&v, s, 2);
+        v = (epicsUInt16)((v >> 8) | (v << 8));
+        memcpy(d, &v, 2);
+    }
+}
+
+static void swap32Scalar(epicsUInt8 *d, const epicsUInt8 *s, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++, s += 4, d += 4) {
+        epicsUInt32 v;
+        memcpy(&v, s, 4);
+        v = (v >> 24) | ((v >> 8) & 0x0000ff00u) |
+            ((v << 8) & 0x00ff0000u) | (v << 24);
+        memcpy(d, &v, 4);
+    }
+}
+
+static void swap64Scalar(epicsUInt8 *d, const epicsUInt8 *s, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++, s += 8, d += 8) {
+        epicsUInt64 v;
+        memcpy(&v, s, 8);
+        v = ((v & 0x00ff00ff00ff00ffull) << 8) |
+            ((v >> 8) & 0x00ff00ff00ff00ffull);
+        v = ((v & 0x0000ffff0000ffffull) << 16) |
+            ((v >> 16) & 0x0000ffff0000ffffull);
+        v = (v << 32) | (v >> 32);
+        memcpy(d, &v, 8);
+    }
+}
+
+/* AVX2, one shuffle for each 32 bytes.  Returns the number of bytes done. */
+
+#ifdef SWAP_AVX2
+static SWAP_AVX2_FUNC
+size_t swapAVX2(epicsUInt8 *d, const epicsUInt8 *s, size_t nbytes,
+    int size)
+{
+    static const epicsInt8 masks[3][16] = {
+        {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+        {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+        {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+    };
+    const epicsInt8 *m = masks[size == 2 ? 0 : size == 4 ? 1 : 2];
+    __m256i mask = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *) m));
+    size_t i;
+
+    for (i = 0; i + 32 <= nbytes; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        _mm256_storeu_si256((__m256i *) (d + i), _mm256_shuffle_epi8(v, mask));
+    }
+    return i;
+}
+#endif
+
+/* SSE2 has no byte shuffle, swap bytes within 16-bit words by shifting,
+ * then reorder the words.
+ */
+
+#ifdef SWAP_SSE2
+static size_t swapSSE2(epicsUInt8 *d, const epicsUInt8 *s, size_t nbytes,
+    int size)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= nbytes; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        if (size == 4) {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if (size == 8) {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        _mm_storeu_si128((__m128i *) (d + i), v);
+    }
+    return i;
+}
+#endif
+
+#ifdef SWAP_NEON
+static size_t swapNEON(epicsUInt8 *d, const epicsUInt8 *s, size_t nbytes,
+    int size)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= nbytes; i += 16) {
+        uint8x16_t v = vld1q_u8(s + i);
+
+        if (size == 2)
+            v = vrev16q_u8(v);
+        else if (size == 4)
+            v = vrev32q_u8(v);
+        else
+            v = vrev64q_u8(v);
+        vst1q_u8(d + i, v);
+    }
+    return i;
+}
+#endif
+
+/* Returns the number of bytes swapped, a multiple of size */
+static size_t swapVector(epicsUInt8 *d, const epicsUInt8 *s, size_t nbytes,
+    int size)
+{
+    size_t done = 0;
+
+#ifdef SWAP_AVX2
+    if (nbytes >= 32 && haveAVX2())
+        done = swapAVX2(d, s, nbytes, size);
+#endif
+#ifdef SWAP_SSE2
+    done += swapSSE2(d + done, s + done, nbytes - done, size);
+#endif
+#ifdef SWAP_NEON
+    done += swapNEON(d + done, s + done, nbytes - done, size);
+#endif
+    (void) d; (void) s; (void) size;
+    return done;
+}
+
+void epicsSwap16Array(void *dst, const void *src, size_t count)
+{
+    epicsUInt8 *d = (epicsUInt8 *) dst;
+    const epicsUInt8 *s = (const epicsUInt8 *) src;
+    size_t done = swapVector(d, s, count * 2, 2);
+
+    swap16Scalar(d + done, s + done, count - done / 2);
+}
+
+void epicsSwap32Array(void *dst, const void *src, size_t count)
+{
+    epicsUInt8 *d = (epicsUInt8 *) dst;
+    const epicsUInt8 *s = (const epicsUInt8 *) src;
+    size_t done = swapVector(d, s, count * 4, 4);
+
+    swap32Scalar(d + done, s + done, count - done / 4);
+}
+
+void epicsSwap64Array(void *dst, const void *src, size_t count)
+{
+    epicsUInt8 *d = (epicsUInt8 *) dst;
+    const epicsUInt8 *s = (const epicsUInt8 *) src;
+    size_t done = swapVector(d, s, count * 8, 8);
+
+    swap64Scalar(d + done, s + done, count - done / 8);
+}
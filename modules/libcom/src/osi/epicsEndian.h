@@ -32,4 +32,39 @@
 #error osdWireConfig.h didnt define EPICS_FLOAT_WORD_ORDER
 #endif
 
+#include <stddef.h>
+
+#include "libComAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Defined when the epicsSwapNNArray() routines are available
+ * \since UNRELEASED
+ */
+#define EPICS_SWAP_ARRAY
+
+/** \brief Copy an array of 16-bit values, reversing the bytes of each.
+ *
+ * Uses SIMD instructions where the target has them.
+ * \param dst Destination, may be the same as src but not otherwise overlap it.
+ * \param src Source values, neither needs to be aligned.
+ * \param count Number of elements.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap16Array(void *dst, const void *src, size_t count);
+/** \brief Like epicsSwap16Array() for 32-bit values, including epicsFloat32.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap32Array(void *dst, const void *src, size_t count);
+/** \brief Like epicsSwap16Array() for 64-bit values, including epicsFloat64.
+ * \since UNRELEASED
+ */
+LIBCOM_API void epicsSwap64Array(void *dst, const void *src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* INC_epicsEndian_H */
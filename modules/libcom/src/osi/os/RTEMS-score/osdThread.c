@@ -196,6 +196,7 @@ threadWrapper (rtems_task_argument arg)
     struct taskVar *v = (struct taskVar *)arg;
 
     osdThreadHooksRun((epicsThreadId)v->id);
+    epicsExitInitThread ();
     (*v->funptr)(v->parm);
     epicsExitCallAtThreadExits ();
     epicsAtomicSetIntT(&v->isRunning, 0);
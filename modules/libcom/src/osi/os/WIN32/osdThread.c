@@ -503,6 +503,7 @@ static unsigned WINAPI epicsWin32ThreadEntry ( LPVOID lpParameter )
         success = FlsSetValue ( pGbl->flsIndexThreadLibraryEPICS, pParm );
         if ( success ) {
             osdThreadHooksRun ( ( epicsThreadId ) pParm );
+            epicsExitInitThread ();
             /* printf ( "starting thread %d\n", pParm->id ); */
             ( *pParm->funptr ) ( pParm->parm );
             /* printf ( "terminating thread %d\n", pParm->id ); */
@@ -24,6 +24,21 @@
 #include <epicsEvent.h>
 #include <epicsMutex.h>
 
+/*
+ * On Linux queues of small messages use a lock-free ring, and
+ * blocked senders and receivers sleep on a futex.
+ */
+#if defined(__linux__) && defined(__GNUC__)
+#  include <errno.h>
+#  include <time.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#  include <linux/futex.h>
+#  include <epicsAtomic.h>
+#  define MQ_FAST_PATH
+#  define MQ_FAST_MAX_SIZE 128
+#endif
+
 /*
  * Event cache
  */
@@ -73,8 +88,273 @@ struct epicsMessageQueueOSD {
     unsigned long   slotSize;
 
     bool            full;
+
+#ifdef MQ_FAST_PATH
+    /*
+     * Bounded multi-producer/multi-consumer ring, see epicsRingMPMC.c.
+     * Each cell holds a sequence number, the message size and the message.
+     * The ring size is a power of two, and senders check that at most
+     * capacity messages are queued.
+     */
+    char           *ring;
+    size_t          mask;
+    size_t          stride;
+    int             recvWaiting;
+    int             recvFutex;
+    int             recvSignalled;
+    char            pad1[64];
+    size_t          enqueuePos;
+    int             sendWaiting;
+    int             sendFutex;
+    int             sendSignalled;
+    char            pad2[64];
+    size_t          dequeuePos;
+#endif
 };
 
+#ifdef MQ_FAST_PATH
+
+#define CELL(pmsg, pos) \
+    ((size_t *)((pmsg)->ring + ((pos) & (pmsg)->mask) * (pmsg)->stride))
+
+/*
+ * The epicsAtomic barriers are full fences with GCC, which would cost
+ * several times the rest of a send or receive.  The ring only needs
+ * acquire and release ordering, so it uses the compiler builtins.
+ */
+#define LOAD_ACQUIRE(p)     __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define LOAD_RELAXED(p)     __atomic_load_n(p, __ATOMIC_RELAXED)
+#define STORE_RELEASE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define CLAIM(p, pexp)      __atomic_compare_exchange_n(p, pexp, *(pexp) + 1, \
+                                true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+
+static void
+futexWait(int *addr, int val, double timeout)
+{
+    struct timespec rel;
+
+    if (timeout < 0) {
+        syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+        return;
+    }
+    rel.tv_sec = (time_t)timeout;
+    rel.tv_nsec = (long)((timeout - rel.tv_sec) * 1e9);
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, &rel, NULL, 0);
+}
+
+/*
+ * Wake up one sleeper, unless none is waiting or an earlier wakeup
+ * hasn't been noticed yet.  A sleeper which succeeds passes the wakeup
+ * on if there is more to do, see fastSend() and fastReceive().
+ */
+static void
+futexWake(int *waiting, int *signalled, int *addr)
+{
+    /* Pairs with the increment of the waiting count by the sleeper,
+     * which then looks at the ring again.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (LOAD_RELAXED(waiting) > 0 &&
+            epicsAtomicCmpAndSwapIntT(signalled, 0, 1) == 0) {
+        epicsAtomicIncrIntT(addr);
+        syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+static double
+monotonicNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Number of messages queued or being copied in or out */
+static size_t
+fastPending(epicsMessageQueueId pmsg)
+{
+    size_t out = LOAD_ACQUIRE(&pmsg->dequeuePos);
+    size_t in = LOAD_ACQUIRE(&pmsg->enqueuePos);
+
+    return (ptrdiff_t)(in - out) < 0 ? 0 : in - out;
+}
+
+static bool
+fastCreate(epicsMessageQueueId pmsg)
+{
+    size_t size = 2, i;
+
+    while (size < pmsg->capacity)
+        size <<= 1;
+    pmsg->mask = size - 1;
+    pmsg->stride = sizeof(size_t) *
+        (2 + (pmsg->maxMessageSize + sizeof(size_t) - 1) / sizeof(size_t));
+    pmsg->ring = (char *)malloc(size * pmsg->stride);
+    if (!pmsg->ring)
+        return false;
+    for (i = 0; i < size; i++)
+        *CELL(pmsg, i) = i;
+    pmsg->enqueuePos = pmsg->dequeuePos = 0;
+    epicsAtomicWriteMemoryBarrier();
+    return true;
+}
+
+static bool
+fastPut(epicsMessageQueueId pmsg, void *message, unsigned int size)
+{
+    size_t pos, *cell;
+
+    pos = LOAD_RELAXED(&pmsg->enqueuePos);
+    while (1) {
+        ptrdiff_t dif;
+
+        cell = CELL(pmsg, pos);
+        dif = (ptrdiff_t)(LOAD_ACQUIRE(cell) - pos);
+        if (dif == 0) {
+            /* The ring may have more cells than the queue capacity */
+            if (pos - LOAD_ACQUIRE(&pmsg->dequeuePos) >= pmsg->capacity)
+                return false;
+            if (CLAIM(&pmsg->enqueuePos, &pos))
+                break;
+        }
+        else if (dif < 0) {
+            return false;   /* full, or receiver not finished yet */
+        }
+        else {
+            pos = LOAD_RELAXED(&pmsg->enqueuePos);
+        }
+    }
+
+    cell[1] = size;
+    memcpy(cell + 2, message, size);
+    STORE_RELEASE(cell, pos + 1);
+
+    futexWake(&pmsg->recvWaiting, &pmsg->recvSignalled, &pmsg->recvFutex);
+    return true;
+}
+
+/* Returns the message size, -1 if it didn't fit or -2 if none is queued */
+static int
+fastGet(epicsMessageQueueId pmsg, void *message, unsigned int size)
+{
+    size_t pos, *cell, l;
+    int ret;
+
+    pos = LOAD_RELAXED(&pmsg->dequeuePos);
+    while (1) {
+        ptrdiff_t dif;
+
+        cell = CELL(pmsg, pos);
+        dif = (ptrdiff_t)(LOAD_ACQUIRE(cell) - (pos + 1));
+        if (dif == 0) {
+            if (CLAIM(&pmsg->dequeuePos, &pos))
+                break;
+        }
+        else if (dif < 0) {
+            return -2;  /* empty, or sender not finished yet */
+        }
+        else {
+            pos = LOAD_RELAXED(&pmsg->dequeuePos);
+        }
+    }
+
+    l = cell[1];
+    if (l <= size) {
+        memcpy(message, cell + 2, l);
+        ret = (int)l;
+    }
+    else {
+        ret = -1;
+    }
+    STORE_RELEASE(cell, pos + pmsg->mask + 1);
+
+    futexWake(&pmsg->sendWaiting, &pmsg->sendSignalled, &pmsg->sendFutex);
+    return ret;
+}
+
+static int
+fastSend(epicsMessageQueueId pmsg, void *message, unsigned int size,
+    double timeout)
+{
+    double deadline = 0.0;
+    bool sent = false;
+
+    if (fastPut(pmsg, message, size))
+        return 0;
+    if (timeout == 0)
+        return -1;
+    if (timeout > 0)
+        deadline = monotonicNow() + timeout;
+
+    epicsAtomicIncrIntT(&pmsg->sendWaiting);
+    while (1) {
+        int seq = epicsAtomicGetIntT(&pmsg->sendFutex);
+
+        /* allow the next wakeup before looking again */
+        epicsAtomicSetIntT(&pmsg->sendSignalled, 0);
+        sent = fastPut(pmsg, message, size);
+        if (sent)
+            break;
+        if (timeout > 0) {
+            timeout = deadline - monotonicNow();
+            if (timeout <= 0)
+                break;
+        }
+        futexWait(&pmsg->sendFutex, seq, timeout);
+    }
+    epicsAtomicDecrIntT(&pmsg->sendWaiting);
+
+    if (!sent)
+        return -1;
+    if (fastPending(pmsg) < pmsg->capacity)
+        futexWake(&pmsg->sendWaiting, &pmsg->sendSignalled,
+            &pmsg->sendFutex);
+    return 0;
+}
+
+static int
+fastReceive(epicsMessageQueueId pmsg, void *message, unsigned int size,
+    double timeout)
+{
+    double deadline = 0.0;
+    int ret = fastGet(pmsg, message, size);
+
+    if (ret != -2)
+        return ret;
+    if (timeout == 0)
+        return -1;
+    if (timeout > 0)
+        deadline = monotonicNow() + timeout;
+
+    epicsAtomicIncrIntT(&pmsg->recvWaiting);
+    while (1) {
+        int seq = epicsAtomicGetIntT(&pmsg->recvFutex);
+
+        /* allow the next wakeup before looking again */
+        epicsAtomicSetIntT(&pmsg->recvSignalled, 0);
+        ret = fastGet(pmsg, message, size);
+        if (ret != -2)
+            break;
+        if (timeout > 0) {
+            timeout = deadline - monotonicNow();
+            if (timeout <= 0)
+                break;
+        }
+        futexWait(&pmsg->recvFutex, seq, timeout);
+    }
+    epicsAtomicDecrIntT(&pmsg->recvWaiting);
+
+    if (ret == -2)
+        return -1;
+    if (fastPending(pmsg) > 0)
+        futexWake(&pmsg->recvWaiting, &pmsg->recvSignalled,
+            &pmsg->recvFutex);
+    return ret;
+}
+
+#endif /* MQ_FAST_PATH */
+
 LIBCOM_API epicsMessageQueueId epicsStdCall epicsMessageQueueCreate(
     unsigned int capacity,
     unsigned int maxMessageSize)
@@ -91,6 +371,17 @@ LIBCOM_API epicsMessageQueueId epicsStdCall epicsMessageQueueCreate(
 
     pmsg->capacity = capacity;
     pmsg->maxMessageSize = maxMessageSize;
+
+#ifdef MQ_FAST_PATH
+    if (maxMessageSize <= MQ_FAST_MAX_SIZE) {
+        if (!fastCreate(pmsg)) {
+            free(pmsg);
+            return NULL;
+        }
+        return pmsg;
+    }
+#endif
+
     slotLongs = 1 + ((maxMessageSize + sizeof(unsigned long) - 1) / sizeof(unsigned long));
     slotBytes = slotLongs * sizeof(unsigned long);
 
@@ -127,6 +418,14 @@ epicsMessageQueueDestroy(epicsMessageQueueId pmsg)
 {
     struct eventNode *evp;
 
+#ifdef MQ_FAST_PATH
+    if (pmsg->ring) {
+        free(pmsg->ring);
+        free(pmsg);
+        return;
+    }
+#endif
+
     while ((evp = reinterpret_cast < struct eventNode * >
             ( ellGet(&pmsg->eventFreeList) ) ) != NULL) {
         destroyEventNode(evp);
@@ -175,6 +474,11 @@ mySend(epicsMessageQueueId pmsg, void *message, unsigned int size,
     if(size > pmsg->maxMessageSize)
         return -1;
 
+#ifdef MQ_FAST_PATH
+    if (pmsg->ring)
+        return fastSend(pmsg, message, size, timeout);
+#endif
+
     /*
      * See if message can be sent
      */
@@ -290,6 +594,11 @@ myReceive(epicsMessageQueueId pmsg, void *message, unsigned int size,
     unsigned long l;
     struct threadNode *pthr;
 
+#ifdef MQ_FAST_PATH
+    if (pmsg->ring)
+        return fastReceive(pmsg, message, size, timeout);
+#endif
+
     /*
      * If there's a message on the queue, copy it
      */
@@ -410,6 +719,14 @@ epicsMessageQueuePending(epicsMessageQueueId pmsg)
     char *myInPtr, *myOutPtr;
     int nmsg;
 
+#ifdef MQ_FAST_PATH
+    if (pmsg->ring) {
+        size_t pending = fastPending(pmsg);
+
+        return pending > pmsg->capacity ? pmsg->capacity : (int)pending;
+    }
+#endif
+
     epicsMutexMustLock(pmsg->mutex);
     myInPtr = (char *)pmsg->inPtr;
     myOutPtr = (char *)pmsg->outPtr;
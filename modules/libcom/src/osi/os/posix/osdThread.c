@@ -438,6 +438,7 @@ static void * start_routine(void *arg)
     status = pthread_mutex_unlock(&listLock);
     checkStatusQuit(status,"pthread_mutex_unlock","start_routine");
     osdThreadHooksRun(pthreadInfo);
+    epicsExitInitThread ();
 
     (*pthreadInfo->createFunc)(pthreadInfo->createArg);
 
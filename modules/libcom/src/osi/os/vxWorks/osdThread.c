@@ -236,6 +236,7 @@ void epicsThreadEntry(EPICSTHREADFUNC func, void *parm)
     papTSD = NULL; /* Initialize for this thread */
 
     osdThreadHooksRun((epicsThreadId)tid);
+    epicsExitInitThread ();
 
     (*func)(parm);
 
@@ -138,6 +138,15 @@ LIBCOM_API int epicsJobMove(epicsJob* job, epicsThreadPool* pool);
  */
 LIBCOM_API int epicsJobQueue(epicsJob*);
 
+/* Adds several jobs of the same pool to the run queue,
+ * waking workers once for every 32 of them.
+ * Safe to call from a running job function.
+ * returns 0 for success, or the first error if any job was not queued.
+ * If no worker can be started, the jobs queued by this call are
+ * removed again, and S_pool_noThreads returned.
+ */
+LIBCOM_API int epicsJobQueueBatch(epicsJob **jobs, size_t njobs);
+
 /* Remove a job from the run queue if it is queued.
  * Safe to call from a running job function.
  * returns 0 if job was queued and now is not.
@@ -14,6 +14,7 @@
 #include "dbDefs.h"
 #include "errlog.h"
 #include "ellLib.h"
+#include "epicsTypes.h"
 #include "epicsThread.h"
 #include "epicsMutex.h"
 #include "epicsEvent.h"
@@ -24,10 +25,85 @@
 
 void *epicsJobArgSelfMagic = &epicsJobArgSelfMagic;
 
+/* Take the next job to run, preferably from the worker's own queue.
+ * The caller must run the job and call finishJob().
+ */
+static
+epicsJob* takeJob(poolQueue *own)
+{
+    epicsThreadPool *pool = own->pool;
+    unsigned int n = pool->conf.maxThreads;
+    unsigned int first = own - pool->queues;
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+        poolQueue *q = &pool->queues[(first + i) % n];
+        ELLNODE *cur;
+        epicsJob *job;
+
+        if (ellCount(&q->jobs) == 0)
+            continue; /* unlocked peek, checked again below */
+
+        epicsMutexMustLock(q->lock);
+        cur = i ? ellLast(&q->jobs) : ellFirst(&q->jobs);
+        if (!cur) {
+            epicsMutexUnlock(q->lock);
+            continue;
+        }
+        ellDelete(&q->jobs, cur);
+        epicsAtomicDecrIntT(&pool->jobsQueued);
+        if (i)
+            q->stolen++;
+
+        job = CONTAINER(cur, epicsJob, queuenode);
+        assert(job->queued && !job->running);
+        job->queued = 0;
+        job->running = 1;
+        epicsMutexUnlock(q->lock);
+        return job;
+    }
+    return NULL;
+}
+
+static
+void addToQueue(poolQueue *q, epicsJob *job)
+{
+    ellAdd(&q->jobs, &job->queuenode);
+    q->added++;
+    if (ellCount(&q->jobs) > q->maxLength)
+        q->maxLength = ellCount(&q->jobs);
+    epicsAtomicIncrIntT(&q->pool->jobsQueued);
+}
+
+static
+void finishJob(epicsJob *job)
+{
+    poolQueue *q = job->home;
+    epicsThreadPool *pool = job->pool;
+
+    epicsMutexMustLock(q->lock);
+    if (job->freewhendone) {
+        job->dead = 1;
+        epicsMutexUnlock(q->lock);
+
+        epicsMutexMustLock(pool->guard);
+        ellDelete(&pool->owned, &job->jobnode);
+        epicsMutexUnlock(pool->guard);
+        free(job);
+        return;
+    }
+    job->running = 0;
+    /* job may be re-queued from within callback */
+    if (job->queued)
+        addToQueue(q, job);
+    epicsMutexUnlock(q->lock);
+}
+
 static
 void workerMain(void *arg)
 {
-    epicsThreadPool *pool = arg;
+    poolQueue *own = arg;
+    epicsThreadPool *pool = own->pool;
     unsigned int nrun, ocnt;
 
     /* workers are created with counts
@@ -39,68 +115,76 @@ void workerMain(void *arg)
     pool->threadsSleeping--;
 
     while (1) {
-        ELLNODE *cur;
+        epicsJob *job;
+        int woken = 0, ran = 0;
 
         pool->threadsAreAwake--;
         pool->threadsSleeping++;
-        epicsMutexUnlock(pool->guard);
+        UPDATEWAKEABLE(pool);
+
+        if (!pool->pauserun && !pool->shutdown &&
+                pool->threadsWaking < pool->threadsSleeping &&
+                epicsAtomicGetIntT(&pool->jobsQueued) > 0) {
+            /* a job was queued after this worker stopped looking,
+             * and the producer may not have seen us sleeping.
+             * If a wakeup is already pending, just take it.
+             */
+            pool->threadsSleeping--;
+            pool->threadsAreAwake++;
+            UPDATEWAKEABLE(pool);
+        }
+        else {
+            epicsMutexUnlock(pool->guard);
 
-        epicsEventMustWait(pool->workerWakeup);
+            epicsEventMustWait(pool->workerWakeup);
 
-        epicsMutexMustLock(pool->guard);
-        pool->threadsSleeping--;
-        pool->threadsAreAwake++;
+            epicsMutexMustLock(pool->guard);
+            pool->threadsSleeping--;
+            pool->threadsAreAwake++;
 
-        if (pool->threadsWaking==0)
-            continue;
+            if (pool->threadsWaking==0) {
+                UPDATEWAKEABLE(pool);
+                continue;
+            }
 
-        pool->threadsWaking--;
+            pool->threadsWaking--;
+            pool->wakeups++;
+            woken = 1;
 
-        CHECKCOUNT(pool);
+            CHECKCOUNT(pool);
 
-        if (pool->shutdown)
-            break;
+            if (pool->shutdown)
+                break;
 
-        if (pool->pauserun)
-            continue;
+            if (pool->pauserun)
+                continue;
 
-        /* more threads to wakeup */
-        if (pool->threadsWaking) {
-            epicsEventSignal(pool->workerWakeup);
+            /* more threads to wakeup */
+            if (pool->threadsWaking) {
+                epicsEventSignal(pool->workerWakeup);
+            }
         }
 
-        while ((cur=ellGet(&pool->jobs)) != NULL) {
-            epicsJob *job = CONTAINER(cur, epicsJob, jobnode);
-
-            assert(job->queued && !job->running);
-
-            job->queued=0;
-            job->running=1;
+        epicsMutexUnlock(pool->guard);
 
-            epicsMutexUnlock(pool->guard);
+        while ((job = takeJob(own)) != NULL) {
             (*job->func)(job->arg, epicsJobModeRun);
-            epicsMutexMustLock(pool->guard);
-
-            if (job->freewhendone) {
-                job->dead=1;
-                free(job);
-            }
-            else {
-                job->running=0;
-                /* job may be re-queued from within callback */
-                if (job->queued)
-                    ellAdd(&pool->jobs, &job->jobnode);
-                else
-                    ellAdd(&pool->owned, &job->jobnode);
-            }
+            finishJob(job);
+            ran = 1;
         }
 
+        epicsMutexMustLock(pool->guard);
+
+        if (woken && !ran)
+            pool->idleWakeups++;
+
         if (pool->observerCount)
             epicsEventSignal(pool->observerWakeup);
     }
 
     pool->threadsAreAwake--;
     pool->threadsRunning--;
+    UPDATEWAKEABLE(pool);
 
     nrun = pool->threadsRunning;
     ocnt = pool->observerCount;
@@ -119,11 +203,12 @@ int createPoolThread(epicsThreadPool *pool)
 {
     epicsThreadId tid;
 
+    /* workers only stop when the pool is destroyed */
     tid = epicsThreadCreate("PoolWorker",
                             pool->conf.workerPriority,
                             pool->conf.workerStack,
                             &workerMain,
-                            pool);
+                            &pool->queues[pool->threadsRunning]);
     if (!tid)
         return S_pool_noThreads;
 
@@ -132,6 +217,45 @@ int createPoolThread(epicsThreadPool *pool)
     return 0;
 }
 
+/* Wake up or create workers for njobs new jobs.  Called with guard held.
+ * Fails only if there is no worker at all to run the jobs.
+ */
+int wakePoolThreads(epicsThreadPool *pool, int njobs)
+{
+    /* Since we hold the lock, we can be certain that all awake worker are
+     * executing work functions.  The current thread may be a worker.
+     * We prefer to wakeup a new worker rather then wait for a busy worker to
+     * finish.  However, after we initiate a wakeup there will be a race
+     * between the worker waking up, and a busy worker finishing.
+     * Thus we can't avoid spurious wakeups.
+     */
+    int ret = 0;
+
+    while (njobs-- > 0) {
+        if (pool->threadsWaking >= pool->threadsSleeping) {
+            /* all sleeping workers have already been woken.
+             * start a new worker for this job, or else one of the
+             * running workers will find it before sleeping
+             */
+            if (pool->threadsRunning >= pool->conf.maxThreads)
+                break;
+            if (createPoolThread(pool)) {
+                /* oops, we couldn't lazy create our first worker
+                 * so this job would never run!
+                 */
+                if (pool->threadsRunning == 0)
+                    ret = S_pool_noThreads;
+                break;
+            }
+        }
+        pool->threadsWaking++;
+        epicsEventSignal(pool->workerWakeup);
+    }
+    UPDATEWAKEABLE(pool);
+    CHECKCOUNT(pool);
+    return ret;
+}
+
 epicsJob* epicsJobCreate(epicsThreadPool *pool,
                          epicsJobFunction func,
                          void *arg)
@@ -153,6 +277,21 @@ epicsJob* epicsJobCreate(epicsThreadPool *pool,
     return job;
 }
 
+/* Remove a job from its run queue, called with the home queue locked */
+static
+int unqueueJob(epicsJob *job)
+{
+    if (!job->queued)
+        return S_pool_jobIdle;
+
+    if (!job->running) {
+        ellDelete(&job->home->jobs, &job->queuenode);
+        epicsAtomicDecrIntT(&job->pool->jobsQueued);
+    }
+    job->queued = 0;
+    return 0;
+}
+
 void epicsJobDestroy(epicsJob *job)
 {
     epicsThreadPool *pool;
@@ -162,22 +301,24 @@ void epicsJobDestroy(epicsJob *job)
     }
     pool = job->pool;
 
-    epicsMutexMustLock(pool->guard);
+    epicsMutexMustLock(job->home->lock);
 
     assert(!job->dead);
 
-    epicsJobUnqueue(job);
+    unqueueJob(job);
 
     if (job->running || job->freewhendone) {
         job->freewhendone = 1;
+        epicsMutexUnlock(job->home->lock);
+        return;
     }
-    else {
-        ellDelete(&pool->owned, &job->jobnode);
-        job->dead = 1;
-        free(job);
-    }
+    job->dead = 1;
+    epicsMutexUnlock(job->home->lock);
 
+    epicsMutexMustLock(pool->guard);
+    ellDelete(&pool->owned, &job->jobnode);
     epicsMutexUnlock(pool->guard);
+    free(job);
 }
 
 int epicsJobMove(epicsJob *job, epicsThreadPool *newpool)
@@ -186,25 +327,32 @@ int epicsJobMove(epicsJob *job, epicsThreadPool *newpool)
 
     /* remove from current pool */
     if (pool) {
-        epicsMutexMustLock(pool->guard);
+        int busy;
 
-        if (job->queued || job->running) {
+        /* the guard is taken before any queue lock, hold both so the job
+         * can't be queued between the check and its removal */
+        epicsMutexMustLock(pool->guard);
+        epicsMutexMustLock(job->home->lock);
+        busy = job->queued || job->running;
+        epicsMutexUnlock(job->home->lock);
+        if (busy) {
             epicsMutexUnlock(pool->guard);
             return S_pool_jobBusy;
         }
-
         ellDelete(&pool->owned, &job->jobnode);
-
         epicsMutexUnlock(pool->guard);
     }
 
     pool = job->pool = newpool;
+    job->home = NULL;
 
     /* add to new pool */
     if (pool) {
         epicsMutexMustLock(pool->guard);
 
         ellAdd(&pool->owned, &job->jobnode);
+        /* spread the jobs over all queues */
+        job->home = &pool->queues[pool->nextQueue++ % pool->conf.maxThreads];
 
         epicsMutexUnlock(pool->guard);
     }
@@ -212,116 +360,154 @@ int epicsJobMove(epicsJob *job, epicsThreadPool *newpool)
     return 0;
 }
 
-int epicsJobQueue(epicsJob *job)
+/* Put a job into its home queue.  Returns 1 if a worker may
+ * need to be woken up, 0 if not, or an error status.
+ */
+static
+int queueJob(epicsJob *job)
 {
-    int ret = 0;
     epicsThreadPool *pool = job->pool;
+    int ret = 0;
 
     if (!pool)
         return S_pool_noPool;
 
-    epicsMutexMustLock(pool->guard);
+    epicsMutexMustLock(job->home->lock);
 
     assert(!job->dead);
 
-    if (pool->pauseadd) {
+    if (epicsAtomicGetIntT(&pool->pauseadd)) {
         ret = S_pool_paused;
-        goto done;
     }
     else if (job->freewhendone) {
         ret = S_pool_jobBusy;
-        goto done;
     }
-    else if (job->queued) {
-        goto done;
+    else if (!job->queued) {
+        job->queued = 1;
+        /* Job may be queued from within a callback,
+         * then some worker will find it again before sleeping
+         */
+        if (!job->running) {
+            addToQueue(job->home, job);
+            ret = 1;
+        }
     }
 
-    job->queued = 1;
-    /* Job may be queued from within a callback */
-    if (!job->running) {
-        ellDelete(&pool->owned, &job->jobnode);
-        ellAdd(&pool->jobs, &job->jobnode);
-    }
-    else {
-        /* some worker will find it again before sleeping */
-        goto done;
+    epicsMutexUnlock(job->home->lock);
+    return ret;
+}
+
+/* Undo queueJob() of the jobs selected by mask, if there is no worker
+ * to run them.  Jobs which were already queued before are left alone.
+ */
+static
+void unqueueJobs(epicsJob **jobs, size_t njobs, epicsUInt32 mask)
+{
+    size_t i;
+
+    for (i = 0; i < njobs; i++) {
+        if (!(mask & (1u << i)))
+            continue;
+        epicsMutexMustLock(jobs[i]->home->lock);
+        unqueueJob(jobs[i]);
+        epicsMutexUnlock(jobs[i]->home->lock);
     }
+}
 
-    /* Since we hold the lock, we can be certain that all awake worker are
-     * executing work functions.  The current thread may be a worker.
-     * We prefer to wakeup a new worker rather then wait for a busy worker to
-     * finish.  However, after we initiate a wakeup there will be a race
-     * between the worker waking up, and a busy worker finishing.
-     * Thus we can't avoid spurious wakeups.
+int epicsJobQueue(epicsJob *job)
+{
+    epicsThreadPool *pool = job->pool;
+    int ret = queueJob(job);
+
+    if (ret != 1)
+        return ret;
+
+    /* The queued job is counted in jobsQueued before this test, and
+     * workers count themselves as sleeping before testing jobsQueued,
+     * so at least one side will notice the other.
      */
+    if (epicsAtomicGetIntT(&pool->wakeable) <= 0)
+        return 0;
 
-    if (pool->threadsRunning >= pool->conf.maxThreads) {
-        /* all workers created... */
-        /* ... but some are sleeping, so wake one up */
-        if (pool->threadsWaking < pool->threadsSleeping) {
-            pool->threadsWaking++;
-            epicsEventSignal(pool->workerWakeup);
-        }
-        /*else one of the running workers will find this job before sleeping */
-        CHECKCOUNT(pool);
+    epicsMutexMustLock(pool->guard);
+    ret = wakePoolThreads(pool, 1);
+    epicsMutexUnlock(pool->guard);
 
-    }
-    else {
-        /* could create more workers so
-         * will either create a new worker, or wakeup an existing worker
-         */
+    if (ret)
+        unqueueJobs(&job, 1, 1u);
+    return ret;
+}
 
-        if (pool->threadsWaking >= pool->threadsSleeping) {
-            /* all sleeping workers have already been woken.
-             * start a new worker for this job
-             */
-            if (createPoolThread(pool) && pool->threadsRunning == 0) {
-                /* oops, we couldn't lazy create our first worker
-                 * so this job would never run!
-                 */
-                ret = S_pool_noThreads;
-                job->queued = 0;
-                /* if threadsRunning==0 then no jobs can be running */
-                assert(!job->running);
-                ellDelete(&pool->jobs, &job->jobnode);
-                ellAdd(&pool->owned, &job->jobnode);
+/* Jobs of a batch are queued and their workers woken in chunks, so that
+ * the jobs queued by this call are known if waking fails.
+ */
+#define BATCH_CHUNK 32u
+
+int epicsJobQueueBatch(epicsJob **jobs, size_t njobs)
+{
+    epicsThreadPool *pool = NULL;
+    int ret = 0;
+    size_t start, i;
+
+    for (start = 0; start < njobs; start += BATCH_CHUNK) {
+        size_t n = njobs - start;
+        epicsUInt32 mine = 0u;
+        int nwake = 0;
+
+        if (n > BATCH_CHUNK)
+            n = BATCH_CHUNK;
+
+        for (i = 0; i < n; i++) {
+            epicsJob *job = jobs[start + i];
+            int status;
+
+            if (!pool) {
+                pool = job->pool;
+            }
+            else if (job->pool != pool) {
+                if (!ret)
+                    ret = S_pool_noPool;
+                continue;
+            }
+            status = queueJob(job);
+            if (status == 1) {
+                mine |= 1u << i;
+                nwake++;
+            }
+            else if (status && !ret) {
+                ret = status;
             }
         }
-        if (ret == 0) {
-            pool->threadsWaking++;
-            epicsEventSignal(pool->workerWakeup);
+
+        if (!nwake || epicsAtomicGetIntT(&pool->wakeable) <= 0)
+            continue;
+
+        epicsMutexMustLock(pool->guard);
+        if (wakePoolThreads(pool, nwake)) {
+            epicsMutexUnlock(pool->guard);
+            unqueueJobs(&jobs[start], n, mine);
+            return S_pool_noThreads;
         }
-        CHECKCOUNT(pool);
+        epicsMutexUnlock(pool->guard);
     }
-
-done:
-    epicsMutexUnlock(pool->guard);
     return ret;
 }
 
 int epicsJobUnqueue(epicsJob *job)
 {
-    int ret = S_pool_jobIdle;
+    int ret;
     epicsThreadPool *pool = job->pool;
 
     if (!pool)
         return S_pool_noPool;
 
-    epicsMutexMustLock(pool->guard);
+    epicsMutexMustLock(job->home->lock);
 
     assert(!job->dead);
 
-    if (job->queued) {
-        if (!job->running) {
-            ellDelete(&pool->jobs, &job->jobnode);
-            ellAdd(&pool->owned, &job->jobnode);
-        }
-        job->queued = 0;
-        ret = 0;
-    }
+    ret = unqueueJob(job);
 
-    epicsMutexUnlock(pool->guard);
+    epicsMutexUnlock(job->home->lock);
 
     return ret;
 }
-
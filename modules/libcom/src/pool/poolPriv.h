@@ -14,13 +14,39 @@
 #include "epicsThread.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
+#include "epicsAtomic.h"
+
+/* Run queue of one worker.  Jobs are added at the tail and run from
+ * the head by the worker which owns the queue.  Workers with nothing
+ * to do steal jobs from the tail of other queues.
+ */
+typedef struct poolQueue {
+    epicsMutexId lock;
+    ELLLIST jobs;
+    struct epicsThreadPool *pool;
+
+    /* statistics, protected by lock */
+    size_t added;   /* # of jobs ever queued here */
+    size_t stolen;  /* # of those run by other workers */
+    int maxLength;  /* longest the queue has been */
+} poolQueue;
 
 struct epicsThreadPool {
     ELLNODE sharedNode;
     size_t sharedCount;
 
-    ELLLIST jobs; /* run queue */
-    ELLLIST owned; /* unqueued jobs. */
+    ELLLIST owned; /* all jobs of this pool */
+
+    /* One run queue for each possible worker, worker i owns queues[i] */
+    poolQueue *queues;
+    unsigned int nextQueue;
+
+    /* # of jobs in all run queues, changed with the queue lock held */
+    int jobsQueued;
+    /* # of workers which could be woken up or created, a hint for
+     * epicsJobQueue() which only locks guard if this is non-zero
+     */
+    int wakeable;
 
     /* Worker state counters.
      * The life cycle of a worker is
@@ -45,8 +71,8 @@ struct epicsThreadPool {
 
     epicsEventId observerWakeup;
 
-    /* Disallow epicsJobQueue */
-    unsigned int pauseadd:1;
+    /* Disallow epicsJobQueue, read without locking */
+    int pauseadd;
     /* Prevent workers from running new jobs */
     unsigned int pauserun:1;
     /* Prevent further changes to pool options */
@@ -54,12 +80,25 @@ struct epicsThreadPool {
     /* tell workers to exit */
     unsigned int shutdown:1;
 
+    /* statistics */
+    size_t wakeups; /* # of times a sleeping worker was woken */
+    size_t idleWakeups; /* # of those which didn't run a job */
+
     epicsMutexId guard;
 
     /* copy of config passed when created */
     epicsThreadPoolConfig conf;
 };
 
+/* Update the wakeable hint after changing any of the worker counters.
+ * Uses an atomic add to order this with the jobsQueued test after it.
+ */
+#define UPDATEWAKEABLE(pPool) \
+    epicsAtomicAddIntT(&(pPool)->wakeable, \
+        (int)((pPool)->threadsSleeping - (pPool)->threadsWaking + \
+            (pPool)->conf.maxThreads - (pPool)->threadsRunning) - \
+        (pPool)->wakeable)
+
 /* Called after manipulating counters to check that invariants are preserved */
 #define CHECKCOUNT(pPool) do { \
     if (!(pPool)->shutdown) { \
@@ -68,26 +107,29 @@ struct epicsThreadPool {
     } \
 } while(0)
 
-/* When created a job is idle.  queued and running are false
- * and jobnode is in the thread pool's owned list.
+/* A job is in the owned list of its pool from creation until it is
+ * freed or moved to another pool.  Each job has a home run queue, and
+ * the flags below are protected by the lock of that queue.
+ *
+ * When created a job is idle.  queued and running are false.
  *
- * When the job is added, the queued flag is set and jobnode
- * is in the jobs list.
+ * When the job is added, the queued flag is set and queuenode
+ * is in the jobs list of its home queue.
  *
- * When the job starts running the queued flag is cleared and
- * the running flag is set.  jobnode is not in any list
- * (held locally by worker).
+ * When a worker takes the job the queued flag is cleared and
+ * the running flag is set.
  *
  * When the job has finished running, the running flag is cleared.
- * The queued flag may be set if the job re-added itself.
- * Based on the queued flag jobnode is added to the appropriate
- * list.
+ * The queued flag may be set if the job re-added itself, in which
+ * case it goes back into its home queue.
  */
 struct epicsJob {
     ELLNODE jobnode;
+    ELLNODE queuenode;
     epicsJobFunction func;
     void *arg;
     epicsThreadPool *pool;
+    poolQueue *home;
 
     unsigned int queued:1;
     unsigned int running:1;
@@ -100,6 +142,7 @@ extern "C" {
 #endif
 
 int createPoolThread(epicsThreadPool *pool);
+int wakePoolThreads(epicsThreadPool *pool, int njobs);
 
 #ifdef __cplusplus
 }
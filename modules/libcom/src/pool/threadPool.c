@@ -67,10 +67,23 @@ epicsThreadPool* epicsThreadPoolCreate(epicsThreadPoolConfig *opts)
        !pool->observerWakeup || !pool->guard)
         goto cleanup;
 
-    ellInit(&pool->jobs);
     ellInit(&pool->owned);
 
+    pool->queues = calloc(pool->conf.maxThreads, sizeof(*pool->queues));
+    if (!pool->queues)
+        goto cleanup;
+    for (i = 0; i < pool->conf.maxThreads; i++) {
+        poolQueue *q = &pool->queues[i];
+
+        q->lock = epicsMutexCreate();
+        if (!q->lock)
+            goto cleanup;
+        ellInit(&q->jobs);
+        q->pool = pool;
+    }
+
     epicsMutexMustLock(pool->guard);
+    UPDATEWAKEABLE(pool);
 
     for (i = 0; i < pool->conf.initialThreads; i++) {
         createPoolThread(pool);
@@ -92,6 +105,13 @@ epicsThreadPool* epicsThreadPoolCreate(epicsThreadPoolConfig *opts)
     return pool;
 
 cleanup:
+    if (pool->queues) {
+        for (i = 0; i < pool->conf.maxThreads; i++) {
+            if (pool->queues[i].lock)
+                epicsMutexDestroy(pool->queues[i].lock);
+        }
+        free(pool->queues);
+    }
     if (pool->workerWakeup)
         epicsEventDestroy(pool->workerWakeup);
     if (pool->shutdownEvent)
@@ -112,38 +132,19 @@ void epicsThreadPoolControlImpl(epicsThreadPool *pool, epicsThreadPoolOption opt
         return;
 
     if (opt == epicsThreadPoolQueueAdd) {
-        pool->pauseadd = !val;
+        epicsAtomicSetIntT(&pool->pauseadd, !val);
     }
     else if (opt == epicsThreadPoolQueueRun) {
         if (!val && !pool->pauserun)
             pool->pauserun = 1;
 
         else if (val && pool->pauserun) {
-            int jobs = ellCount(&pool->jobs);
             pool->pauserun = 0;
 
-            if (jobs) {
-                int wakeable = pool->threadsSleeping - pool->threadsWaking;
-
-                /* first try to give jobs to sleeping workers */
-                if (wakeable) {
-                    int wakeup = jobs > wakeable ? wakeable : jobs;
-                    assert(wakeup > 0);
-                    jobs -= wakeup;
-                    pool->threadsWaking += wakeup;
-                    epicsEventSignal(pool->workerWakeup);
-                    CHECKCOUNT(pool);
-                }
-            }
-            while (jobs-- && pool->threadsRunning < pool->conf.maxThreads) {
-                if (createPoolThread(pool) == 0) {
-                    pool->threadsWaking++;
-                    epicsEventSignal(pool->workerWakeup);
-                }
-                else
-                    break; /* oops, couldn't create worker */
-            }
-            CHECKCOUNT(pool);
+            /* first try to give jobs to sleeping workers,
+             * then create more
+             */
+            wakePoolThreads(pool, epicsAtomicGetIntT(&pool->jobsQueued));
         }
     }
     /* unknown options ignored */
@@ -162,7 +163,8 @@ int epicsThreadPoolWait(epicsThreadPool *pool, double timeout)
     int ret = 0;
     epicsMutexMustLock(pool->guard);
 
-    while (ellCount(&pool->jobs) > 0 || pool->threadsAreAwake > 0) {
+    while (epicsAtomicGetIntT(&pool->jobsQueued) > 0 ||
+            pool->threadsAreAwake > 0) {
         pool->observerCount++;
         epicsMutexUnlock(pool->guard);
 
@@ -199,7 +201,7 @@ int epicsThreadPoolWait(epicsThreadPool *pool, double timeout)
 
 void epicsThreadPoolDestroy(epicsThreadPool *pool)
 {
-    unsigned int nThr;
+    unsigned int i, nThr;
     ELLLIST notify;
     ELLNODE *cur;
 
@@ -230,8 +232,8 @@ void epicsThreadPoolDestroy(epicsThreadPool *pool)
         epicsEventSignal(pool->workerWakeup);
     }
 
+    /* no job is queued or running now */
     ellConcat(&notify, &pool->owned);
-    ellConcat(&notify, &pool->jobs);
 
     epicsMutexUnlock(pool->guard);
 
@@ -251,10 +253,16 @@ void epicsThreadPoolDestroy(epicsThreadPool *pool)
         job->running = 0;
         if (job->freewhendone)
             free(job);
-        else
+        else {
             job->pool = NULL; /* orphan */
+            job->home = NULL;
+        }
     }
 
+    for (i = 0; i < pool->conf.maxThreads; i++)
+        epicsMutexDestroy(pool->queues[i].lock);
+    free(pool->queues);
+
     epicsEventDestroy(pool->workerWakeup);
     epicsEventDestroy(pool->shutdownEvent);
     epicsEventDestroy(pool->observerWakeup);
@@ -267,34 +275,49 @@ void epicsThreadPoolDestroy(epicsThreadPool *pool)
 void epicsThreadPoolReport(epicsThreadPool *pool, FILE *fd)
 {
     ELLNODE *cur;
+    unsigned int i;
     epicsMutexMustLock(pool->guard);
 
     fprintf(fd, "Thread Pool with %u/%u threads\n"
             " running %d jobs with %u threads\n",
             pool->threadsRunning,
             pool->conf.maxThreads,
-            ellCount(&pool->jobs),
+            epicsAtomicGetIntT(&pool->jobsQueued),
             pool->threadsAreAwake);
-    if (pool->pauseadd)
+    fprintf(fd, " %lu wakeups, %lu idle\n",
+            (unsigned long)pool->wakeups,
+            (unsigned long)pool->idleWakeups);
+    if (epicsAtomicGetIntT(&pool->pauseadd))
         fprintf(fd, "  Inhibit queueing\n");
     if (pool->pauserun)
         fprintf(fd, "  Pause workers\n");
     if (pool->shutdown)
         fprintf(fd, "  Shutdown in progress\n");
 
-    for (cur = ellFirst(&pool->jobs); cur; cur = ellNext(cur)) {
-        epicsJob *job = CONTAINER(cur, epicsJob, jobnode);
+    for (i = 0; i < pool->conf.maxThreads; i++) {
+        poolQueue *q = &pool->queues[i];
 
-        fprintf(fd, "  job %p func: %p, arg: %p ",
-                job, job->func,
-                job->arg);
-        if (job->queued)
-            fprintf(fd, "Queued ");
-        if (job->running)
-            fprintf(fd, "Running ");
-        if (job->freewhendone)
-            fprintf(fd, "Free ");
-        fprintf(fd, "\n");
+        epicsMutexMustLock(q->lock);
+        if (q->added) {
+            fprintf(fd, "  queue %u length: %d, max: %d, added: %lu, stolen: %lu\n",
+                    i, ellCount(&q->jobs), q->maxLength,
+                    (unsigned long)q->added, (unsigned long)q->stolen);
+        }
+        for (cur = ellFirst(&q->jobs); cur; cur = ellNext(cur)) {
+            epicsJob *job = CONTAINER(cur, epicsJob, queuenode);
+
+            fprintf(fd, "  job %p func: %p, arg: %p ",
+                    job, job->func,
+                    job->arg);
+            if (job->queued)
+                fprintf(fd, "Queued ");
+            if (job->running)
+                fprintf(fd, "Running ");
+            if (job->freewhendone)
+                fprintf(fd, "Free ");
+            fprintf(fd, "\n");
+        }
+        epicsMutexUnlock(q->lock);
     }
 
     epicsMutexUnlock(pool->guard);
@@ -0,0 +1,263 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Bounded multi-producer/multi-consumer queue after Dmitry Vyukov.
+ *
+ * Each cell carries a sequence number which tells producers and
+ * consumers whose turn it is.  A producer claims position pos by moving
+ * enqueuePos from pos to pos+1 when the cell's sequence equals pos, and
+ * publishes the element by setting the sequence to pos+1.  A consumer
+ * claims the cell the same way through dequeuePos and hands it back to
+ * the producers of the next lap by setting the sequence to pos+size.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsRingMPMC.h"
+
+/* Keep the producer and consumer indices on separate cache lines */
+#define CACHE_LINE 64
+
+typedef struct epicsRingMPMC {
+    size_t          enqueuePos;
+    char            pad1[CACHE_LINE - sizeof(size_t)];
+    size_t          dequeuePos;
+    char            pad2[CACHE_LINE - sizeof(size_t)];
+    /* read only after creation */
+    size_t          mask;           /* size - 1 */
+    size_t          sampleMask;     /* see HWM_SAMPLE */
+    size_t          stride;         /* bytes per cell */
+    size_t          elemSize;
+    epicsEventId    wakeup;
+    char            *buffer;
+    char            pad3[CACHE_LINE - 4 * sizeof(size_t) - 2 * sizeof(void *)];
+    int             waiting;        /* consumers in epicsRingMPMCWait() */
+    int             highWaterMark;
+    size_t          retries;
+    size_t          wakeups;
+} ringMPMC;
+
+/* No lock protects the high water mark. A put only compares its usage
+ * with the mark when its enqueue position is a multiple of HWM_SAMPLE, so
+ * that producers filling the ring don't all contend for the mark. The put
+ * which fills the ring is usually not one of these; a put which finds the
+ * ring full sets the mark to the size instead.
+ */
+#define HWM_SAMPLE 16u
+
+#define CELL(pring, pos) \
+    ((size_t *)((pring)->buffer + ((pos) & (pring)->mask) * (pring)->stride))
+
+LIBCOM_API epicsRingMPMCId epicsStdCall epicsRingMPMCCreate(
+    int nelem, size_t elemSize)
+{
+    ringMPMC *pring;
+    size_t size = 2, i;
+
+    if (nelem <= 0 || elemSize == 0)
+        return NULL;
+    while (size < (size_t)nelem)
+        size <<= 1;
+
+    pring = calloc(1, sizeof(ringMPMC));
+    if (!pring)
+        return NULL;
+    pring->mask = size - 1;
+    pring->sampleMask = (size < HWM_SAMPLE ? size : HWM_SAMPLE) - 1;
+    pring->elemSize = elemSize;
+    /* sequence number followed by the element, keeping size_t alignment */
+    pring->stride = sizeof(size_t) *
+        (1 + (elemSize + sizeof(size_t) - 1) / sizeof(size_t));
+    pring->buffer = malloc(size * pring->stride);
+    pring->wakeup = epicsEventCreate(epicsEventEmpty);
+    if (!pring->buffer || !pring->wakeup) {
+        if (pring->wakeup)
+            epicsEventDestroy(pring->wakeup);
+        free(pring->buffer);
+        free(pring);
+        return NULL;
+    }
+    for (i = 0; i < size; i++)
+        *CELL(pring, i) = i;
+    epicsAtomicWriteMemoryBarrier();
+    return pring;
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCDelete(epicsRingMPMCId pring)
+{
+    epicsEventDestroy(pring->wakeup);
+    free(pring->buffer);
+    free(pring);
+}
+
+static void updateHighWaterMark(ringMPMC *pring, size_t pos)
+{
+    ptrdiff_t used;
+    int hwm;
+
+    if (pos & pring->sampleMask)
+        return;
+    used = (ptrdiff_t)(pos - epicsAtomicGetSizeT(&pring->dequeuePos));
+    hwm = epicsAtomicGetIntT(&pring->highWaterMark);
+
+    /* other threads may have moved dequeuePos past us meanwhile */
+    while (used > hwm && used <= (ptrdiff_t)pring->mask + 1) {
+        int prev = epicsAtomicCmpAndSwapIntT(&pring->highWaterMark,
+            hwm, (int)used);
+        if (prev == hwm)
+            break;
+        hwm = prev;
+    }
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCPut(
+    epicsRingMPMCId pring, const void *value)
+{
+    size_t pos = epicsAtomicGetSizeT(&pring->enqueuePos);
+    size_t *cell;
+
+    while (1) {
+        ptrdiff_t dif;
+
+        cell = CELL(pring, pos);
+        dif = (ptrdiff_t)(epicsAtomicGetSizeT(cell) - pos);
+        if (dif == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&pring->enqueuePos,
+                pos, pos + 1);
+            if (prev == pos)
+                break;
+            epicsAtomicIncrSizeT(&pring->retries);
+            pos = prev;
+        }
+        else if (dif < 0) {
+            /* full, cell still holds last lap's element */
+            epicsAtomicSetIntT(&pring->highWaterMark, (int)(pring->mask + 1));
+            return 0;
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&pring->enqueuePos);
+        }
+    }
+
+    memcpy(cell + 1, value, pring->elemSize);
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(cell, pos + 1);
+
+    updateHighWaterMark(pring, pos + 1);
+
+    /* The read-modify-write is a full barrier, which pairs with the
+     * increment in epicsRingMPMCWait() so that either we see the
+     * waiting consumer or it sees our element.
+     */
+    if (epicsAtomicAddIntT(&pring->waiting, 0) > 0) {
+        epicsAtomicIncrSizeT(&pring->wakeups);
+        epicsEventSignal(pring->wakeup);
+    }
+    return 1;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGet(
+    epicsRingMPMCId pring, void *value)
+{
+    size_t pos = epicsAtomicGetSizeT(&pring->dequeuePos);
+    size_t *cell;
+
+    while (1) {
+        ptrdiff_t dif;
+
+        cell = CELL(pring, pos);
+        dif = (ptrdiff_t)(epicsAtomicGetSizeT(cell) - (pos + 1));
+        if (dif == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&pring->dequeuePos,
+                pos, pos + 1);
+            if (prev == pos)
+                break;
+            epicsAtomicIncrSizeT(&pring->retries);
+            pos = prev;
+        }
+        else if (dif < 0) {
+            return 0;   /* empty, or producer not finished yet */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&pring->dequeuePos);
+        }
+    }
+
+    epicsAtomicReadMemoryBarrier();
+    memcpy(value, cell + 1, pring->elemSize);
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(cell, pos + pring->mask + 1);
+    return 1;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCIsEmpty(epicsRingMPMCId pring)
+{
+    size_t pos = epicsAtomicGetSizeT(&pring->dequeuePos);
+
+    return epicsAtomicGetSizeT(CELL(pring, pos)) != pos + 1;
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCWait(epicsRingMPMCId pring)
+{
+    epicsAtomicIncrIntT(&pring->waiting);
+    if (epicsRingMPMCIsEmpty(pring))
+        epicsEventMustWait(pring->wakeup);
+    epicsAtomicDecrIntT(&pring->waiting);
+
+    /* Signals from several producers may have been merged into the one
+     * which woke us, pass it on if there is work for another consumer.
+     */
+    if (!epicsRingMPMCIsEmpty(pring) &&
+        epicsAtomicGetIntT(&pring->waiting) > 0) {
+        epicsAtomicIncrSizeT(&pring->wakeups);
+        epicsEventSignal(pring->wakeup);
+    }
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCWakeup(epicsRingMPMCId pring)
+{
+    epicsEventSignal(pring->wakeup);
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetSize(epicsRingMPMCId pring)
+{
+    return (int)(pring->mask + 1);
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetUsed(epicsRingMPMCId pring)
+{
+    size_t deq = epicsAtomicGetSizeT(&pring->dequeuePos);
+    ptrdiff_t used = (ptrdiff_t)(epicsAtomicGetSizeT(&pring->enqueuePos) - deq);
+
+    if (used < 0)
+        return 0;
+    if (used > (ptrdiff_t)pring->mask + 1)
+        return (int)(pring->mask + 1);
+    return (int)used;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetHighWaterMark(epicsRingMPMCId pring)
+{
+    return epicsAtomicGetIntT(&pring->highWaterMark);
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCResetHighWaterMark(epicsRingMPMCId pring)
+{
+    epicsAtomicSetIntT(&pring->highWaterMark, epicsRingMPMCGetUsed(pring));
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCGetStats(
+    epicsRingMPMCId pring, epicsRingMPMCStats *stats)
+{
+    stats->puts = epicsAtomicGetSizeT(&pring->enqueuePos);
+    stats->retries = epicsAtomicGetSizeT(&pring->retries);
+    stats->wakeups = epicsAtomicGetSizeT(&pring->wakeups);
+}
@@ -0,0 +1,142 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/**
+ * \file epicsRingMPMC.h
+ * \brief A lock-free circular buffer for multiple producers and consumers
+ *
+ * \details
+ * epicsRingMPMC.h provides a C API for a bounded first in first out queue
+ * of fixed size elements which any number of producer and consumer threads
+ * can use simultaneously without a lock.  Put and get operations never
+ * block, and put may be called from interrupt context.
+ *
+ * Consumers which run out of work can sleep in epicsRingMPMCWait().
+ * Producers only signal the wakeup event when at least one consumer is
+ * actually sleeping, so a busy queue does not cost a wakeup per element.
+ *
+ * \note The number of elements is rounded up to a power of two.
+ * \since UNRELEASED
+ */
+
+#ifndef INCepicsRingMPMCh
+#define INCepicsRingMPMCh
+
+#include <stddef.h>
+
+#include "libComAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief An identifier for a lock-free ring buffer */
+typedef struct epicsRingMPMC *epicsRingMPMCId;
+
+/** \brief Activity counters of a lock-free ring buffer */
+typedef struct epicsRingMPMCStats {
+    /** \brief Number of elements put on the ring */
+    size_t puts;
+    /** \brief Number of put or get attempts retried due to contention */
+    size_t retries;
+    /** \brief Number of times a sleeping consumer had to be signalled */
+    size_t wakeups;
+} epicsRingMPMCStats;
+
+/**
+ * \brief Create a new ring buffer
+ * \param nelem Minimum number of elements the ring must hold
+ * \param elemSize Size of each element in bytes
+ * \return Ring buffer identifier or NULL on failure
+ */
+LIBCOM_API epicsRingMPMCId epicsStdCall epicsRingMPMCCreate(
+    int nelem, size_t elemSize);
+/**
+ * \brief Delete the ring buffer and free any associated memory
+ * \param id Ring buffer identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCDelete(epicsRingMPMCId id);
+/**
+ * \brief Copy an element into the ring buffer
+ *
+ * Wakes up one consumer if any are sleeping in epicsRingMPMCWait().
+ * \param id Ring buffer identifier
+ * \param value Element to be copied in, \c elemSize bytes
+ * \return 1 if the element was stored, 0 if the buffer was full
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCPut(
+    epicsRingMPMCId id, const void *value);
+/**
+ * \brief Copy the oldest element out of the ring buffer
+ * \param id Ring buffer identifier
+ * \param value Where to copy the element to, \c elemSize bytes
+ * \return 1 if an element was fetched, 0 if the buffer was empty
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGet(
+    epicsRingMPMCId id, void *value);
+/**
+ * \brief Wait until the ring buffer is not empty
+ *
+ * Returns immediately if an element is available.  May also return
+ * early after epicsRingMPMCWakeup(), so callers must be prepared for
+ * epicsRingMPMCGet() to find the ring empty.
+ * \param id Ring buffer identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCWait(epicsRingMPMCId id);
+/**
+ * \brief Unconditionally wake up a consumer sleeping in epicsRingMPMCWait()
+ * \param id Ring buffer identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCWakeup(epicsRingMPMCId id);
+/**
+ * \brief Return the number of elements the ring can hold
+ * \param id Ring buffer identifier
+ * \return \c nelem rounded up to a power of two
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetSize(epicsRingMPMCId id);
+/**
+ * \brief Return the number of elements stored in the ring buffer
+ *
+ * The value is only a snapshot while other threads are active.
+ * \param id Ring buffer identifier
+ * \return The number of elements stored in the ring buffer
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetUsed(epicsRingMPMCId id);
+/**
+ * \brief Check if the ring buffer is currently empty
+ * \param id Ring buffer identifier
+ * \return 1 if the ring is empty, otherwise 0
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCIsEmpty(epicsRingMPMCId id);
+/**
+ * \brief Get the Highwater mark of the ring buffer
+ *
+ * The mark is not kept exactly. To keep producers from contending for it,
+ * only a put which stores into every 16th position of the ring compares
+ * the usage with the mark, so it may be up to 15 elements below the
+ * actual peak. A put which fails because the ring is full always records
+ * it as full.
+ * \param id Ring buffer identifier
+ * \return Largest number of elements held since the last reset
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetHighWaterMark(epicsRingMPMCId id);
+/**
+ * \brief Reset the Highwater mark to the current usage
+ * \param id Ring buffer identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCResetHighWaterMark(epicsRingMPMCId id);
+/**
+ * \brief Read the activity counters of the ring buffer
+ * \param id Ring buffer identifier
+ * \param stats Where to store the counters
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCGetStats(
+    epicsRingMPMCId id, epicsRingMPMCStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCepicsRingMPMCh */
@@ -35,13 +35,28 @@ template class tsFreeList < timer, 0x20 >;
 #endif
 
 timer::timer ( timerQueue & queueIn ) :
-    queue ( queueIn ), curState ( stateLimbo ), pNotify ( 0 )
+    queue ( queueIn ), curState ( stateLimbo ), pNotify ( 0 ),
+    heapIndex ( 0u ), startSeq ( 0u )
 {
+    // so that start () never needs to allocate, growing geometrically
+    // so that creating many timers doesn't copy the heap each time
+    epicsGuard < epicsMutex > locker ( this->queue.mutex );
+    std::vector < timer * > & heap = this->queue.heap;
+    if ( this->queue.timerCount + 1u > heap.capacity () ) {
+        size_t newCapacity = 2u * heap.capacity ();
+        if ( newCapacity < 16u ) {
+            newCapacity = 16u;
+        }
+        heap.reserve ( newCapacity );
+    }
+    this->queue.timerCount++;
 }
 
 timer::~timer ()
 {
     this->cancel ();
+    epicsGuard < epicsMutex > locker ( this->queue.mutex );
+    this->queue.timerCount--;
 }
 
 void timer::destroy ()
@@ -67,57 +82,20 @@ void timer::privateStart ( epicsTimerNotify & notify, const epicsTime & expire )
     this->pNotify = & notify;
     this->exp = expire - ( this->queue.notify.quantum () / 2.0 );
 
-    bool reschedualNeeded = false;
     if ( this->curState == stateActive ) {
         // above expire time and notify will override any restart parameters
         // that may be returned from the timer expire callback
         return;
     }
     else if ( this->curState == statePending ) {
-        this->queue.timerList.remove ( *this );
-        if ( this->queue.timerList.first() == this &&
-                this->queue.timerList.count() > 0 ) {
-            reschedualNeeded = true;
-        }
-    }
-
-#   ifdef DEBUG
-        unsigned preemptCount=0u;
-#   endif
-
-    //
-    // insert into the pending queue
-    //
-    // Finds proper time sorted location using a linear search.
-    //
-    // **** this should use a binary tree ????
-    //
-    tsDLIter < timer > pTmr = this->queue.timerList.lastIter ();
-    while ( true ) {
-        if ( ! pTmr.valid () ) {
-            //
-            // add to the beginning of the list
-            //
-            this->queue.timerList.push ( *this );
-            reschedualNeeded = true;
-            break;
-        }
-        if ( pTmr->exp <= this->exp ) {
-            //
-            // add after the item found that expires earlier
-            //
-            this->queue.timerList.insertAfter ( *this, *pTmr );
-            break;
-        }
-#       ifdef DEBUG
-            preemptCount++;
-#       endif
-        --pTmr;
+        this->queue.remove ( *this );
     }
 
+    this->queue.insert ( *this );
     this->curState = timer::statePending;
 
-    if ( reschedualNeeded ) {
+    // the queue must wake up earlier if this is the new first timer
+    if ( this->heapIndex == 0u ) {
         this->queue.notify.reschedule ();
     }
 
@@ -126,26 +104,22 @@ void timer::privateStart ( epicsTimerNotify & notify, const epicsTime & expire )
         this->queue.show ( 10u );
 #   endif
 
-    debugPrintf ( ("Start of \"%s\" with delay %f at %p preempting %u\n",
+    debugPrintf ( ("Start of \"%s\" with delay %f at %p\n",
         typeid ( this->pNotify ).name (),
-        expire - epicsTime::getCurrent (), 
-        this, preemptCount ) );
+        expire - epicsTime::getCurrent (),
+        this ) );
 }
 
 void timer::cancel ()
 {
-    bool reschedual = false;
     bool wakeupCancelBlockingThreads = false;
     {
         epicsGuard < epicsMutex > locker ( this->queue.mutex );
         this->pNotify = 0;
         if ( this->curState == statePending ) {
-            this->queue.timerList.remove ( *this );
+            // the queue wakes up for nothing if this was the first timer
+            this->queue.remove ( *this );
             this->curState = stateLimbo;
-            if ( this->queue.timerList.first() == this &&
-                    this->queue.timerList.count() > 0 ) {
-                reschedual = true;
-            }
         }
         else if ( this->curState == stateActive ) {
             this->queue.cancelPending = true;
@@ -163,9 +137,6 @@ void timer::cancel ()
             }
         }
     }
-    if ( reschedual ) {
-        this->queue.notify.reschedule ();
-    }
     if ( wakeupCancelBlockingThreads ) {
         this->queue.cancelBlockingEvent.signal ();
     }
@@ -17,6 +17,7 @@
 #define epicsTimerPrivate_h
 
 #include <typeinfo>
+#include <vector>
 
 #include "tsFreeList.h"
 #include "epicsSingleton.h"
@@ -37,7 +38,7 @@
 
 template < class T > class epicsGuard;
 
-class timer : public epicsTimer, public tsDLNode < timer > {
+class timer : public epicsTimer {
 public:
     void destroy () override;
     void start ( class epicsTimerNotify &, const epicsTime & ) override final;
@@ -56,6 +57,8 @@ private:
     epicsTime exp; // expiration time
     state curState; // current state
     epicsTimerNotify * pNotify; // callback
+    unsigned heapIndex; // position in the queue while pending
+    unsigned startSeq; // orders timers with the same expiration time
     void privateStart ( epicsTimerNotify & notify, const epicsTime & );
     timer & operator = ( const timer & );
     // Visual C++ .net appears to require operator delete if
@@ -104,7 +107,11 @@ private:
     tsFreeList < epicsTimerForC, 0x20 > timerForCFreeList;
     mutable epicsMutex mutex;
     epicsEvent cancelBlockingEvent;
-    tsDLList < timer > timerList;
+    // pending timers, a binary heap ordered by expiration time with
+    // room for every timer of the queue reserved when it is created
+    std::vector < timer * > heap;
+    unsigned timerCount;
+    unsigned startCount;
     epicsTimerQueueNotify & notify;
     timer * pExpireTmr;
     epicsThreadId processThread;
@@ -113,6 +120,12 @@ private:
     static const double exceptMsgMinPeriod;
     void printExceptMsg ( const char * pName,
                 const type_info & type );
+    timer * first () const;
+    void insert ( timer & );
+    void remove ( timer & );
+    void siftUp ( unsigned index );
+    void siftDown ( unsigned index );
+    static bool earlier ( const timer &, const timer & );
     timerQueue ( const timerQueue & );
     timerQueue & operator = ( const timerQueue & );
     friend class timer;
@@ -241,6 +254,20 @@ inline unsigned timerQueueActive::threadPriority () const
     return thread.getPriority ();
 }
 
+inline timer * timerQueue::first () const
+{
+    return this->heap.empty () ? 0 : this->heap.front ();
+}
+
+inline bool timerQueue::earlier ( const timer & a, const timer & b )
+{
+    if ( a.exp != b.exp ) {
+        return a.exp < b.exp;
+    }
+    // first started expires first
+    return static_cast < int > ( a.startSeq - b.startSeq ) < 0;
+}
+
 inline void * timer::operator new ( size_t size,
                      tsFreeList < timer, 0x20 > & freeList )
 {
@@ -26,6 +26,8 @@ epicsTimerQueue::~epicsTimerQueue () {}
 
 timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
     mutex(__FILE__, __LINE__),
+    timerCount ( 0u ),
+    startCount ( 0u ),
     notify ( notifyIn ),
     pExpireTmr ( 0 ),
     processThread ( 0 ),
@@ -37,12 +39,76 @@ timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
 
 timerQueue::~timerQueue ()
 {
-    timer *pTmr;
-    while ( ( pTmr = this->timerList.get () ) ) {
-        pTmr->curState = timer::stateLimbo;
+    for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+        this->heap[i]->curState = timer::stateLimbo;
     }
 }
 
+void timerQueue::insert ( timer & tmr )
+{
+    tmr.startSeq = this->startCount++;
+    tmr.heapIndex = this->heap.size ();
+    this->heap.push_back ( & tmr );
+    this->siftUp ( tmr.heapIndex );
+}
+
+void timerQueue::remove ( timer & tmr )
+{
+    unsigned index = tmr.heapIndex;
+    timer * pLast = this->heap.back ();
+    this->heap.pop_back ();
+    if ( pLast != & tmr ) {
+        this->heap[index] = pLast;
+        pLast->heapIndex = index;
+        if ( index > 0u && earlier ( *pLast, *this->heap[(index - 1u) / 2u] ) ) {
+            this->siftUp ( index );
+        }
+        else {
+            this->siftDown ( index );
+        }
+    }
+}
+
+void timerQueue::siftUp ( unsigned index )
+{
+    timer * pTmr = this->heap[index];
+    while ( index > 0u ) {
+        unsigned parent = ( index - 1u ) / 2u;
+        if ( ! earlier ( *pTmr, *this->heap[parent] ) ) {
+            break;
+        }
+        this->heap[index] = this->heap[parent];
+        this->heap[index]->heapIndex = index;
+        index = parent;
+    }
+    this->heap[index] = pTmr;
+    pTmr->heapIndex = index;
+}
+
+void timerQueue::siftDown ( unsigned index )
+{
+    timer * pTmr = this->heap[index];
+    const unsigned count = this->heap.size ();
+    while ( true ) {
+        unsigned child = 2u * index + 1u;
+        if ( child >= count ) {
+            break;
+        }
+        if ( child + 1u < count &&
+                earlier ( *this->heap[child + 1u], *this->heap[child] ) ) {
+            child++;
+        }
+        if ( ! earlier ( *this->heap[child], *pTmr ) ) {
+            break;
+        }
+        this->heap[index] = this->heap[child];
+        this->heap[index]->heapIndex = index;
+        index = child;
+    }
+    this->heap[index] = pTmr;
+    pTmr->heapIndex = index;
+}
+
 void timerQueue ::
     printExceptMsg ( const char * pName, const type_info & type )
 {
@@ -83,7 +149,7 @@ double timerQueue::process ( const epicsTime & currentTime )
     if ( this->pExpireTmr ) {
         // if some other thread is processing the queue
         // (or if this is a recursive call)
-        timer * pTmr = this->timerList.first ();
+        timer * pTmr = this->first ();
         if ( pTmr ) {
             double delay = pTmr->exp - currentTime;
             if ( delay < 0.0 ) {
@@ -100,10 +166,10 @@ double timerQueue::process ( const epicsTime & currentTime )
     // Tag current expired tmr so that we can detect if call back
     // is in progress when canceling the timer.
     //
-    if ( this->timerList.first () ) {
-        if ( currentTime >= this->timerList.first ()->exp ) {
-            this->pExpireTmr = this->timerList.first ();
-            this->timerList.remove ( *this->pExpireTmr );
+    if ( this->first () ) {
+        if ( currentTime >= this->first ()->exp ) {
+            this->pExpireTmr = this->first ();
+            this->remove ( *this->pExpireTmr );
             this->pExpireTmr->curState = timer::stateActive;
             this->processThread = epicsThreadGetIdSelf ();
 #           ifdef DEBUG
@@ -111,7 +177,7 @@ double timerQueue::process ( const epicsTime & currentTime )
 #           endif
         }
         else {
-            double delay = this->timerList.first ()->exp - currentTime;
+            double delay = this->first ()->exp - currentTime;
             debugPrintf ( ( "no activity process %f to next\n", delay ) );
             return delay;
         }
@@ -178,17 +244,17 @@ double timerQueue::process ( const epicsTime & currentTime )
         }
         this->pExpireTmr = 0;
 
-        if ( this->timerList.first () ) {
-            if ( currentTime >= this->timerList.first ()->exp ) {
-                this->pExpireTmr = this->timerList.first ();
-                this->timerList.remove ( *this->pExpireTmr );
+        if ( this->first () ) {
+            if ( currentTime >= this->first ()->exp ) {
+                this->pExpireTmr = this->first ();
+                this->remove ( *this->pExpireTmr );
                 this->pExpireTmr->curState = timer::stateActive;
 #               ifdef DEBUG
                     this->pExpireTmr->show ( 0u );
 #               endif
             }
             else {
-                delay = this->timerList.first ()->exp - currentTime;
+                delay = this->first ()->exp - currentTime;
                 this->processThread = 0;
                 break;
             }
@@ -215,12 +281,12 @@ epicsTimerForC & timerQueue::createTimerForC ( epicsTimerCallback pCallback, voi
 void timerQueue::show ( unsigned level ) const
 {
     epicsGuard < epicsMutex > locker ( this->mutex );
-    printf ( "epicsTimerQueue with %u items pending\n", this->timerList.count () );
+    printf ( "epicsTimerQueue with %u items pending\n",
+        static_cast < unsigned > ( this->heap.size () ) );
     if ( level >= 1u ) {
-        tsDLIterConst < timer > iter = this->timerList.firstIter ();
-        while ( iter.valid () ) {
-            iter->show ( level - 1u );
-            ++iter;
+        // in heap order, not sorted
+        for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+            this->heap[i]->show ( level - 1u );
         }
     }
 }
@@ -334,6 +334,94 @@ private:
 };
 
 
+// Array conversions, as done for waveform fields read as DBF_STRING
+
+class ArrayPerf {
+public:
+    ArrayPerf ();
+    ~ArrayPerf ();
+    void execute ();
+protected:
+    static const unsigned nValues = 10000;
+    static const unsigned nIterations = 20;
+    static const size_t stride = 40;    // MAX_STRING_SIZE
+
+    double *dbls;
+    epicsInt32 *ints;
+    char *strs;
+
+    static void report (const char *name, double perElement, double bulk);
+
+private:
+    ArrayPerf ( const ArrayPerf & );
+    ArrayPerf & operator = ( ArrayPerf & );
+};
+
+ArrayPerf :: ArrayPerf () :
+    dbls ( new double [ nValues ] ),
+    ints ( new epicsInt32 [ nValues ] ),
+    strs ( new char [ nValues * stride ] )
+{
+    for ( unsigned i = 0; i < nValues; i++ ) {
+        double val = rand ();
+        val /= (RAND_MAX + 1.0);
+        dbls[i] = val * 2e6 - 1e6;
+        ints[i] = static_cast < epicsInt32 > ( dbls[i] * 1000.0 );
+    }
+}
+
+ArrayPerf :: ~ArrayPerf ()
+{
+    delete [] dbls;
+    delete [] ints;
+    delete [] strs;
+}
+
+void ArrayPerf :: report (const char *name, double perElement, double bulk)
+{
+    double count = double ( nValues ) * nIterations;
+
+    printf ( "%-28s %12.0f %12.0f values/sec\n", name,
+        count / perElement, count / bulk );
+}
+
+void ArrayPerf :: execute ()
+{
+    printf ( "Arrays of %u values\n\n%-28s %12s %12s\n", nValues,
+        "", "per element", "bulk" );
+
+    static const int precs[] = { 0, 2, 4, 6 };
+    for ( unsigned p = 0; p < sizeof(precs) / sizeof(precs[0]); p++ ) {
+        int prec = precs[p];
+
+        epicsTime beg = epicsTime :: getMonotonic ();
+        for ( unsigned n = 0; n < nIterations; n++ )
+            for ( unsigned i = 0; i < nValues; i++ )
+                cvtDoubleToString ( dbls[i], &strs[i * stride], prec );
+        epicsTime mid = epicsTime :: getMonotonic ();
+        for ( unsigned n = 0; n < nIterations; n++ )
+            cvtDoubleArrayToStrings ( dbls, nValues, strs, stride, prec );
+        epicsTime end = epicsTime :: getMonotonic ();
+
+        char name[40];
+        epicsSnprintf ( name, sizeof(name), "cvtDouble, prec=%d", prec );
+        report ( name, mid - beg, end - mid );
+    }
+
+    epicsTime beg = epicsTime :: getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        for ( unsigned i = 0; i < nValues; i++ )
+            cvtInt32ToString ( ints[i], &strs[i * stride] );
+    epicsTime mid = epicsTime :: getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        cvtInt32ArrayToStrings ( ints, nValues, strs, stride );
+    epicsTime end = epicsTime :: getMonotonic ();
+
+    report ( "cvtInt32", mid - beg, end - mid );
+    printf ( "\n" );
+}
+
+
 MAIN(cvtFastPerform)
 {
     Perf t(4);
@@ -353,5 +441,8 @@ MAIN(cvtFastPerform)
     t.execute (5, false);
 #endif
 
+    ArrayPerf a;
+    a.execute ();
+
     return 0;
 }
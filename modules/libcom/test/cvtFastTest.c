@@ -15,9 +15,11 @@
 #include <math.h>
 #include <float.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "epicsUnitTest.h"
 #include "cvtFast.h"
+#include "dbDefs.h"
 #include "epicsStdlib.h"
 #include "testMain.h"
 
@@ -35,6 +37,56 @@
     testOk(!status, "epicsParse"#typ"('%s') OK", buf); \
     testOk(fabs(val_##typ - lit) < 0.5 * pow(10, -prec), #lit " => '%s'", buf);
 
+/* The array converters must match the single value ones exactly */
+#define NARRAY 16
+#define STRIDE 40
+
+static void testArrays(void)
+{
+    static const double dvals[NARRAY] = {
+        0.0, -0.0, 0.5, -0.5, 0.99999999, 1.0, 12.34567, -98765.4321,
+        9999999.9999, -9999999.99999, 10000000.0, 10000000.5, -2.5e7,
+        1e16, 1.5e17, -6.02e23
+    };
+    static const epicsInt32 ivals[NARRAY] = {
+        0, 1, -1, 9, 10, 99, 100, -101, 12345, -99999, 1000000,
+        2147483647, -2147483647, -2147483647 - 1, 1234567890, -10
+    };
+    static const epicsUInt16 precs[] = {0, 1, 3, 8, 9, 12};
+    char bulk[NARRAY * STRIDE];
+    char single[STRIDE];
+    unsigned i, p;
+    int ok;
+
+    testDiag("------------------------------------------------------");
+    testDiag("** Arrays **");
+
+    for (p = 0; p < NELEMENTS(precs); p++) {
+        cvtDoubleArrayToStrings(dvals, NARRAY, bulk, STRIDE, precs[p]);
+        for (ok = 1, i = 0; i < NARRAY; i++) {
+            cvtDoubleToString(dvals[i], single, precs[p]);
+            if (strcmp(single, &bulk[i * STRIDE]) != 0) {
+                testDiag("%.17g: '%s' != '%s'", dvals[i],
+                         &bulk[i * STRIDE], single);
+                ok = 0;
+            }
+        }
+        testOk(ok, "cvtDoubleArrayToStrings(prec=%u) matches",
+               (unsigned)precs[p]);
+    }
+
+    cvtInt32ArrayToStrings(ivals, NARRAY, bulk, STRIDE);
+    for (ok = 1, i = 0; i < NARRAY; i++) {
+        cvtInt32ToString(ivals[i], single);
+        if (strcmp(single, &bulk[i * STRIDE]) != 0) {
+            testDiag("%d: '%s' != '%s'", (int)ivals[i],
+                     &bulk[i * STRIDE], single);
+            ok = 0;
+        }
+    }
+    testOk(ok, "cvtInt32ArrayToStrings matches");
+}
+
 
 MAIN(cvtFastTest)
 {
@@ -55,7 +107,7 @@ MAIN(cvtFastTest)
 #endif
 #endif
 
-    testPlan(1062);
+    testPlan(1069);
 
     /* Arguments: type, value, num chars */
     testDiag("------------------------------------------------------");
@@ -456,5 +508,7 @@ MAIN(cvtFastTest)
     tryFString(Double, 1e+17, 4, 11);
     tryFString(Double, 1e+17, 5, 12);
 
+    testArrays();
+
     return testDone();
 }
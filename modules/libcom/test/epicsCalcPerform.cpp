@@ -0,0 +1,96 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Compare the speed of calcPerform() and calcPerformCompiled()
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsUnitTest.h"
+#include "epicsTime.h"
+#include "postfix.h"
+#include "testMain.h"
+
+static const char * const expressions[] = {
+    "A+B",
+    "A*B+C",
+    "A>B?A:B",
+    "(A+B)/2",
+    "SIN(A)*B",
+    "1+2*3+A",
+    "(A&0xff)>>2",
+    "A<B&&C>=D?E*F+G:H-1",
+    "MAX(A,B,C)-MIN(D,E,F)"
+};
+
+static const unsigned nIterations = 1000000;
+
+static double timeInterpreted(const char *rpn, double *args, double *presult)
+{
+    epicsTime begin = epicsTime::getMonotonic();
+
+    for (unsigned i = 0; i < nIterations; i++) {
+        args[0] = i;
+        calcPerform(args, presult, rpn);
+    }
+    return epicsTime::getMonotonic() - begin;
+}
+
+static double timeCompiled(const calcCompiled *pcompiled, double *args,
+    double *presult)
+{
+    epicsTime begin = epicsTime::getMonotonic();
+
+    for (unsigned i = 0; i < nIterations; i++) {
+        args[0] = i;
+        calcPerformCompiled(args, presult, pcompiled);
+    }
+    return epicsTime::getMonotonic() - begin;
+}
+
+static void measure(const char *expr)
+{
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    char rpn[MAX_POSTFIX_SIZE];
+    calcCompiled *pcompiled;
+    double result = 0, cresult = 0;
+    double tInterp, tCompiled;
+    short err;
+
+    if (postfix(expr, rpn, &err)) {
+        testDiag("postfix: %s in '%s'", calcErrorStr(err), expr);
+        return;
+    }
+    pcompiled = calcCompile(rpn);
+    if (!pcompiled) {
+        testDiag("calcCompile: can't compile '%s'", expr);
+        return;
+    }
+
+    tInterp = timeInterpreted(rpn, args, &result);
+    tCompiled = timeCompiled(pcompiled, args, &cresult);
+
+    testDiag("%-24s %7.1f ns %7.1f ns  x%.2f%s", expr,
+        tInterp * 1e9 / nIterations, tCompiled * 1e9 / nIterations,
+        tInterp / tCompiled, result == cresult ? "" : "  (results differ)");
+    calcCompiledFree(pcompiled);
+}
+
+MAIN(epicsCalcPerform)
+{
+    unsigned i;
+
+    testPlan(0);
+    testDiag("%-24s %10s %10s", "Expression", "calcPerform", "compiled");
+    for (i = 0; i < NELEMENTS(expressions); i++)
+        measure(expressions[i]);
+    return testDone();
+}
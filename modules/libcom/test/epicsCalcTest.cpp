@@ -44,6 +44,36 @@ double doCalc(const char *expr) {
     return result;
 }
 
+/* Check that the compiled expression gives the same result, and leaves
+ * the same values in the arguments, as the postfix expression did.
+ */
+bool checkCompiled(const char *expr, const char *rpn, double result,
+    const double *args) {
+    double cargs[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    calcCompiled *pcompiled = calcCompile(rpn);
+    double cresult = 0.0;
+    bool same;
+    cresult /= cresult;  /* Start as NaN */
+
+    if (!pcompiled) {
+        testDiag("calcCompile: can't compile '%s'", expr);
+        return false;
+    }
+    calcPerformCompiled(cargs, &cresult, pcompiled);
+    same = isnan(result) ? (bool) isnan(cresult) :
+        memcmp(&result, &cresult, sizeof(double)) == 0;
+    same = same && memcmp(args, cargs, sizeof(cargs)) == 0;
+    if (!same) {
+        testDiag("Compiled '%s' gives %g, postfix gave %g",
+            expr, cresult, result);
+        calcCompiledDump(pcompiled);
+    }
+    calcCompiledFree(pcompiled);
+    return same;
+}
+
 void testCalc(const char *expr, double expected) {
     /* Evaluate expression, test against expected result */
     bool pass = false;
@@ -74,6 +104,7 @@ void testCalc(const char *expr, double expected) {
     } else {
         pass = (result == expected);
     }
+    pass = pass && checkCompiled(expr, rpn, result, args);
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is %g, actually got %g", expected, result);
         calcExprDump(rpn);
@@ -106,7 +137,7 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
         }
 
     uresult = (result < 0.0 ? (epicsUInt32)(epicsInt32)result : (epicsUInt32)result);
-    pass = (uresult == expected);
+    pass = (uresult == expected) && checkCompiled(expr, rpn, result, args);
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is 0x%x (%u), actually got 0x%x (%u)",
                  expected, expected, uresult, uresult);
@@ -298,7 +329,7 @@ MAIN(epicsCalcTest)
     const double a=1.0, b=2.0, c=3.0, d=4.0, e=5.0, f=6.0,
                  g=7.0, h=8.0, i=9.0, j=10.0, k=11.0, l=12.0;
 
-    testPlan(637);
+    testPlan(642);
 
     /* LITERAL_OPERAND elements */
     testExpr(0);
@@ -818,6 +849,11 @@ MAIN(epicsCalcTest)
     testExpr(0 ? 2 : 1 ? 3 : 4);
     testExpr(1 ? 2 : 0 ? 3 : 4);
     testExpr(1 ? 2 : 1 ? 3 : 4);
+    testCalc("1 ? a : b ? c : d", 1);
+    testCalc("0 ? a : 1 ? b : c", 2);
+    testCalc("a ? (1 ? b : c) : d", 2);
+    testCalc("1 ? (b ? c : d) : (a ? b : c)", 3);
+    testCalc("(1 ? a : b) + (0 ? c : d)", 5);
 
     /* STORE_OPERATOR and EXPR_TERM elements*/
     testCalc("a := 0; a", 0);
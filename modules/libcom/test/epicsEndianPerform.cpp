@@ -0,0 +1,88 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure epicsSwap16Array() etc. against swapping one element at a time,
+ * as done for arrays received from a host of the other byte order
+ */
+
+#include <cstring>
+
+#include "epicsEndian.h"
+#include "epicsTypes.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const size_t nBytes = 1u << 20;
+static const unsigned nIterations = 200;
+
+template < class T >
+static void swapLoop ( void * dst, const void * src, size_t count )
+{
+    const char * s = static_cast < const char * > ( src );
+    char * d = static_cast < char * > ( dst );
+
+    for ( size_t i = 0; i < count; i++ ) {
+        char tmp[ sizeof ( T ) ];
+        for ( unsigned j = 0; j < sizeof ( T ); j++ )
+            tmp[j] = s[ i * sizeof ( T ) + sizeof ( T ) - 1 - j ];
+        std::memcpy ( & d[ i * sizeof ( T ) ], tmp, sizeof ( T ) );
+    }
+}
+
+static void report ( const char * name, double elapsed )
+{
+    double bytes = double ( nBytes ) * nIterations;
+
+    testDiag ( "%-24s %6.2f GB/s", name, bytes / elapsed / 1e9 );
+}
+
+static void measure ( const char * name, size_t size,
+    void ( * loop ) ( void *, const void *, size_t ),
+    void ( * swap ) ( void *, const void *, size_t ),
+    char * dst, const char * src )
+{
+    size_t count = nBytes / size;
+
+    testDiag ( "%s:", name );
+    epicsTime beg = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        loop ( dst, src, count );
+    epicsTime end1 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        swap ( dst, src, count );
+    epicsTime end2 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        swap ( dst, dst, count );
+    epicsTime end3 = epicsTime::getMonotonic ();
+
+    report ( "element at a time", end1 - beg );
+    report ( "array", end2 - end1 );
+    report ( "array in place", end3 - end2 );
+}
+
+MAIN(epicsEndianPerform)
+{
+    char * src = new char [ nBytes ];
+    char * dst = new char [ nBytes ];
+
+    testPlan(0);
+
+    for ( size_t i = 0; i < nBytes; i++ )
+        src[i] = char ( i );
+
+    measure ( "16-bit", 2u, swapLoop < epicsUInt16 >,
+        epicsSwap16Array, dst, src );
+    measure ( "32-bit", 4u, swapLoop < epicsUInt32 >,
+        epicsSwap32Array, dst, src );
+    measure ( "64-bit", 8u, swapLoop < epicsUInt64 >,
+        epicsSwap64Array, dst, src );
+
+    delete [] dst;
+    delete [] src;
+    return testDone();
+}
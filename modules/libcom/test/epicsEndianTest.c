@@ -0,0 +1,73 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Check epicsSwap16Array() etc. against a byte by byte reversal, for
+ * lengths and alignments that exercise both the vector and scalar loops.
+ */
+
+#include <string.h>
+
+#include "epicsEndian.h"
+#include "epicsTypes.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define MAX_COUNT 67u
+#define BUF_SIZE (8u * MAX_COUNT + 16u)
+
+typedef void (*swapFunc)(void *dst, const void *src, size_t count);
+
+static int checkSwap(const epicsUInt8 *src, const epicsUInt8 *dst,
+    const epicsUInt8 *guard, size_t size, size_t count)
+{
+    size_t i, j;
+
+    for (i = 0; i < count; i++)
+        for (j = 0; j < size; j++)
+            if (dst[i * size + j] != src[i * size + size - 1 - j])
+                return 0;
+    /* nothing past the end is touched */
+    return memcmp(dst + count * size, guard, 8u) == 0;
+}
+
+static void testSwap(swapFunc swap, size_t size, const char *name)
+{
+    epicsUInt8 src[BUF_SIZE], dst[BUF_SIZE], copy[BUF_SIZE];
+    int copyOk = 1, inPlaceOk = 1;
+    size_t i, count, offset;
+
+    for (i = 0; i < BUF_SIZE; i++)
+        src[i] = (epicsUInt8) (i * 7u + 1u);
+
+    for (offset = 0; offset < 3u; offset++) {
+        for (count = 0; count <= MAX_COUNT; count++) {
+            memset(dst, 0xa5, sizeof(dst));
+            swap(dst + offset, src + offset, count);
+            copyOk &= checkSwap(src + offset, dst + offset,
+                (const epicsUInt8 *) "\xa5\xa5\xa5\xa5\xa5\xa5\xa5\xa5",
+                size, count);
+
+            memcpy(copy, src, sizeof(copy));
+            swap(copy + offset, copy + offset, count);
+            inPlaceOk &= checkSwap(src + offset, copy + offset,
+                src + offset + count * size, size, count);
+        }
+    }
+    testOk(copyOk, "%s copying", name);
+    testOk(inPlaceOk, "%s in place", name);
+}
+
+MAIN(epicsEndianTest)
+{
+    testPlan(6);
+
+    testSwap(epicsSwap16Array, 2u, "epicsSwap16Array");
+    testSwap(epicsSwap32Array, 4u, "epicsSwap32Array");
+    testSwap(epicsSwap64Array, 8u, "epicsSwap64Array");
+
+    return testDone();
+}
@@ -12,6 +12,7 @@
  *      Date:   2010-09-24
  */
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -19,6 +20,7 @@
 #include "epicsAssert.h"
 #include "epicsThread.h"
 #include "epicsEvent.h"
+#include "epicsExit.h"
 #include "dbDefs.h"
 #include "errlog.h"
 #include "epicsUnitTest.h"
@@ -173,6 +175,163 @@ void logClient(void* raw, const char* msg)
     epicsEventSignal(pvt->done);
 }
 
+typedef struct {
+    unsigned int count;
+    unsigned int suppressed;
+    int next[4];
+    unsigned int outOfOrder;
+} countPvt;
+
+static
+void countClient(void* raw, const char* msg)
+{
+    countPvt *pvt = raw;
+    int thread, num;
+    size_t n;
+
+    pvt->count++;
+    if (sscanf(msg, "errlog: suppressed %zu messages", &n) == 1)
+        pvt->suppressed += n;
+    if (sscanf(msg, "thread %d message %d", &thread, &num) == 2 &&
+            thread >= 0 && thread < 4) {
+        if (num != pvt->next[thread])
+            pvt->outOfOrder++;
+        pvt->next[thread] = num + 1;
+    }
+}
+
+static const struct {
+    char a[128];
+    char b[128];
+} collidingSites = {"colliding site A %d\n", "colliding site B %d\n"};
+
+/* one call site for all of its callers */
+static
+void logOnBehalf(const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    errlogVprintfNoConsole(format, args);
+    va_end(args);
+}
+
+static
+void testRateLimit(void)
+{
+    countPvt pvt;
+    int i;
+
+    testDiag("Check rate limiting");
+    memset(&pvt, 0, sizeof(pvt));
+    errlogAddListener(&countClient, &pvt);
+
+    errlogSetRateLimit(5);
+    for (i = 0; i < 20; i++)
+        logOnBehalf("rate limited %d\n", i);
+    errlogFlush();
+    testEqInt(pvt.count, 5);
+
+    /* the next interval starts with a report */
+    epicsThreadSleep(1.1);
+    logOnBehalf("rate limited %d\n", i);
+    errlogFlush();
+    testEqInt(pvt.count, 7);
+    testEqInt(pvt.suppressed, 15);
+
+    /* call sites 128 bytes apart map to the same slots, each must still
+     * be limited when they alternate */
+    testDiag("Check rate limiting of colliding call sites");
+    epicsThreadSleep(1.1);
+    memset(&pvt, 0, sizeof(pvt));
+    for (i = 0; i < 20; i++) {
+        errlogPrintfNoConsole(collidingSites.a, i);
+        errlogPrintfNoConsole(collidingSites.b, i);
+    }
+    errlogFlush();
+    testEqInt(pvt.count, 10);
+
+    /* the same format string from two places */
+    testDiag("Check rate limiting of call sites sharing a format");
+    epicsThreadSleep(1.1);
+    memset(&pvt, 0, sizeof(pvt));
+    for (i = 0; i < 20; i++) {
+        errlogPrintfNoConsole("shared format %d\n", i);
+        errlogPrintfNoConsole("shared format %d\n", i);
+    }
+    errlogFlush();
+#if defined(__GNUC__) || defined(_MSC_VER)
+    testEqInt(pvt.count, 10);
+#else
+    testEqInt(pvt.count, 5);
+#endif
+
+    testDiag("Check rate limiting of errlogMessage() call sites");
+    epicsThreadSleep(1.1);
+    memset(&pvt, 0, sizeof(pvt));
+    eltc(0);
+    for (i = 0; i < 20; i++) {
+        errlogMessage("message from A\n");
+        errlogMessage("message from B\n");
+    }
+    errlogFlush();
+    eltc(1);
+#if defined(__GNUC__) || defined(_MSC_VER)
+    testEqInt(pvt.count, 10);
+#else
+    testEqInt(pvt.count, 5);
+#endif
+    errlogSetRateLimit(0);
+
+    errlogRemoveListeners(&countClient, &pvt);
+}
+
+static
+void logThread(void *raw)
+{
+    int thread = *(int*)raw;
+    int i;
+
+    for (i = 0; i < 20; i++)
+        errlogPrintfNoConsole("thread %d message %d\n", thread, i);
+}
+
+static
+void testThreads(void)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId tid[3];
+    int ids[4];
+    countPvt pvt;
+    int i;
+
+    testDiag("Check messages from several threads");
+    memset(&pvt, 0, sizeof(pvt));
+    errlogAddListener(&countClient, &pvt);
+
+    opts.joinable = 1;
+    for (i = 0; i < 3; i++) {
+        ids[i] = i;
+        tid[i] = epicsThreadCreateOpt("logThread", logThread, &ids[i], &opts);
+        if (!tid[i])
+            testAbort("Unable to create thread");
+    }
+    /* unless it was created by epicsThreadCreate(), this thread logs
+     * through the shared ring meanwhile */
+    testDiag("Main thread %s",
+        epicsAtThreadExitRuns() ? "has its own ring" : "uses the shared ring");
+    ids[3] = 3;
+    logThread(&ids[3]);
+    for (i = 0; i < 3; i++)
+        epicsThreadMustJoin(tid[i]);
+    errlogFlush();
+
+    testEqInt(pvt.count, 80);
+    testEqInt(pvt.outOfOrder, 0);
+
+    errlogRemoveListeners(&countClient, &pvt);
+}
+
 static
 void testANSIStrip(void)
 {
@@ -252,7 +411,7 @@ MAIN(epicsErrlogTest)
     char msg[256];
     clientPvt pvt, pvt2;
 
-    testPlan(54);
+    testPlan(62);
 
     testANSIStrip();
 
@@ -459,6 +618,9 @@ MAIN(epicsErrlogTest)
     testOk(1 == errlogRemoveListeners(&logClient, &pvt),
         "Removed 1 listener");
 
+    testRateLimit();
+    testThreads();
+
     osiSockAttach();
     testLogPrefix();
     osiSockRelease();
@@ -61,6 +61,8 @@ static void thread(void *arg)
     pinfo->terminate = epicsEventMustCreate(epicsEventEmpty);
     pinfo->terminated = epicsEventMustCreate(epicsEventEmpty);
     testOk(!epicsAtExit(atExit, pinfo), "Registered atExit(%p)", pinfo);
+    testOk(epicsAtThreadExitRuns(), "%s runs atThreadExit routines",
+        pinfo->name);
     testOk(!epicsAtThreadExit(atThreadExit, pinfo),
         "Registered atThreadExit(%p)", pinfo);
     testDiag("%s waiting for atExit", pinfo->name);
@@ -86,7 +88,7 @@ MAIN(epicsExitTest)
     info *pinfoA = (info *)calloc(1, sizeof(info));
     info *pinfoB = (info *)calloc(1, sizeof(info));
 
-    testPlan(15);
+    testPlan(17);
 
     testOk(!epicsAtExit(counter, NULL), "Registered counter()");
     count = 0;
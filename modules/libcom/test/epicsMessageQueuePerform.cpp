@@ -0,0 +1,116 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure epicsMessageQueue throughput with several senders and receivers
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsMessageQueue.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const unsigned nMessages = 240000;
+
+struct peer {
+    epicsMessageQueue * pq;
+    unsigned size;
+    unsigned count;
+    unsigned errors;
+    epicsThreadId tid;
+};
+
+extern "C" void sendLoop ( void * arg )
+{
+    peer * pp = static_cast < peer * > ( arg );
+    char buf[200];
+
+    memset ( buf, 0x55, sizeof ( buf ) );
+    for ( unsigned i = 0; i < pp->count; i++ ) {
+        if ( pp->pq->send ( buf, pp->size ) ) {
+            pp->errors++;
+        }
+    }
+}
+
+extern "C" void receiveLoop ( void * arg )
+{
+    peer * pp = static_cast < peer * > ( arg );
+    char buf[200];
+
+    for ( unsigned i = 0; i < pp->count; i++ ) {
+        if ( pp->pq->receive ( buf, sizeof ( buf ) ) != int ( pp->size ) ) {
+            pp->errors++;
+        }
+    }
+}
+
+static void startPeers ( peer * peers, unsigned n, epicsMessageQueue & q,
+    unsigned size, EPICSTHREADFUNC func )
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+
+    opts.joinable = 1;
+    for ( unsigned i = 0; i < n; i++ ) {
+        peers[i].pq = & q;
+        peers[i].size = size;
+        peers[i].count = nMessages / n;
+        peers[i].errors = 0;
+        peers[i].tid = epicsThreadCreateOpt ( "mqPeer", func, & peers[i], & opts );
+        if ( ! peers[i].tid ) {
+            testAbort ( "Unable to create thread" );
+        }
+    }
+}
+
+static unsigned joinPeers ( peer * peers, unsigned n )
+{
+    unsigned errors = 0;
+
+    for ( unsigned i = 0; i < n; i++ ) {
+        epicsThreadMustJoin ( peers[i].tid );
+        errors += peers[i].errors;
+    }
+    return errors;
+}
+
+static void measure ( unsigned nSenders, unsigned nReceivers, unsigned size )
+{
+    epicsMessageQueue q ( 64, size );
+    peer * senders = new peer [ nSenders ];
+    peer * receivers = new peer [ nReceivers ];
+
+    epicsTime begin = epicsTime::getMonotonic ();
+    startPeers ( receivers, nReceivers, q, size, receiveLoop );
+    startPeers ( senders, nSenders, q, size, sendLoop );
+    unsigned errors = joinPeers ( senders, nSenders );
+    errors += joinPeers ( receivers, nReceivers );
+    double elapsed = epicsTime::getMonotonic () - begin;
+
+    testDiag ( "%u:%u  %3u byte messages  %9.0f msgs/sec%s",
+        nSenders, nReceivers, size, nMessages / elapsed,
+        errors ? "  (errors)" : "" );
+
+    delete [] senders;
+    delete [] receivers;
+}
+
+MAIN(epicsMessageQueuePerform)
+{
+    static const unsigned sizes[] = { 16, 200 };
+
+    testPlan(0);
+    for ( unsigned i = 0; i < sizeof ( sizes ) / sizeof ( sizes[0] ); i++ ) {
+        measure ( 1, 1, sizes[i] );
+        measure ( 4, 1, sizes[i] );
+        measure ( 4, 4, sizes[i] );
+    }
+    return testDone();
+}
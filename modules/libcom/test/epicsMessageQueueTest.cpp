@@ -240,6 +240,35 @@ sender(void *arg)
     testDiag("%s exiting, sent %d messages", epicsThreadGetNameSelf(), i);
 }
 
+/*
+ * Some targets use a different implementation for queues of
+ * small messages, check that one of large messages works too
+ */
+static void
+largeMessages(void)
+{
+    epicsMessageQueue q(3, 1000);
+    char big[1000], cbuf[1000];
+    unsigned int i;
+
+    testDiag("Queue of large messages:");
+    for (i = 0; i < sizeof(big); i++)
+        big[i] = (char)i;
+    for (i = 1; i <= 3; i++)
+        q.trySend(big, 300 * i);
+    testOk1(q.pending() == 3);
+    testOk(q.trySend(big, 10) < 0, "trySend to full queue fails");
+    testOk(q.send(big, 10, 0.1) < 0, "send to full queue times out");
+    testOk1(q.receive(cbuf, sizeof(cbuf), 1.0) == 300 &&
+        memcmp(big, cbuf, 300) == 0);
+    testOk1(q.receive(cbuf, 100) < 0);
+    testOk1(q.tryReceive(cbuf, sizeof(cbuf)) == 900 &&
+        memcmp(big, cbuf, 900) == 0);
+    testOk1(q.pending() == 0);
+    testOk(q.receive(cbuf, sizeof(cbuf), 0.1) < 0,
+        "receive from empty queue times out");
+}
+
 #define NUM_SENDERS 4
 extern "C" void messageQueueTest(void *parm)
 {
@@ -356,6 +385,8 @@ extern "C" void messageQueueTest(void *parm)
     testOk1(q1.receive((void *)cbuf, sizeof cbuf, 1.0) < 0);
     testOk1(q1.pending() == 0);
 
+    largeMessages();
+
     testDiag("Single receiver with invalid size, single sender tests:");
     rxThread = epicsThreadCreateOpt("Bad Receiver", badReceiver, &q1, &opts);
     if (!rxThread)
@@ -451,7 +482,7 @@ MAIN(epicsMessageQueueTest)
     };
     epicsThreadId testThread;
 
-    testPlan(70 + NUM_SENDERS);
+    testPlan(78 + NUM_SENDERS);
 
     testThread = epicsThreadCreateOpt("messageQueueTest",
         messageQueueTest, NULL, &opts);
@@ -23,8 +23,10 @@ int epicsAlgorithm(void);
 int epicsAtomicTest(void);
 int epicsCalcTest(void);
 int epicsEllTest(void);
+int epicsEndianTest(void);
 int epicsEnvTest(void);
 int epicsErrlogTest(void);
+int logClientTest(void);
 int epicsEventTest(void);
 int epicsExitTest(void);
 int epicsMathTest(void);
@@ -40,6 +42,8 @@ int epicsStringTest(void);
 int epicsThreadHooksTest(void);
 int epicsThreadOnceTest(void);
 int epicsThreadPoolTest(void);
+int freeListTest(void);
+int tsFreeListTest(void);
 int epicsThreadPriorityTest(void);
 int epicsThreadPrivateTest(void);
 int epicsThreadTest(void);
@@ -56,6 +60,7 @@ int macDefExpandTest(void);
 int macLibTest(void);
 int osiSockTest(void);
 int ringBytesTest(void);
+int ringMPMCTest(void);
 int ringPointerTest(void);
 int taskwdTest(void);
 
@@ -82,8 +87,10 @@ void epicsRunLibComTests(void)
     runTest(epicsAtomicTest);
     runTest(epicsCalcTest);
     runTest(epicsEllTest);
+    runTest(epicsEndianTest);
     runTest(epicsEnvTest);
     runTest(epicsErrlogTest);
+    runTest(logClientTest);
     runTest(epicsEventTest);
     runTest(epicsInlineTest);
     runTest(epicsMathTest);
@@ -99,6 +106,8 @@ void epicsRunLibComTests(void)
     runTest(epicsThreadHooksTest);
     runTest(epicsThreadOnceTest);
     runTest(epicsThreadPoolTest);
+    runTest(freeListTest);
+    runTest(tsFreeListTest);
     runTest(epicsThreadPriorityTest);
     runTest(epicsThreadPrivateTest);
     runTest(epicsTimeTest);
@@ -112,6 +121,7 @@ void epicsRunLibComTests(void)
     runTest(macLibTest);
     runTest(osiSockTest);
     runTest(ringBytesTest);
+    runTest(ringMPMCTest);
     runTest(ringPointerTest);
     runTest(taskwdTest);
 
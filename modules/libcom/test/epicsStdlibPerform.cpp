@@ -0,0 +1,116 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure epicsParseDouble() and epicsParseInt32() against the C library
+ * on the kind of values found in .db files and DBR_STRING puts
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+#include "dbDefs.h"
+#include "epicsStdlib.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const char * const doubleValues[] = {
+    "0", "1", "10", "0.5", "100.0", "1e-3", "3.14159", "-2.5", "1000",
+    "0.001", "5.0", "-100", "1.5e-6", "273.15", "12.345", "0.1", "-0.25",
+    "1e6", "9.81", "360", "2.7182818", "0.0001", "-45.5", "1.0e-9"
+};
+
+static const char * const intValues[] = {
+    "0", "1", "2", "10", "100", "255", "1000", "4095", "65535", "-1",
+    "32767", "-32768", "3", "16", "1024", "60", "5", "100000", "7", "42"
+};
+
+static const unsigned nStrings = 10000;
+static const unsigned nIterations = 50;
+
+static void fill ( char * strs, const char * const * values, unsigned nValues )
+{
+    for ( unsigned i = 0; i < nStrings; i++ ) {
+        strncpy ( & strs[ i * MAX_STRING_SIZE ],
+            values[ rand () % nValues ], MAX_STRING_SIZE );
+    }
+}
+
+static void report ( const char * name, double elapsed )
+{
+    double count = double ( nStrings ) * nIterations;
+
+    testDiag ( "%-24s %6.1f ns per value, %6.1f M values/s",
+        name, elapsed * 1e9 / count, count / elapsed / 1e6 );
+}
+
+static void measureDouble ( const char * strs )
+{
+    double * vals = new double [ nStrings ];
+    char * end;
+
+    epicsTime beg = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        for ( unsigned i = 0; i < nStrings; i++ )
+            vals[i] = strtod ( & strs[ i * MAX_STRING_SIZE ], & end );
+    epicsTime end1 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        for ( unsigned i = 0; i < nStrings; i++ )
+            epicsParseDouble ( & strs[ i * MAX_STRING_SIZE ], & vals[i], & end );
+    epicsTime end2 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        epicsParseDoubleArray ( strs, MAX_STRING_SIZE, nStrings, vals );
+    epicsTime end3 = epicsTime::getMonotonic ();
+
+    report ( "strtod", end1 - beg );
+    report ( "epicsParseDouble", end2 - end1 );
+    report ( "epicsParseDoubleArray", end3 - end2 );
+    delete [] vals;
+}
+
+static void measureInt32 ( const char * strs )
+{
+    epicsInt32 * vals = new epicsInt32 [ nStrings ];
+    char * end;
+
+    epicsTime beg = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        for ( unsigned i = 0; i < nStrings; i++ )
+            vals[i] = strtol ( & strs[ i * MAX_STRING_SIZE ], & end, 10 );
+    epicsTime end1 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        for ( unsigned i = 0; i < nStrings; i++ )
+            epicsParseInt32 ( & strs[ i * MAX_STRING_SIZE ], & vals[i], 10, & end );
+    epicsTime end2 = epicsTime::getMonotonic ();
+    for ( unsigned n = 0; n < nIterations; n++ )
+        epicsParseInt32Array ( strs, MAX_STRING_SIZE, nStrings, vals, 10 );
+    epicsTime end3 = epicsTime::getMonotonic ();
+
+    report ( "strtol", end1 - beg );
+    report ( "epicsParseInt32", end2 - end1 );
+    report ( "epicsParseInt32Array", end3 - end2 );
+    delete [] vals;
+}
+
+MAIN(epicsStdlibPerform)
+{
+    char * strs = new char [ nStrings * MAX_STRING_SIZE ];
+
+    testPlan(0);
+
+    fill ( strs, doubleValues, NELEMENTS ( doubleValues ) );
+    testDiag ( "Floating point field values:" );
+    measureDouble ( strs );
+
+    fill ( strs, intValues, NELEMENTS ( intValues ) );
+    testDiag ( "Integer field values:" );
+    measureInt32 ( strs );
+
+    delete [] strs;
+    return testDone();
+}
@@ -15,6 +15,7 @@
 #include <errno.h>
 #include <limits.h>
 
+#include "dbDefs.h"
 #include "epicsTypes.h"
 #include "epicsStdlib.h"
 #include "epicsMath.h"
@@ -73,7 +74,7 @@ MAIN(epicsStdlibTest)
     epicsInt64 i64;
     epicsUInt64 u64;
 
-    testPlan(199);
+    testPlan(213);
 
     testOk(epicsParseLong("", &l, 0, NULL) == S_stdlib_noConversion,
         "Long '' => noConversion");
@@ -464,6 +465,45 @@ MAIN(epicsStdlibTest)
     testOk(epicsScanDouble("-Infinity", &d) && d == -epicsINF,
         "Double '-Infinity'");
 
+    /* Plain decimal numbers may not use the C library */
+    testOk(epicsScanDouble("1.5e30", &d) && d == 1.5e30, "Double '1.5e30'");
+    testOk(epicsScanDouble("0.3", &d) && d == 0.3, "Double '0.3'");
+    testOk(epicsScanDouble("9007199254740993", &d) && d == 9007199254740992.0,
+        "Double '9007199254740993'");
+    testOk(epicsScanDouble("1.7976931348623157e308", &d) && d == DBL_MAX,
+        "Double '1.7976931348623157e308'");
+    testOk(epicsScanDouble("0x10", &d) && d == 16, "Double '0x10'");
+    testOk(epicsScanLong("010", &l, 0) && l == 8, "Long '010' base 0");
+    testOk(epicsScanLong("010", &l, 10) && l == 10, "Long '010' base 10");
+    testOk(epicsScanLLong("-123456789012345678", &ll, 10) &&
+        ll == -123456789012345678LL, "LLong '-123456789012345678'");
+    testOk(epicsScanLLong("-9223372036854775808", &ll, 10) &&
+        ll == LLONG_MIN, "LLong '-9223372036854775808'");
+
+    {
+        static const char dstrs[][MAX_STRING_SIZE] = {
+            "1.5", "-2e-3", " 7 units", "0.1", "x", "2"
+        };
+        static const char istrs[][MAX_STRING_SIZE] = {
+            "12", " -34", "2147483647", "2147483648"
+        };
+        double dvals[6] = {0, 0, 0, 0, -1, -1};
+        epicsInt32 ivals[4];
+
+        testOk(!epicsParseDoubleArray(dstrs[0], MAX_STRING_SIZE, 4, dvals) &&
+            dvals[0] == 1.5 && dvals[1] == -2e-3 && dvals[2] == 7 &&
+            dvals[3] == 0.1, "epicsParseDoubleArray()");
+        testOk(epicsParseDoubleArray(dstrs[0], MAX_STRING_SIZE, 6, dvals) ==
+            S_stdlib_noConversion, "epicsParseDoubleArray() 'x' => noConversion");
+        testOk(dvals[3] == 0.1 && dvals[4] == -1 && dvals[5] == -1,
+            "Only the values before 'x' were stored");
+        testOk(!epicsParseInt32Array(istrs[0], MAX_STRING_SIZE, 3, ivals, 10) &&
+            ivals[0] == 12 && ivals[1] == -34 && ivals[2] == 2147483647,
+            "epicsParseInt32Array()");
+        testOk(epicsParseInt32Array(istrs[0], MAX_STRING_SIZE, 4, ivals, 10) ==
+            S_stdlib_overflow, "epicsParseInt32Array() '2147483648' => overflow");
+    }
+
 #ifdef epicsStrtod
 #define CHECK_STRTOD epicsStrtod != strtod
     if (epicsStrtod == strtod)
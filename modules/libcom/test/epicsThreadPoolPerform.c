@@ -0,0 +1,101 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure how fast small jobs can be run by a thread pool,
+ * queued one at a time and in batches
+ */
+
+#include <stdlib.h>
+
+#include "epicsThreadPool.h"
+
+/* included to report the work stealing counters */
+#include "../../src/pool/poolPriv.h"
+
+#include "testMain.h"
+#include "epicsUnitTest.h"
+
+#include "cantProceed.h"
+#include "epicsAtomic.h"
+#include "epicsTime.h"
+
+#define NTHRU 1000
+#define NROUNDS 100
+
+static
+void incrjob(void *arg, epicsJobMode mode)
+{
+    if(mode==epicsJobModeRun)
+        epicsAtomicIncrIntT((int*)arg);
+}
+
+static
+void measure(unsigned int nthreads)
+{
+    epicsThreadPool *pool;
+    epicsThreadPoolConfig conf;
+    epicsJob **jobs;
+    int count=0;
+    size_t i, r, stolen=0;
+    double perjob, batch;
+    epicsTimeStamp start, end;
+
+    epicsThreadPoolConfigDefaults(&conf);
+    if(nthreads)
+        conf.maxThreads=nthreads;
+
+    pool=epicsThreadPoolCreate(&conf);
+    if(!pool)
+        testAbort("Unable to create thread pool");
+
+    jobs=callocMustSucceed(NTHRU, sizeof(*jobs), "measure");
+    for(i=0; i<NTHRU; i++)
+        jobs[i]=epicsJobCreate(pool, &incrjob, &count);
+
+    epicsTimeGetMonotonic(&start);
+    for(r=0; r<NROUNDS; r++) {
+        for(i=0; i<NTHRU; i++)
+            epicsJobQueue(jobs[i]);
+        epicsThreadPoolWait(pool, -1.0);
+    }
+    epicsTimeGetMonotonic(&end);
+    perjob=epicsTimeDiffInSeconds(&end, &start);
+
+    epicsTimeGetMonotonic(&start);
+    for(r=0; r<NROUNDS; r++) {
+        epicsJobQueueBatch(jobs, NTHRU);
+        epicsThreadPoolWait(pool, -1.0);
+    }
+    epicsTimeGetMonotonic(&end);
+    batch=epicsTimeDiffInSeconds(&end, &start);
+
+    for(i=0; i<conf.maxThreads; i++)
+        stolen+=pool->queues[i].stolen;
+
+    testDiag("%u workers ran %d jobs", conf.maxThreads, count);
+    testDiag("  epicsJobQueue()      %.0f jobs/s", NTHRU*NROUNDS/perjob);
+    testDiag("  epicsJobQueueBatch() %.0f jobs/s", NTHRU*NROUNDS/batch);
+    testDiag("  %lu jobs stolen, %lu wakeups, %lu idle",
+             (unsigned long)stolen, (unsigned long)pool->wakeups,
+             (unsigned long)pool->idleWakeups);
+
+    for(i=0; i<NTHRU; i++)
+        epicsJobDestroy(jobs[i]);
+    free(jobs);
+    epicsThreadPoolDestroy(pool);
+}
+
+MAIN(epicsThreadPoolPerform)
+{
+    testPlan(0);
+    measure(1);
+    measure(2);
+    measure(4);
+    /* one worker per CPU */
+    measure(0);
+    return testDone();
+}
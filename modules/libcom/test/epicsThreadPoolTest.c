@@ -15,9 +15,11 @@
 #include "epicsUnitTest.h"
 
 #include "cantProceed.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 
 /* Do nothing */
 static void nullop(void)
@@ -421,9 +423,67 @@ void testshared(void)
 
 }
 
+static
+void incrjob(void *arg, epicsJobMode mode)
+{
+    if(mode==epicsJobModeRun)
+        epicsAtomicIncrIntT((int*)arg);
+}
+
+#define NBATCH 100
+
+static
+void testbatch(void)
+{
+    epicsThreadPool *poolA, *poolB;
+    epicsThreadPoolConfig conf;
+    epicsJob *jobs[NBATCH], *other[2];
+    int count=0, ok=1;
+    size_t i, added=0;
+
+    testDiag("Check batch queueing");
+
+    epicsThreadPoolConfigDefaults(&conf);
+    conf.initialThreads=0;
+    conf.maxThreads=4;
+
+    testOk1((poolA=epicsThreadPoolCreate(&conf))!=NULL);
+    testOk1((poolB=epicsThreadPoolCreate(&conf))!=NULL);
+    if(!poolA || !poolB)
+        testAbort("Unable to create pools");
+
+    for(i=0; i<NBATCH; i++)
+        ok &= (jobs[i]=epicsJobCreate(poolA, &incrjob, &count))!=NULL;
+    testOk1(ok);
+
+    testOk1(epicsJobQueueBatch(jobs, 0)==0);
+    testOk1(epicsJobQueueBatch(jobs, NBATCH)==0);
+    testOk1(epicsThreadPoolWait(poolA, 5.0)==0);
+    testOk(count==NBATCH, "%d jobs ran", count);
+
+    /* every queue of the pool got its share */
+    for(i=0; i<conf.maxThreads; i++)
+        added+=poolA->queues[i].added;
+    testOk(added==NBATCH, "%lu jobs added", (unsigned long)added);
+    testOk1(poolA->queues[conf.maxThreads-1].added==NBATCH/conf.maxThreads);
+
+    /* all jobs of one batch must be in the same pool */
+    other[0]=jobs[0];
+    testOk1((other[1]=epicsJobCreate(poolB, &incrjob, &count))!=NULL);
+    testOk1(epicsJobQueueBatch(other, 2)==S_pool_noPool);
+    testOk1(epicsThreadPoolWait(poolA, 5.0)==0);
+    testOk1(epicsThreadPoolWait(poolB, 5.0)==0);
+    testOk(count==NBATCH+1, "%d jobs ran", count);
+
+    epicsThreadPoolReport(poolA, stdout);
+
+    epicsThreadPoolDestroy(poolA);
+    epicsThreadPoolDestroy(poolB);
+}
+
 MAIN(epicsThreadPoolTest)
 {
-    testPlan(171);
+    testPlan(185);
 
     nullop();
     oneop();
@@ -443,6 +503,7 @@ MAIN(epicsThreadPoolTest)
     testreadd();
     testcancel();
     testshared();
+    testbatch();
 
     return testDone();
 }
@@ -0,0 +1,111 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure the cost of creating, starting, canceling and expiring
+ * timers with many timers pending in one queue
+ */
+
+#include <stdlib.h>
+
+#include "epicsTimer.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+class nullNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+class countingNotify : public epicsTimerNotify {
+public:
+    countingNotify () : count ( 0u ) {}
+    expireStatus expire ( const epicsTime & )
+    {
+        this->count++;
+        return expireStatus ( noRestart );
+    }
+    unsigned count;
+};
+
+static unsigned seed = 1u;
+
+// 0 .. 1000 seconds, random order but the same for every run
+static double randomDelay ()
+{
+    seed = seed * 1103515245u + 12345u;
+    return ( seed >> 8 ) / 16777.216;
+}
+
+static void measure ( unsigned nTimers )
+{
+    nullNotify queueNotify;
+    epicsTimerQueuePassive & queue =
+        epicsTimerQueuePassive::create ( queueNotify );
+    epicsTimer ** timers = new epicsTimer * [ nTimers ];
+    countingNotify notify;
+    epicsTime base = epicsTime::getCurrent ();
+    unsigned i;
+
+    epicsTime begin = epicsTime::getMonotonic ();
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i] = & queue.createTimer ();
+    }
+    double createTime = epicsTime::getMonotonic () - begin;
+
+    begin = epicsTime::getMonotonic ();
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i]->start ( notify, base + randomDelay () );
+    }
+    double startTime = epicsTime::getMonotonic () - begin;
+
+    // move every timer, half of them past all of the others
+    begin = epicsTime::getMonotonic ();
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i]->start ( notify, base + randomDelay () + ( i & 1 ) * 1000.0 );
+    }
+    double restartTime = epicsTime::getMonotonic () - begin;
+
+    // cancel every other timer
+    begin = epicsTime::getMonotonic ();
+    for ( i = 0u; i < nTimers; i += 2u ) {
+        timers[i]->cancel ();
+    }
+    double cancelTime = epicsTime::getMonotonic () - begin;
+
+    begin = epicsTime::getMonotonic ();
+    queue.process ( base + 3000.0 );
+    double expireTime = epicsTime::getMonotonic () - begin;
+    unsigned nCanceled = ( nTimers + 1u ) / 2u;
+
+    testDiag ( "%8u timers: create %6.1f, start %6.1f, restart %6.1f, "
+        "cancel %6.1f, expire %6.1f ns per timer",
+        nTimers, createTime * 1e9 / nTimers,
+        startTime * 1e9 / nTimers, restartTime * 1e9 / nTimers,
+        cancelTime * 1e9 / nCanceled,
+        expireTime * 1e9 / ( nTimers - nCanceled ) );
+    if ( notify.count != nTimers - nCanceled ) {
+        testDiag ( "%u timers expired, expected %u",
+            notify.count, nTimers - nCanceled );
+    }
+
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i]->destroy ();
+    }
+    delete [] timers;
+    delete & queue;
+}
+
+MAIN(epicsTimerPerform)
+{
+    testPlan(0);
+    for ( unsigned n = 1000u; n <= 1000000u; n *= 10u ) {
+        measure ( n );
+    }
+    return testDone();
+}
@@ -0,0 +1,106 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure freeListMalloc() and freeListFree() throughput
+ * with several threads using the same free list
+ */
+
+#include <stdlib.h>
+
+#include "freeList.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const unsigned nIterations = 1000000;
+static const unsigned nBurst = 8;
+
+struct worker {
+    void * pvt;
+    epicsEventId start;
+    epicsEventId done;
+    epicsThreadId tid;
+};
+
+extern "C" void allocLoop ( void * arg )
+{
+    worker * pw = static_cast < worker * > ( arg );
+    void * elem[nBurst];
+
+    epicsEventMustWait ( pw->start );
+    for ( unsigned i = 0; i < nIterations / nBurst; i++ ) {
+        for ( unsigned j = 0; j < nBurst; j++ ) {
+            elem[j] = freeListMalloc ( pw->pvt );
+        }
+        for ( unsigned j = 0; j < nBurst; j++ ) {
+            freeListFree ( pw->pvt, elem[j] );
+        }
+    }
+    epicsEventSignal ( pw->done );
+    // keep the thread cache until the statistics were printed
+    epicsEventMustWait ( pw->start );
+}
+
+static void measure ( unsigned nThreads, int nmalloc )
+{
+    void * pvt;
+    worker * workers = new worker [ nThreads ];
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    unsigned i;
+
+    opts.joinable = 1;
+    freeListInitPvt ( & pvt, 64, nmalloc );
+    for ( i = 0; i < nThreads; i++ ) {
+        workers[i].pvt = pvt;
+        workers[i].start = epicsEventMustCreate ( epicsEventEmpty );
+        workers[i].done = epicsEventMustCreate ( epicsEventEmpty );
+        workers[i].tid = epicsThreadCreateOpt ( "allocLoop",
+            allocLoop, & workers[i], & opts );
+        if ( ! workers[i].tid ) {
+            testAbort ( "Unable to create thread" );
+        }
+    }
+
+    epicsTime begin = epicsTime::getMonotonic ();
+    for ( i = 0; i < nThreads; i++ ) {
+        epicsEventSignal ( workers[i].start );
+    }
+    for ( i = 0; i < nThreads; i++ ) {
+        epicsEventMustWait ( workers[i].done );
+    }
+    double elapsed = epicsTime::getMonotonic () - begin;
+
+    testDiag ( "%u threads, %s: %6.1f ns per malloc/free pair, %5.1f M pairs/s",
+        nThreads, nmalloc >= 16 ? "cached  " : "uncached",
+        elapsed * 1e9 / ( nThreads * nIterations ),
+        nThreads * nIterations / elapsed / 1e6 );
+    freeListShow ( pvt, 0 );
+
+    for ( i = 0; i < nThreads; i++ ) {
+        epicsEventSignal ( workers[i].start );
+    }
+    for ( i = 0; i < nThreads; i++ ) {
+        epicsThreadMustJoin ( workers[i].tid );
+        epicsEventDestroy ( workers[i].start );
+        epicsEventDestroy ( workers[i].done );
+    }
+    delete [] workers;
+    freeListCleanup ( pvt );
+}
+
+MAIN(freeListPerform)
+{
+    testPlan(0);
+    for ( unsigned n = 1u; n <= 8u; n *= 2u ) {
+        // too few elements per allocation for thread caches
+        measure ( n, 8 );
+        measure ( n, 256 );
+    }
+    return testDone();
+}
@@ -0,0 +1,175 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Check that elements cached by threads are accounted for
+ * and returned to their free list
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "freeList.h"
+#include "epicsThread.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NELEM 100
+
+typedef struct {
+    void *pvt;
+    void *elem[NELEM];
+    int nalloc, nfree;
+} workPriv;
+
+static void allocElems(workPriv *priv)
+{
+    int i, ok = 1;
+
+    for (i = 0; i < priv->nalloc; i++) {
+        priv->elem[i] = freeListMalloc(priv->pvt);
+        ok &= priv->elem[i] != NULL;
+        if (priv->elem[i])
+            memset(priv->elem[i], i, 24);
+    }
+    testOk(ok, "allocated %d elements", priv->nalloc);
+}
+
+static void freeElems(workPriv *priv)
+{
+    int i;
+
+    for (i = 0; i < priv->nfree; i++)
+        freeListFree(priv->pvt, priv->elem[i]);
+}
+
+static void worker(void *arg)
+{
+    workPriv *priv = arg;
+
+    allocElems(priv);
+    freeElems(priv);
+}
+
+static void runWorker(workPriv *priv)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId tid;
+
+    opts.joinable = 1;
+    tid = epicsThreadCreateOpt("freeListWorker", worker, priv, &opts);
+    if (!tid)
+        testAbort("Unable to create worker");
+    epicsThreadMustJoin(tid);
+}
+
+static void testSingle(void)
+{
+    workPriv priv;
+    int i, j, distinct = 1;
+
+    testDiag("One thread");
+    freeListInitPvt(&priv.pvt, 24, 64);
+    priv.nalloc = priv.nfree = NELEM;
+
+    allocElems(&priv);
+    for (i = 0; i < NELEM; i++)
+        for (j = 0; j < i; j++)
+            distinct &= priv.elem[i] != priv.elem[j];
+    testOk(distinct, "elements are distinct");
+    testOk1(freeListItemsAvail(priv.pvt) == 128 - NELEM);
+
+    freeElems(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 128);
+
+    /* freed elements are reused */
+    allocElems(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 128 - NELEM);
+    freeElems(&priv);
+
+    freeListShow(priv.pvt, 1);
+    freeListCleanup(priv.pvt);
+}
+
+static void testThreads(void)
+{
+    workPriv priv;
+
+    testDiag("Elements cached by a thread which exits");
+    freeListInitPvt(&priv.pvt, 24, 64);
+
+    priv.nalloc = priv.nfree = NELEM;
+    runWorker(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 128);
+
+    testDiag("Allocate in one thread, free in another");
+    priv.nalloc = NELEM;
+    priv.nfree = 0;
+    runWorker(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 128 - NELEM);
+    priv.nfree = NELEM;
+    freeElems(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 128);
+
+    freeListShow(priv.pvt, 1);
+    freeListCleanup(priv.pvt);
+}
+
+static void testCleanup(void)
+{
+    workPriv a, b;
+
+    testDiag("Elements cached for a list which was cleaned up");
+    freeListInitPvt(&a.pvt, 24, 64);
+    a.nalloc = a.nfree = 10;
+    allocElems(&a);
+    freeElems(&a);
+    freeListCleanup(a.pvt);
+
+    /* probably reuses the cache slot of the first list */
+    freeListInitPvt(&b.pvt, 24, 64);
+    b.nalloc = b.nfree = 10;
+    allocElems(&b);
+    testOk1(freeListItemsAvail(b.pvt) == 64 - 10);
+    freeElems(&b);
+    testOk1(freeListItemsAvail(b.pvt) == 64);
+    freeListCleanup(b.pvt);
+}
+
+static void testUncached(void)
+{
+    workPriv priv;
+
+    testDiag("List which is too small to cache");
+    freeListInitPvt(&priv.pvt, 24, 4);
+    priv.nalloc = priv.nfree = 10;
+    allocElems(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 12 - 10);
+    freeElems(&priv);
+    testOk1(freeListItemsAvail(priv.pvt) == 12);
+    freeListCleanup(priv.pvt);
+}
+
+MAIN(freeListTest)
+{
+    void *pvt;
+
+    testPlan(18);
+
+    /* sets freeListBypass from the environment */
+    freeListInitPvt(&pvt, 24, 64);
+    freeListCleanup(pvt);
+
+    if (freeListBypass)
+        testSkip(18, "free lists are bypassed");
+    else {
+        testSingle();
+        testThreads();
+        testCleanup();
+        testUncached();
+    }
+    return testDone();
+}
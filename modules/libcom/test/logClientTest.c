@@ -0,0 +1,304 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Checks the batch framing between logClient and a log server.  The server
+ * here decodes the frames independently of iocLogServer, so this also pins
+ * down the wire format.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsThread.h"
+#include "epicsEvent.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+#include "logClient.h"
+#include "osiSock.h"
+
+#define NMSG 100
+#define TEXT_SIZE 0x10000
+
+typedef enum {
+    serverBatch,    /* replies to the hello */
+    serverRaw,      /* replies, but doesn't accept compressed frames */
+    serverOld,      /* closes its end like an old iocLogServer */
+    serverSilent    /* neither replies nor closes its end */
+} serverMode;
+
+typedef struct {
+    serverMode mode;
+    SOCKET listener;
+    unsigned short port;
+    epicsEventId done;
+    int helloOk;
+    int compressHello;
+    char *text;
+    size_t len;
+} testServer;
+
+static
+size_t recvAll(SOCKET sock, char *buf, size_t len)
+{
+    size_t n = 0u;
+
+    while(n < len) {
+        int status = recv(sock, buf + n, (int)(len - n), 0);
+        if(status <= 0)
+            break;
+        n += status;
+    }
+    return n;
+}
+
+static
+int textDone(const testServer *srv)
+{
+    return srv->len >= 5u && memcmp(srv->text + srv->len - 5u, "DONE\n", 5u) == 0;
+}
+
+static
+int getVarint(const unsigned char **pp, const unsigned char *end, size_t *pval)
+{
+    size_t val = 0u;
+    unsigned shift = 0u;
+
+    while(*pp < end && shift < 35u) {
+        unsigned char c = *(*pp)++;
+        val |= (size_t)(c & 0x7f) << shift;
+        if(!(c & 0x80)) {
+            *pval = val;
+            return 0;
+        }
+        shift += 7u;
+    }
+    return -1;
+}
+
+/* Appends the decoded payload to srv->text, returns non-zero on error */
+static
+int decodePayload(testServer *srv, const unsigned char *p, size_t size,
+                  int compressed)
+{
+    const unsigned char *end = p + size;
+    size_t lineStart = srv->len;
+
+    if(!compressed) {
+        if(srv->len + size > TEXT_SIZE)
+            return -1;
+        memcpy(srv->text + srv->len, p, size);
+        srv->len += size;
+        return 0;
+    }
+
+    /* shared prefixes refer to the previous line of the same frame */
+    while(p < end) {
+        size_t shared, suffix;
+        size_t prevStart = lineStart;
+
+        if(getVarint(&p, end, &shared) || getVarint(&p, end, &suffix) ||
+                suffix > (size_t)(end - p))
+            return -1;
+        lineStart = srv->len;
+        if(lineStart - prevStart < shared ||
+                srv->len + shared + suffix > TEXT_SIZE)
+            return -1;
+        memmove(srv->text + srv->len, srv->text + prevStart, shared);
+        srv->len += shared;
+        memcpy(srv->text + srv->len, p, suffix);
+        srv->len += suffix;
+        p += suffix;
+    }
+    return 0;
+}
+
+static
+void serverThread(void *raw)
+{
+    testServer *srv = raw;
+    osiSocklen_t addrSize;
+    struct sockaddr_in addr;
+    SOCKET sock;
+    char hello[64];
+    size_t n = 0u;
+
+    addrSize = sizeof(addr);
+    sock = epicsSocketAccept(srv->listener, (struct sockaddr *)&addr, &addrSize);
+    if(sock == INVALID_SOCKET) {
+        epicsEventMustTrigger(srv->done);
+        return;
+    }
+
+    if(srv->mode == serverOld)
+        shutdown(sock, SHUT_WR);
+
+    while(n < sizeof(hello) - 1u && recv(sock, hello + n, 1, 0) == 1) {
+        if(hello[n++] == '\n')
+            break;
+    }
+    hello[n] = '\0';
+    srv->helloOk = strncmp(hello, "iocLogClient-batch-v1", 21) == 0 &&
+        hello[n ? n - 1u : 0u] == '\n';
+    srv->compressHello = strstr(hello, " compress") != NULL;
+
+    if(srv->mode == serverOld || srv->mode == serverSilent) {
+        int status;
+        while(!textDone(srv) && srv->len < TEXT_SIZE &&
+              (status = recv(sock, srv->text + srv->len,
+                             (int)(TEXT_SIZE - srv->len), 0)) > 0)
+            srv->len += status;
+
+    } else {
+        unsigned char reply[7] = {'I', 'L', 'B', '1', 0, 0, 0};
+        unsigned char *payload = malloc(0x10000);
+
+        if(srv->mode == serverBatch)
+            reply[6] = 0x01;
+        send(sock, (char*)reply, sizeof(reply), 0);
+
+        while(payload && !textDone(srv)) {
+            unsigned char hdr[7];
+            size_t size;
+
+            if(recvAll(sock, (char*)hdr, sizeof(hdr)) != sizeof(hdr) ||
+                    hdr[0] != 'I' || hdr[1] != 'L')
+                break;
+            size = ((size_t)hdr[3] << 24) | ((size_t)hdr[4] << 16) |
+                   ((size_t)hdr[5] << 8) | hdr[6];
+            if(size > 0x10000 ||
+                    recvAll(sock, (char*)payload, size) != size ||
+                    decodePayload(srv, payload, size, hdr[2] & 0x01))
+                break;
+        }
+        free(payload);
+    }
+
+    epicsSocketDestroy(sock);
+    epicsEventMustTrigger(srv->done);
+}
+
+static
+void serverStart(testServer *srv, serverMode mode)
+{
+    struct sockaddr_in addr;
+    osiSocklen_t addrSize = sizeof(addr);
+
+    memset(srv, 0, sizeof(*srv));
+    srv->mode = mode;
+    srv->text = malloc(TEXT_SIZE);
+    srv->done = epicsEventMustCreate(epicsEventEmpty);
+    if(!srv->text)
+        testAbort("Out of memory");
+
+    srv->listener = epicsSocketCreate(AF_INET, SOCK_STREAM, 0);
+    if(srv->listener == INVALID_SOCKET)
+        testAbort("epicsSocketCreate failed");
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(0);
+    if(bind(srv->listener, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+            listen(srv->listener, 1) < 0 ||
+            getsockname(srv->listener, (struct sockaddr *)&addr, &addrSize) < 0)
+        testAbort("Can't listen on a local port");
+    srv->port = ntohs(addr.sin_port);
+
+    epicsThreadMustCreate("logServer", epicsThreadPriorityMedium,
+                          epicsThreadGetStackSize(epicsThreadStackMedium),
+                          serverThread, srv);
+}
+
+static
+void testClient(serverMode mode, int compress)
+{
+    static const char * const modeName[] = {"batch", "raw batch", "old",
+                                             "silent"};
+    testServer srv;
+    struct in_addr loopback;
+    logClientId id;
+    logClientStats stats;
+    char *expect = malloc(TEXT_SIZE);
+    size_t expectLen = 0u;
+    int i, done = 0;
+
+    testDiag("Server mode %s, logClientCompress=%d", modeName[mode], compress);
+    if(!expect)
+        testAbort("Out of memory");
+
+    serverStart(&srv, mode);
+    logClientBatch = 1;
+    logClientCompress = compress;
+    loopback.s_addr = htonl(INADDR_LOOPBACK);
+    id = logClientCreate(loopback, srv.port);
+    if(!id)
+        testAbort("logClientCreate failed");
+
+    for(i = 0; i < NMSG; i++) {
+        char msg[128];
+
+        /* like a log storm, only the end of each line differs */
+        sprintf(msg, "testioc filename=\"../devTest.c\" line number=123 "
+                "read timeout on channel %d\n", i);
+        logClientSend(id, msg);
+        strcpy(expect + expectLen, msg);
+        expectLen += strlen(msg);
+    }
+    logClientSend(id, "DONE\n");
+    strcpy(expect + expectLen, "DONE\n");
+    expectLen += 5u;
+
+    for(i = 0; i < 100 && !done; i++) {
+        logClientFlush(id);
+        done = epicsEventWaitWithTimeout(srv.done, 0.1) == epicsEventOK;
+    }
+    testOk(done, "Server saw DONE");
+    testOk(srv.helloOk, "Client sent the hello line");
+    testOk(srv.compressHello == compress, "Hello %s compression",
+           compress ? "requests" : "doesn't request");
+
+    if(!testOk(srv.len == expectLen && memcmp(srv.text, expect, expectLen) == 0,
+               "Server received the logged text"))
+        testDiag("%u of %u bytes received", (unsigned)srv.len,
+                 (unsigned)expectLen);
+
+    logClientGetStats(id, &stats);
+    testOk(stats.batched == (mode < serverOld), "batched=%d", stats.batched);
+    testOk(stats.compressed == (mode == serverBatch && compress),
+           "compressed=%d", stats.compressed);
+    testOk(stats.messages == NMSG + 1u, "%u messages", (unsigned)stats.messages);
+    testOk(stats.dropped == 0u, "%u dropped", (unsigned)stats.dropped);
+    if(stats.compressed)
+        testOk(stats.bytesSent < expectLen / 2u, "%u bytes sent for %u",
+               (unsigned)stats.bytesSent, (unsigned)expectLen);
+    else
+        testOk(stats.bytesSent >= expectLen, "%u bytes sent for %u",
+               (unsigned)stats.bytesSent, (unsigned)expectLen);
+
+    /* the client keeps trying to reconnect until exit */
+    epicsSocketDestroy(srv.listener);
+    epicsEventDestroy(srv.done);
+    free(srv.text);
+    free(expect);
+}
+
+MAIN(logClientTest)
+{
+    testPlan(45);
+    osiSockAttach();
+
+    testClient(serverBatch, 1);
+    testClient(serverBatch, 0);
+    testClient(serverRaw, 1);
+    testClient(serverOld, 1);
+    /* falls back to text after the negotiation timeout */
+    testClient(serverSilent, 1);
+
+    logClientBatch = 0;
+    osiSockRelease();
+    return testDone();
+}
@@ -0,0 +1,207 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* ringMPMCTest.c */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsRingMPMC.h"
+#include "epicsThread.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+typedef struct {
+    int producer;
+    int seq;
+} element;
+
+static void testSingle(void)
+{
+    epicsRingMPMCId ring = epicsRingMPMCCreate(100, sizeof(element));
+    epicsRingMPMCStats stats;
+    element e;
+    int i, rsize;
+
+    testDiag("Testing operations w/o threading");
+
+    testOk1(ring!=NULL);
+    if (!ring) {
+        testSkip(18, "Ring not created");
+        return;
+    }
+    rsize = epicsRingMPMCGetSize(ring);
+    testOk(rsize==128, "size %d rounded up to 128", rsize);
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetUsed(ring)==0);
+    testOk1(epicsRingMPMCGet(ring, &e)==0);
+
+    testDiag("Fill it up");
+    for (i = 0; i < 2 * rsize; i++) {
+        e.producer = 0;
+        e.seq = i;
+        if (!epicsRingMPMCPut(ring, &e))
+            break;
+    }
+    testOk(i==rsize, "%d == %d", i, rsize);
+    testOk1(!epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetUsed(ring)==rsize);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==rsize);
+
+    testDiag("Drain it out");
+    for (i = 0; i < 2 * rsize; i++) {
+        if (!epicsRingMPMCGet(ring, &e) || e.seq != i)
+            break;
+    }
+    testOk(i==rsize, "%d == %d", i, rsize);
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    epicsRingMPMCResetHighWaterMark(ring);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==0);
+
+    epicsRingMPMCGetStats(ring, &stats);
+    testOk1(stats.puts==(size_t)rsize);
+    testOk1(stats.retries==0);
+    testOk1(stats.wakeups==0);
+
+    testDiag("High water mark is sampled, but overflow always shows");
+    for (i = 0; i < 20; i++)
+        epicsRingMPMCPut(ring, &e);
+    testOk(epicsRingMPMCGetHighWaterMark(ring)==16, "%d == 16",
+        epicsRingMPMCGetHighWaterMark(ring));
+    for (i = 0; i < 20; i++)
+        epicsRingMPMCGet(ring, &e);
+    epicsRingMPMCResetHighWaterMark(ring);
+    /* the put which fills the ring is not a sampled one */
+    for (i = 0; i < rsize; i++)
+        epicsRingMPMCPut(ring, &e);
+    testOk(epicsRingMPMCGetHighWaterMark(ring)<rsize, "%d < %d",
+        epicsRingMPMCGetHighWaterMark(ring), rsize);
+    testOk1(!epicsRingMPMCPut(ring, &e));
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==rsize);
+
+    epicsRingMPMCDelete(ring);
+}
+
+#define NPRODUCERS 4
+#define NCONSUMERS 3
+#define NELEMENTS 100000
+
+typedef struct {
+    epicsRingMPMCId ring;
+    epicsEventId done;
+    int id;
+    int count;
+    int outOfOrder;
+    int last[NPRODUCERS];
+} threadPvt;
+
+static void producer(void *raw)
+{
+    threadPvt *pvt = raw;
+    element e;
+
+    e.producer = pvt->id;
+    for (e.seq = 0; e.seq < NELEMENTS; e.seq++) {
+        while (!epicsRingMPMCPut(pvt->ring, &e))
+            epicsThreadSleep(0.001);
+    }
+    epicsEventMustTrigger(pvt->done);
+}
+
+static void consumer(void *raw)
+{
+    threadPvt *pvt = raw;
+    int i;
+
+    for (i = 0; i < NPRODUCERS; i++)
+        pvt->last[i] = -1;
+
+    while (1) {
+        element e;
+
+        epicsRingMPMCWait(pvt->ring);
+        while (epicsRingMPMCGet(pvt->ring, &e)) {
+            if (e.producer < 0)
+                goto done;
+            /* elements of one producer arrive in order at each consumer */
+            if (e.seq <= pvt->last[e.producer])
+                pvt->outOfOrder++;
+            pvt->last[e.producer] = e.seq;
+            pvt->count++;
+        }
+    }
+done:
+    epicsEventMustTrigger(pvt->done);
+}
+
+static void testMulti(void)
+{
+    epicsRingMPMCId ring = epicsRingMPMCCreate(64, sizeof(element));
+    threadPvt prod[NPRODUCERS], cons[NCONSUMERS];
+    epicsRingMPMCStats stats;
+    int i, total = 0, outOfOrder = 0;
+
+    testDiag("%d producers, %d consumers", NPRODUCERS, NCONSUMERS);
+
+    for (i = 0; i < NCONSUMERS; i++) {
+        memset(&cons[i], 0, sizeof(cons[i]));
+        cons[i].ring = ring;
+        cons[i].done = epicsEventMustCreate(epicsEventEmpty);
+        epicsThreadMustCreate("consumer", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize(epicsThreadStackSmall), consumer, &cons[i]);
+    }
+    for (i = 0; i < NPRODUCERS; i++) {
+        memset(&prod[i], 0, sizeof(prod[i]));
+        prod[i].ring = ring;
+        prod[i].id = i;
+        prod[i].done = epicsEventMustCreate(epicsEventEmpty);
+        epicsThreadMustCreate("producer", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize(epicsThreadStackSmall), producer, &prod[i]);
+    }
+    for (i = 0; i < NPRODUCERS; i++) {
+        epicsEventMustWait(prod[i].done);
+        epicsEventDestroy(prod[i].done);
+    }
+
+    /* one stop marker for each consumer */
+    for (i = 0; i < NCONSUMERS; i++) {
+        element e;
+
+        e.producer = -1;
+        e.seq = 0;
+        while (!epicsRingMPMCPut(ring, &e))
+            epicsThreadSleep(0.001);
+    }
+    for (i = 0; i < NCONSUMERS; i++) {
+        epicsEventMustWait(cons[i].done);
+        epicsEventDestroy(cons[i].done);
+        total += cons[i].count;
+        outOfOrder += cons[i].outOfOrder;
+    }
+
+    testOk(total==NPRODUCERS*NELEMENTS, "received %d of %d elements",
+        total, NPRODUCERS*NELEMENTS);
+    testOk(outOfOrder==0, "%d elements out of order", outOfOrder);
+
+    epicsRingMPMCGetStats(ring, &stats);
+    testDiag("puts %lu, retries %lu, wakeups %lu",
+        (unsigned long)stats.puts, (unsigned long)stats.retries,
+        (unsigned long)stats.wakeups);
+    testOk1(stats.puts==NPRODUCERS*NELEMENTS+NCONSUMERS);
+    testOk1(epicsRingMPMCIsEmpty(ring));
+
+    epicsRingMPMCDelete(ring);
+}
+
+MAIN(ringMPMCTest)
+{
+    testPlan(23);
+    testSingle();
+    testMulti();
+    return testDone();
+}
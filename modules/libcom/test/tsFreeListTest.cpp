@@ -0,0 +1,204 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Check that tsFreeList and tsThreadFreeList hand out distinct items
+ * which keep their contents when used by several threads
+ */
+
+#include <cstring>
+
+#include "tsFreeList.h"
+#include "epicsThread.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NITEMS 100
+
+struct item {
+    unsigned id;
+    char fill[60];
+};
+
+static void fillItems ( void ** items, unsigned n, unsigned id )
+{
+    for ( unsigned i = 0u; i < n; i++ ) {
+        item * p = static_cast < item * > ( items[i] );
+        p->id = id + i;
+        memset ( p->fill, id + i, sizeof ( p->fill ) );
+    }
+}
+
+static bool checkItems ( void ** items, unsigned n, unsigned id )
+{
+    bool ok = true;
+    for ( unsigned i = 0u; i < n; i++ ) {
+        const item * p = static_cast < const item * > ( items[i] );
+        ok = ok && p->id == id + i;
+        for ( unsigned j = 0u; ok && j < sizeof ( p->fill ); j++ ) {
+            ok = p->fill[j] == static_cast < char > ( id + i );
+        }
+    }
+    return ok;
+}
+
+static bool distinctItems ( void ** items, unsigned n )
+{
+    for ( unsigned i = 0u; i < n; i++ ) {
+        for ( unsigned j = 0u; j < i; j++ ) {
+            if ( items[i] == items[j] ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template < class LIST >
+static void testOneThread ( LIST & list, const char * name )
+{
+    void * items[NITEMS];
+
+    testDiag ( "%s used by one thread", name );
+    for ( unsigned i = 0u; i < NITEMS; i++ ) {
+        items[i] = list.allocate ( sizeof ( item ) );
+    }
+    testOk ( distinctItems ( items, NITEMS ), "%s items are distinct", name );
+    fillItems ( items, NITEMS, 1u );
+    testOk ( checkItems ( items, NITEMS, 1u ), "%s items keep their contents",
+        name );
+    for ( unsigned i = 0u; i < NITEMS; i++ ) {
+        list.release ( items[i], sizeof ( item ) );
+    }
+
+    // released items are reused
+    for ( unsigned i = 0u; i < NITEMS; i++ ) {
+        items[i] = list.allocate ( sizeof ( item ) );
+    }
+    testOk ( distinctItems ( items, NITEMS ),
+        "%s reused items are distinct", name );
+    for ( unsigned i = 0u; i < NITEMS; i++ ) {
+        list.release ( items[i] );
+    }
+
+    // a derived class which is larger bypasses the list
+    void * big = list.allocate ( sizeof ( item ) + 16u );
+    memset ( big, 0x55, sizeof ( item ) + 16u );
+    testOk ( big != 0, "%s allocated an item of another size", name );
+    list.release ( big, sizeof ( item ) + 16u );
+}
+
+template < class LIST >
+struct work {
+    LIST * list;
+    void * items[NITEMS];
+    unsigned id;
+    bool alloc;
+};
+
+template < class LIST >
+static void worker ( void * arg )
+{
+    work < LIST > * pwork = static_cast < work < LIST > * > ( arg );
+
+    if ( pwork->alloc ) {
+        for ( unsigned i = 0u; i < NITEMS; i++ ) {
+            pwork->items[i] = pwork->list->allocate ( sizeof ( item ) );
+        }
+        fillItems ( pwork->items, NITEMS, pwork->id );
+    }
+    else {
+        for ( unsigned i = 0u; i < NITEMS; i++ ) {
+            pwork->list->release ( pwork->items[i], sizeof ( item ) );
+        }
+    }
+}
+
+template < class LIST >
+static void runWorkers ( work < LIST > * pwork, unsigned n )
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId tid[4];
+
+    opts.joinable = 1;
+    for ( unsigned i = 0u; i < n; i++ ) {
+        tid[i] = epicsThreadCreateOpt ( "tsFreeListWorker",
+            worker < LIST >, & pwork[i], & opts );
+        if ( ! tid[i] ) {
+            testAbort ( "Unable to create worker" );
+        }
+    }
+    for ( unsigned i = 0u; i < n; i++ ) {
+        epicsThreadMustJoin ( tid[i] );
+    }
+}
+
+template < class LIST >
+static void testThreads ( LIST & list, const char * name )
+{
+    work < LIST > w[4];
+    bool ok = true;
+
+    testDiag ( "%s used by four threads", name );
+    for ( unsigned i = 0u; i < 4u; i++ ) {
+        w[i].list = & list;
+        w[i].id = 1000u * ( i + 1u );
+        w[i].alloc = true;
+    }
+    runWorkers ( w, 4u );
+    for ( unsigned i = 0u; i < 4u; i++ ) {
+        ok = ok && checkItems ( w[i].items, NITEMS, w[i].id );
+    }
+    testOk ( ok, "%s items allocated by other threads keep their contents",
+        name );
+
+    // each worker releases the items allocated by its neighbour
+    void * temp[NITEMS];
+    memcpy ( temp, w[0].items, sizeof ( temp ) );
+    for ( unsigned i = 0u; i < 3u; i++ ) {
+        memcpy ( w[i].items, w[i + 1u].items, sizeof ( temp ) );
+        w[i].alloc = false;
+    }
+    memcpy ( w[3].items, temp, sizeof ( temp ) );
+    w[3].alloc = false;
+    runWorkers ( w, 4u );
+
+    // the items come back from the caches of threads which have exited
+    void * items[4 * NITEMS];
+    for ( unsigned i = 0u; i < 4u * NITEMS; i++ ) {
+        items[i] = list.allocate ( sizeof ( item ) );
+    }
+    testOk ( distinctItems ( items, 4u * NITEMS ),
+        "%s items released by other threads are distinct", name );
+    fillItems ( items, 4u * NITEMS, 7u );
+    testOk ( checkItems ( items, 4u * NITEMS, 7u ),
+        "%s items released by other threads keep their contents", name );
+    for ( unsigned i = 0u; i < 4u * NITEMS; i++ ) {
+        list.release ( items[i] );
+    }
+}
+
+MAIN(tsFreeListTest)
+{
+    testPlan(21);
+
+    {
+        tsFreeList < item, 0x20, epicsMutex > list;
+        testOneThread ( list, "tsFreeList" );
+        testThreads ( list, "tsFreeList" );
+    }
+    {
+        tsThreadFreeList < item, 0x20 > list;
+        testOneThread ( list, "tsThreadFreeList" );
+        testThreads ( list, "tsThreadFreeList" );
+    }
+    {
+        tsThreadFreeList < item, 0 > list;
+        testOneThread ( list, "uncached tsThreadFreeList" );
+        testThreads ( list, "uncached tsThreadFreeList" );
+    }
+    return testDone();
+}
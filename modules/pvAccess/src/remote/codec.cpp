@@ -34,6 +34,7 @@
 #include <pv/logger.h>
 #include <pv/likely.h>
 #include <pv/codec.h>
+#include <pv/ioLoop.h>
 #include <pv/serializationHelper.h>
 #include <pv/serverChannelImpl.h>
 #include <pv/clientContextImpl.h>
@@ -53,6 +54,15 @@ struct BreakTransport : TransportSender
         throw epics::pvAccess::detail::connection_closed_exception("Break");
     }
 };
+// ends the send thread, for the I/O thread to take over again
+struct HandBackTransport : TransportSender
+{
+    virtual ~HandBackTransport() {}
+    virtual void send(epics::pvData::ByteBuffer* buffer, TransportSendControl* control) OVERRIDE FINAL
+    {
+        throw epics::pvAccess::detail::connection_closed_exception("Hand back");
+    }
+};
 } // namespace
 
 namespace epics {
@@ -124,6 +134,10 @@ AbstractCodec::AbstractCodec(
     _writeOpReady(false),
     _socketBuffer(bufSizeSelect(receiveBufferSize)),
     _sendBuffer(bufSizeSelect(sendBufferSize)),
+    _blockingProcessQueue(blockingProcessQueue),
+    _bufferMessages(false),
+    _bufferSends(false),
+    _sendPendingPosition(0),
     //PRIVATE
     _storedPayloadSize(0), _storedPosition(0), _startPosition(0),
     _maxSendPayloadSize(_sendBuffer.getSize() - 2*PVA_MESSAGE_HEADER_SIZE),    // start msg + control
@@ -219,6 +233,30 @@ void AbstractCodec::processReadNormal()  {
             // read header fields
             processHeader();
             bool isControl = ((_flags & 0x01) == 0x01);
+
+            // without a thread of our own to block, wait for the rest of
+            // the message to arrive rather than for the socket, if it fits.
+            // The other segments of a segmented message may be far behind.
+            if (_bufferMessages && !isControl)
+            {
+                bool firstSegment = (_flags & 0x30) == 0x10;
+                bool whole = _payloadSize <= 0
+                        || _socketBuffer.getRemaining() >= std::size_t(_payloadSize);
+                if (firstSegment || !whole)
+                {
+                    _socketBuffer.setPosition(_socketBuffer.getPosition() - PVA_MESSAGE_HEADER_SIZE);
+                    if (!firstSegment && PVA_MESSAGE_HEADER_SIZE + std::size_t(_payloadSize)
+                            <= _socketBuffer.getSize() - MAX_ENSURE_SIZE)
+                    {
+                        if (!readToBuffer(PVA_MESSAGE_HEADER_SIZE + _payloadSize, false))
+                            return;
+                    }
+                    else if (handOffMessage())
+                        return;
+                    processHeader();
+                }
+            }
+
             if (isControl) {
                 processControlMessage();
             }
@@ -270,6 +308,9 @@ void AbstractCodec::processReadNormal()  {
 
                     throw;
                 }
+
+                if (handBackMessage())
+                    return;
             }
         }
 
@@ -375,6 +416,23 @@ void AbstractCodec::processReadSegmented() {
 }
 
 
+bool AbstractCodec::messageBuffered()
+{
+    std::size_t remaining = _socketBuffer.getRemaining();
+    if (remaining < PVA_MESSAGE_HEADER_SIZE)
+        return false;
+
+    // control messages have data in place of the payload size
+    std::size_t position = _socketBuffer.getPosition();
+    if ((_socketBuffer.getByte(position + 2) & 0x01) == 0x01)
+        return true;
+
+    int32_t payloadSize = _socketBuffer.getInt(position + 4);
+    return payloadSize >= 0 &&
+           std::size_t(payloadSize) <= remaining - PVA_MESSAGE_HEADER_SIZE;
+}
+
+
 bool AbstractCodec::readToBuffer(
     std::size_t requiredBytes,
     bool persistent)  {
@@ -762,6 +820,12 @@ void AbstractCodec::processWrite() {
 
 void AbstractCodec::send(ByteBuffer *buffer)
 {
+    // keep the order, behind what the socket didn't take before
+    if (!_sendPending.empty() && !sendPending(!_bufferSends))
+    {
+        keepPending(buffer);
+        return;
+    }
 
     // On Windows, limiting the buffer size is important to prevent
     // poor throughput performances when transferring large amount of
@@ -796,6 +860,11 @@ void AbstractCodec::send(ByteBuffer *buffer)
         }
         else if (bytesSent == 0)
         {
+            if (_bufferSends)
+            {
+                keepPending(buffer);
+                return;
+            }
             sendBufferFull(tries++);
             continue;
         }
@@ -817,8 +886,55 @@ void AbstractCodec::send(ByteBuffer *buffer)
 }
 
 
+bool AbstractCodec::sendPending(bool wait)
+{
+    int tries = 0;
+    while (_sendPendingPosition < _sendPending.size())
+    {
+        ByteBuffer wrappedBuffer(&_sendPending[_sendPendingPosition],
+                                 _sendPending.size() - _sendPendingPosition);
+        int bytesSent = write(&wrappedBuffer);
+
+        if (bytesSent < 0)
+        {
+            // connection lost
+            close();
+            throw connection_closed_exception("bytesSent < 0");
+        }
+        else if (bytesSent == 0)
+        {
+            if (!wait)
+                return false;
+            sendBufferFull(tries++);
+            continue;
+        }
+
+        atomic::add(_totalBytesSent, bytesSent);
+        _sendPendingPosition += bytesSent;
+        tries = 0;
+    }
+
+    // may have held a large array
+    std::vector<char>().swap(_sendPending);
+    _sendPendingPosition = 0;
+    return true;
+}
+
+
+void AbstractCodec::keepPending(ByteBuffer *buffer)
+{
+    std::size_t count = buffer->getRemaining();
+    std::size_t size = _sendPending.size();
+    _sendPending.resize(size + count);
+    buffer->getArray(&_sendPending[size], count);
+}
+
+
 void AbstractCodec::processSendQueue()
 {
+    // no more output while the socket doesn't take what is pending
+    if (!_sendPending.empty() && !sendPending(!_bufferSends))
+        return;
 
     {
         std::size_t senderProcessed = 0;
@@ -836,6 +952,8 @@ void AbstractCodec::processSendQueue()
 
                 if (terminated())   // termination
                     break;
+                if (!_blockingProcessQueue) // the I/O thread is called again
+                    break;
                 // termination (we want to process even if shutdown)
                 _sendQueue.pop_front(sender);
             }
@@ -918,6 +1036,7 @@ void AbstractCodec::enqueueSendRequest(
 
     if (_senderThread == epicsThreadGetIdSelf() &&
             _sendQueue.empty() &&
+            _sendPending.empty() &&
             _sendBuffer.getRemaining() >= requiredBufferSize)
     {
         processSender(sender);
@@ -990,7 +1109,84 @@ bool AbstractCodec::directSerialize(ByteBuffer* /*existingBuffer*/, const char*
 bool AbstractCodec::directDeserialize(ByteBuffer *existingBuffer, char* deserializeTo,
                                       std::size_t elementCount, std::size_t elementSize)
 {
-    return false;
+    std::size_t count = elementCount * elementSize;
+
+    // same limit as directSerialize(), smaller arrays are copied from the buffer
+    if (count < 64*1024 || existingBuffer != &_socketBuffer)
+        return false;
+
+    try
+    {
+        while (count > 0)
+        {
+            // first take what is already in the buffer (bounded by the payload)
+            std::size_t n = std::min(_socketBuffer.getRemaining(), count);
+            _socketBuffer.getArray(deserializeTo, n);
+            deserializeTo += n;
+            count -= n;
+            if (count == 0)
+                break;
+
+            // subtract what was already processed
+            std::size_t pos = _socketBuffer.getPosition();
+            _storedPayloadSize -= pos - _storedPosition;
+            _storedPosition = pos;
+
+            if (_storedPayloadSize > 0)
+            {
+                // the rest of this payload is still in the socket,
+                // receive it straight into the destination
+                n = std::min(_storedPayloadSize, count);
+                ByteBuffer wrappedBuffer(deserializeTo, n);
+                while (wrappedBuffer.getRemaining() > 0)
+                {
+                    int bytesRead = read(&wrappedBuffer);
+
+                    if (bytesRead < 0)
+                    {
+                        close();
+                        throw connection_closed_exception("bytesRead < 0");
+                    }
+                    // non-blocking IO support
+                    else if (bytesRead == 0)
+                        readPollOne();
+
+                    atomic::add(_totalBytesRecv, bytesRead);
+                }
+                deserializeTo += n;
+                count -= n;
+                _storedPayloadSize -= n;
+            }
+            else
+            {
+                // the array continues in the next segment
+                // cf. the SEGMENTED case of ensureData()
+                _socketBuffer.setLimit(_storedLimit);
+
+                ReadMode storedMode = _readMode;
+                _readMode = SEGMENTED;
+                processRead();
+                _readMode = storedMode;
+
+                _storedPosition = _socketBuffer.getPosition();
+                _storedLimit = _socketBuffer.getLimit();
+                _socketBuffer.setLimit(
+                    std::min<std::size_t>(
+                        _storedPosition + _storedPayloadSize, _storedLimit));
+            }
+        }
+    }
+    catch (io_exception &) {
+        try {
+            close();
+        } catch (io_exception & ) {
+            // noop, best-effort close
+        }
+        throw connection_closed_exception(
+            "Failed to receive array data.");
+    }
+
+    return true;
 }
 
 //
@@ -1008,12 +1204,56 @@ BlockingTCPTransportCodec::~BlockingTCPTransportCodec()
 }
 
 void BlockingTCPTransportCodec::readPollOne() {
-    throw std::logic_error("should not be called for blocking IO");
+    if (!_ioLoop)
+        throw std::logic_error("should not be called for blocking IO");
+    ioWait(false);
 }
 
 
 void BlockingTCPTransportCodec::writePollOne() {
-    throw std::logic_error("should not be called for blocking IO");
+    if (!_ioLoop)
+        throw std::logic_error("should not be called for blocking IO");
+    ioWait(true);
+}
+
+
+void BlockingTCPTransportCodec::scheduleSend() {
+    // a send thread waits on the queue itself
+    if (_ioLoop && !_ioDetached.get() && !_sendScheduled.getAndSet(true))
+        _ioLoop->scheduleSend(this);
+}
+
+
+bool BlockingTCPTransportCodec::handOffMessage() {
+    if (!_ioLoop || _ioDetached.get())
+        return false;
+
+    // Until handBackMessage(), this transport is served like one without
+    // an I/O thread.  The threads are started by ioDetached(), once the
+    // I/O thread is done with us.
+    createThreads();
+    _senderThread = 0; // until the send thread runs
+    _bufferMessages = false;
+    _bufferSends = false;
+    _blockingProcessQueue = true;
+    _ioThreads = 2;
+    _ioDetached.getAndSet(true);
+    _ioLoop->detach(shared_from_this());
+    return true;
+}
+
+
+bool BlockingTCPTransportCodec::handBackMessage() {
+    // only the receive thread reads while detached
+    if (!_ioLoop || !_ioDetached.get() || !isOpen())
+        return false;
+
+    // The send thread stops once it is through what is queued so far,
+    // and the last of the two threads to stop has the I/O thread take
+    // over again.
+    _ioHandBack.getAndSet(true);
+    enqueueSendRequest(TransportSender::shared_pointer(new HandBackTransport));
+    return true;
 }
 
 
@@ -1036,12 +1276,32 @@ void BlockingTCPTransportCodec::close() {
 void BlockingTCPTransportCodec::waitJoin()
 {
     assert(!_isOpen.get());
-    _sendThread.exitWait();
-    _readThread.exitWait();
+    if (_ioLoop) {
+        if (_ioDetached.get()) {
+            _sendThread->exitWait();
+            _readThread->exitWait();
+        }
+        // the I/O thread can't wait for itself, and will remove us later
+        if (!_ioLoop->isCurrentThread()) {
+            _ioRemoved.wait();
+            _ioRemoved.signal(); // for any later call
+        }
+        return;
+    }
+    _sendThread->exitWait();
+    _readThread->exitWait();
 }
 
 void BlockingTCPTransportCodec::internalClose()
 {
+    if (_ioLoop) {
+        // interrupt ioWait(), or the threads taking over from the I/O
+        // thread.  The socket is destroyed by the I/O thread once it is
+        // out of the epoll set.
+        ::shutdown(_channel, SHUT_RDWR);
+        _ioLoop->remove(shared_from_this());
+    }
+    else
     {
 
         epicsSocketSystemCallInterruptMechanismQueryInfo info  =
@@ -1099,13 +1359,38 @@ bool BlockingTCPTransportCodec::isOpen() {
 // NOTE: must not be called from constructor (e.g. needs shared_from_this())
 void BlockingTCPTransportCodec::start() {
 
-    _readThread.start();
+    if (_ioLoop) {
+        osiSockIoctl_t yes = true;
+        if (socket_ioctl(_channel, FIONBIO, &yes) < 0 ||
+                !_ioLoop->add(shared_from_this()))
+            close();
+        return;
+    }
+
+    _readThread->start();
 
-    _sendThread.start();
+    _sendThread->start();
 
 }
 
 
+void BlockingTCPTransportCodec::createThreads()
+{
+    _readThread.reset(new epics::pvData::Thread(
+                          epics::pvData::Thread::Config(this, &BlockingTCPTransportCodec::receiveThread)
+                          .prio(epicsThreadPriorityCAServerLow)
+                          .name("TCP-rx")
+                          .stack(epicsThreadStackBig)
+                          .autostart(false)));
+    _sendThread.reset(new epics::pvData::Thread(
+                          epics::pvData::Thread::Config(this, &BlockingTCPTransportCodec::sendThread)
+                          .prio(epicsThreadPriorityCAServerLow)
+                          .name("TCP-tx")
+                          .stack(epicsThreadStackBig)
+                          .autostart(false)));
+}
+
+
 void BlockingTCPTransportCodec::receiveThread()
 {
     /* This innocuous ref. is an important hack.
@@ -1121,12 +1406,16 @@ void BlockingTCPTransportCodec::receiveThread()
 
     // initially enable timeout for all clients to weed out
     // impersonators (security scanners?)
-    setRxTimeout(true);
+    // Taking over from the I/O thread, ioDetached() has set it.
+    if (!_ioDetached.get())
+        setRxTimeout(true);
 
     while (this->isOpen())
     {
         try {
             this->processRead();
+            if (_ioHandBack.get())
+                break;
             continue;
         } catch (std::exception &e) {
             PRINT_EXCEPTION(e);
@@ -1141,6 +1430,9 @@ void BlockingTCPTransportCodec::receiveThread()
         // exception
         close();
     }
+
+    if (_ioHandBack.get())
+        ioThreadExit();
 }
 
 
@@ -1157,7 +1449,11 @@ void BlockingTCPTransportCodec::sendThread()
             this->processWrite();
             continue;
         } catch (connection_closed_exception &cce) {
-            // noop
+            // HandBackTransport, the rest of the queue is for the I/O thread
+            if (isOpen() && _ioHandBack.get()) {
+                ioThreadExit();
+                return;
+            }
         } catch (std::exception &e) {
             PRINT_EXCEPTION(e);
             LOG(logLevelWarn,
@@ -1172,6 +1468,156 @@ void BlockingTCPTransportCodec::sendThread()
         close();
     }
     _sendQueue.clear();
+
+    if (_ioHandBack.get())
+        ioThreadExit();
+}
+
+void BlockingTCPTransportCodec::ioStart(const epicsTime& now)
+{
+    setSenderThread();
+    _lastRecv = now;
+
+    // cf. receiveThread()
+    setRxTimeout(true);
+
+    // anything queued before we were added
+    ioSend();
+}
+
+void BlockingTCPTransportCodec::ioRead(const epicsTime& now)
+{
+    _lastRecv = now;
+
+    try {
+        // the socket may not be readable again for what is buffered
+        do {
+            processRead();
+        } while (isOpen() && !_ioDetached.get() && messageBuffered());
+        return;
+    } catch (std::exception &e) {
+        PRINT_EXCEPTION(e);
+        LOG(logLevelError,
+            "an exception caught while reading at %s:%d: %s",
+            __FILE__, __LINE__, e.what());
+    } catch (...) {
+        LOG(logLevelError,
+            "unknown exception caught while reading at %s:%d.",
+            __FILE__, __LINE__);
+    }
+    close();
+}
+
+void BlockingTCPTransportCodec::ioSend()
+{
+    _sendScheduled.getAndSet(false);
+    // the send thread took over
+    if (_ioDetached.get())
+        return;
+
+    try {
+        processWrite();
+        // MAX_MESSAGE_SEND reached, take turns with the other transports.
+        // Otherwise called again once the socket takes more.
+        if (!_sendQueue.empty() && _sendPending.empty())
+            scheduleSend();
+        return;
+    } catch (connection_closed_exception &cce) {
+        // noop
+    } catch (std::exception &e) {
+        PRINT_EXCEPTION(e);
+        LOG(logLevelWarn,
+            "an exception caught while sending at %s:%d: %s",
+            __FILE__, __LINE__, e.what());
+    } catch (...) {
+        LOG(logLevelWarn,
+            "unknown exception caught while sending at %s:%d.",
+            __FILE__, __LINE__);
+    }
+    close();
+}
+
+void BlockingTCPTransportCodec::ioDetached()
+{
+    // after close(), the socket may be gone already.  The threads are
+    // started anyway, and exit after clearing the send queue.
+    if (isOpen()) {
+        // a blocking socket again, as for a transport with threads of its own
+        osiSockIoctl_t no = false;
+        if (socket_ioctl(_channel, FIONBIO, &no) < 0)
+            close();
+        else
+            setRxTimeout(_rxTimeout > 0.0);
+    }
+
+    _readThread->start();
+    _sendThread->start();
+}
+
+bool BlockingTCPTransportCodec::ioAttached(const epicsTime& now)
+{
+    // the threads are done, and only wait to be joined
+    _readThread->exitWait();
+    _sendThread->exitWait();
+
+    _bufferMessages = true;
+    _bufferSends = true;
+    _blockingProcessQueue = false;
+    _ioHandBack.getAndSet(false);
+    _ioDetached.getAndSet(false);
+
+    if (isOpen()) {
+        osiSockIoctl_t yes = true;
+        if (socket_ioctl(_channel, FIONBIO, &yes) < 0)
+            close();
+    }
+    // ioRemoved() may have left the queue to the send thread
+    if (!isOpen()) {
+        _sendQueue.clear();
+        return false;
+    }
+
+    setSenderThread();
+    _lastRecv = now;
+    return true;
+}
+
+void BlockingTCPTransportCodec::ioThreadExit()
+{
+    if (atomic::decrement(_ioThreads) == 0)
+        _ioLoop->attach(shared_from_this());
+}
+
+void BlockingTCPTransportCodec::ioRemoved()
+{
+    epicsSocketDestroy(_channel);
+    // else the send thread still has to see BreakTransport
+    if (!_ioDetached.get())
+        _sendQueue.clear();
+    _ioRemoved.signal();
+}
+
+bool BlockingTCPTransportCodec::ioIdle(const epicsTime& now) const
+{
+    return _rxTimeout > 0.0 && now - _lastRecv > _rxTimeout;
+}
+
+void BlockingTCPTransportCodec::ioWait(bool forWrite)
+{
+    // like a blocking socket with SO_RCVTIMEO, but also while sending
+    double timeout = _rxTimeout;
+    if (timeout <= 0.0)
+        timeout = connectionTimeout();
+
+    if (!IOLoop::waitSocket(_channel, forWrite, timeout)) {
+        close();
+        throw connection_closed_exception(forWrite ? "send timeout" : "receive timeout");
+    }
+}
+
+double BlockingTCPTransportCodec::connectionTimeout()
+{
+    return 4.0/3.0*std::max(0.0, _context->getConfiguration()->getPropertyAsDouble("EPICS_PVA_CONN_TMO", 30.0));
 }
 
 void BlockingTCPTransportCodec::setRxTimeout(bool ena)
@@ -1187,7 +1633,14 @@ void BlockingTCPTransportCodec::setRxTimeout(bool ena)
      *
      * - As a compromise, continue to send echo every 15 seconds, but increase default timeout to 40.
      */
-    double timeout = !ena ? 0.0 : 4.0/3.0*std::max(0.0, _context->getConfiguration()->getPropertyAsDouble("EPICS_PVA_CONN_TMO", 30.0));
+    double timeout = !ena ? 0.0 : connectionTimeout();
+
+    if (_ioLoop && !_ioDetached.get()) {
+        // enforced by the I/O thread
+        _rxTimeout = timeout;
+        return;
+    }
+
 #ifdef _WIN32
     DWORD timo = DWORD(timeout*1000); // in milliseconds
 #else
@@ -1208,6 +1661,10 @@ void BlockingTCPTransportCodec::setRxTimeout(bool ena)
 }
 
 void BlockingTCPTransportCodec::sendBufferFull(int tries) {
+    if (_ioLoop && !_ioDetached.get()) {
+        writePollOne();
+        return;
+    }
     // TODO constants
     epicsThreadSleep(std::max<double>(tries * 0.1, 1));
 }
@@ -1232,16 +1689,9 @@ BlockingTCPTransportCodec::BlockingTCPTransportCodec(bool serverFlag, const Cont
          receiveBufferSize,
          sendBufferSize,
          true)
-    ,_readThread(epics::pvData::Thread::Config(this, &BlockingTCPTransportCodec::receiveThread)
-                 .prio(epicsThreadPriorityCAServerLow)
-                 .name("TCP-rx")
-                 .stack(epicsThreadStackBig)
-                 .autostart(false))
-    ,_sendThread(epics::pvData::Thread::Config(this, &BlockingTCPTransportCodec::sendThread)
-                 .prio(epicsThreadPriorityCAServerLow)
-                 .name("TCP-tx")
-                 .stack(epicsThreadStackBig)
-                 .autostart(false))
+    ,_ioThreads(0)
+    ,_ioPollOut(false)
+    ,_rxTimeout(0.0)
     ,_channel(channel)
     ,_context(context), _responseHandler(responseHandler)
     ,_remoteTransportReceiveBufferSize(MAX_TCP_RECV)
@@ -1252,6 +1702,16 @@ BlockingTCPTransportCodec::BlockingTCPTransportCodec(bool serverFlag, const Cont
 
     _isOpen.getAndSet(true);
 
+    std::tr1::shared_ptr<IOLoopGroup> loops(context->getIOLoops());
+    if (loops) {
+        _ioLoop = loops->next();
+        _blockingProcessQueue = false;
+        _bufferMessages = true;
+        _bufferSends = true;
+    } else {
+        createThreads();
+    }
+
     // get remote address
     osiSocklen_t saSize = sizeof(sockaddr);
     int retval = getpeername(_channel, &(_socketAddress.sa), &saSize);
@@ -1298,6 +1758,9 @@ int BlockingTCPTransportCodec::write(
                 continue;
             else if (socketError==SOCK_ENOBUFS)
                 return 0;
+            // non-blocking socket
+            else if (socketError==SOCK_EWOULDBLOCK || socketError==EAGAIN)
+                return 0;
         }
 
         if (bytesSent > 0) {
@@ -1335,6 +1798,10 @@ int BlockingTCPTransportCodec::read(epics::pvData::ByteBuffer* dst) {
                 // interrupted by signal.  Retry
                 continue;
 
+            } else if((err==SOCK_EWOULDBLOCK || err==EAGAIN) && _ioLoop && !_ioDetached.get()) {
+                // non-blocking socket, nothing (more) to read for now
+                return 0;
+
             } else if(err==SOCK_EWOULDBLOCK || err==EAGAIN || err==SOCK_EINPROGRESS
                       || err==SOCK_ETIMEDOUT
                       || err==SOCK_ECONNABORTED || err==SOCK_ECONNRESET
@@ -0,0 +1,458 @@
+/**
+ * Copyright - See the COPYRIGHT that is included with this distribution.
+ * pvAccessCPP is distributed subject to a Software License Agreement found
+ * in file LICENSE that is included with this distribution.
+ */
+
+#include <sstream>
+
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <poll.h>
+#  include <unistd.h>
+#  define PVA_IO_LOOP
+#endif
+
+#include <osiSock.h>
+#include <epicsThread.h>
+#include <epicsTime.h>
+#include <epicsAtomic.h>
+#include <errlog.h>
+
+#define epicsExportSharedSymbols
+#include <pv/ioLoop.h>
+#include <pv/codec.h>
+#include <pv/logger.h>
+
+typedef epicsGuard<epicsMutex> Guard;
+typedef epicsGuardRelease<epicsMutex> UnGuard;
+
+namespace epics {
+namespace pvAccess {
+namespace detail {
+
+#ifdef PVA_IO_LOOP
+
+namespace {
+// how often idle transports are looked for
+const double checkPeriod = 1.0;
+// max. events handled per epoll_wait()
+const int maxEvents = 64;
+}
+
+IOLoop::IOLoop(const std::string& name)
+    :_stopping(false)
+    ,_stopped(false)
+    ,_pollFd(epoll_create1(EPOLL_CLOEXEC))
+    ,_wakeFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+    ,_thread(*this, name.c_str(),
+             epicsThreadGetStackSize(epicsThreadStackBig),
+             epicsThreadPriorityCAServerLow)
+{
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL; // wakeup
+
+    if(_pollFd < 0 || _wakeFd < 0 ||
+            epoll_ctl(_pollFd, EPOLL_CTL_ADD, _wakeFd, &ev) != 0) {
+        if(_pollFd >= 0)
+            ::close(_pollFd);
+        if(_wakeFd >= 0)
+            ::close(_wakeFd);
+        throw std::runtime_error("Unable to create epoll set");
+    }
+}
+
+IOLoop::~IOLoop()
+{
+    _thread.exitWait();
+    ::close(_pollFd);
+    ::close(_wakeFd);
+}
+
+void IOLoop::start()
+{
+    _thread.start();
+}
+
+void IOLoop::post(Op op, BlockingTCPTransportCodec *transport,
+                  std::tr1::shared_ptr<BlockingTCPTransportCodec> const & ref)
+{
+    bool wake;
+    {
+        Guard G(_mutex);
+        if(_stopped) {
+            if(op == opRemove) {
+                // nothing left to race with
+                UnGuard U(G);
+                transport->ioRemoved();
+            } else if(op == opAttach) {
+                // with no thread left to serve it
+                UnGuard U(G);
+                transport->close();
+            }
+            return;
+        }
+        Request req;
+        req.op = op;
+        req.transport = transport;
+        req.ref = ref;
+        wake = _requests.empty();
+        _requests.push_back(req);
+    }
+    // the I/O thread looks at the requests after handling events anyway
+    if(wake && !isCurrentThread()) {
+        uint64_t one = 1u;
+        if(::write(_wakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+            errlogPrintf("PVA I/O thread wakeup failed: %d\n", errno);
+    }
+}
+
+bool IOLoop::add(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport)
+{
+    {
+        Guard G(_mutex);
+        if(_stopping)
+            return false;
+    }
+    post(opAdd, transport.get(), transport);
+    return true;
+}
+
+void IOLoop::scheduleSend(BlockingTCPTransportCodec *transport)
+{
+    post(opSend, transport, std::tr1::shared_ptr<BlockingTCPTransportCodec>());
+}
+
+void IOLoop::detach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport)
+{
+    post(opDetach, transport.get(), transport);
+}
+
+void IOLoop::attach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport)
+{
+    post(opAttach, transport.get(), transport);
+}
+
+void IOLoop::remove(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport)
+{
+    post(opRemove, transport.get(), transport);
+}
+
+void IOLoop::stop()
+{
+    {
+        Guard G(_mutex);
+        if(_stopping)
+            return;
+        _stopping = true;
+    }
+    uint64_t one = 1u;
+    if(::write(_wakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        errlogPrintf("PVA I/O thread wakeup failed: %d\n", errno);
+
+    if(!isCurrentThread())
+        _thread.exitWait();
+}
+
+bool IOLoop::processRequests(const epicsTime& now)
+{
+    std::vector<Request> requests;
+    bool stopping;
+    {
+        Guard G(_mutex);
+        requests.swap(_requests);
+        stopping = _stopping;
+    }
+
+    for(size_t i = 0u; i < requests.size(); i++) {
+        const Request& req = requests[i];
+        BlockingTCPTransportCodec *transport = req.transport;
+
+        switch(req.op) {
+        case opAdd:
+            if(watch(transport, req.ref)) {
+                transport->ioStart(now);
+                updateEvents(transport);
+            }
+            break;
+        case opSend:
+            // may have been removed since
+            if(_transports.find(transport) != _transports.end()) {
+                transport->ioSend();
+                updateEvents(transport);
+            }
+            break;
+        case opDetach:
+        {
+            transports_t::iterator it(_transports.find(transport));
+            if(it != _transports.end()) {
+                epoll_event ev;
+                memset(&ev, 0, sizeof(ev));
+                epoll_ctl(_pollFd, EPOLL_CTL_DEL, transport->_channel, &ev);
+                _transports.erase(it);
+            }
+            // the socket is still destroyed by opRemove, after close()
+            transport->ioDetached();
+        }
+            break;
+        case opAttach:
+            if(transport->ioAttached(now) && watch(transport, req.ref)) {
+                // what the receive thread has read ahead
+                transport->ioRead(now);
+                transport->ioSend();
+                updateEvents(transport);
+            }
+            break;
+        case opRemove:
+        {
+            transports_t::iterator it(_transports.find(transport));
+            if(it != _transports.end()) {
+                epoll_event ev;
+                memset(&ev, 0, sizeof(ev));
+                epoll_ctl(_pollFd, EPOLL_CTL_DEL, transport->_channel, &ev);
+                _transports.erase(it);
+            }
+            transport->ioRemoved();
+        }
+            break;
+        }
+    }
+    // dropping the references held by requests may destroy transports
+
+    if(stopping) {
+        transports_t transports(_transports);
+        for(transports_t::iterator it(transports.begin()), end(transports.end()); it != end; ++it)
+            it->second->close();
+    }
+    return stopping;
+}
+
+bool IOLoop::watch(BlockingTCPTransportCodec *transport,
+                   std::tr1::shared_ptr<BlockingTCPTransportCodec> const & ref)
+{
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = transport;
+
+    if(epoll_ctl(_pollFd, EPOLL_CTL_ADD, transport->_channel, &ev) != 0) {
+        LOG(logLevelError, "Unable to add TCP socket to %s to epoll set: %d",
+            transport->_socketName.c_str(), errno);
+        // removal is posted, and the socket destroyed there
+        transport->close();
+        return false;
+    }
+    transport->_ioPollOut = false;
+    _transports[transport] = ref;
+    return true;
+}
+
+void IOLoop::updateEvents(BlockingTCPTransportCodec *transport)
+{
+    // also wait for the socket to take the output it didn't before
+    bool pollOut = !transport->_sendPending.empty();
+
+    if(pollOut == transport->_ioPollOut || transport->_ioDetached.get())
+        return;
+
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = pollOut ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    ev.data.ptr = transport;
+
+    if(epoll_ctl(_pollFd, EPOLL_CTL_MOD, transport->_channel, &ev) == 0) {
+        transport->_ioPollOut = pollOut;
+    } else {
+        LOG(logLevelError, "Unable to modify epoll events of TCP socket to %s: %d",
+            transport->_socketName.c_str(), errno);
+        transport->close();
+    }
+}
+
+void IOLoop::checkTimeouts(const epicsTime& now)
+{
+    std::vector<BlockingTCPTransportCodec::shared_pointer> idle;
+
+    for(transports_t::iterator it(_transports.begin()), end(_transports.end()); it != end; ++it) {
+        if(it->first->ioIdle(now))
+            idle.push_back(it->second);
+    }
+    for(size_t i = 0u; i < idle.size(); i++) {
+        LOG(logLevelDebug, "Closing inactive TCP connection to %s.",
+            idle[i]->_socketName.c_str());
+        idle[i]->close();
+    }
+}
+
+void IOLoop::run()
+{
+    // cf. the comment in BlockingTCPTransportCodec::receiveThread()
+    shared_pointer self(shared_from_this());
+    epoll_event events[maxEvents];
+    epicsTime lastCheck(epicsTime::getMonotonic());
+
+    while(true) {
+        int timeout = int(checkPeriod*1000);
+        {
+            // requests posted from this thread don't wake it up
+            Guard G(_mutex);
+            if(!_requests.empty())
+                timeout = 0;
+        }
+        int nfds = epoll_wait(_pollFd, events, maxEvents, timeout);
+
+        if(nfds < 0 && errno != EINTR) {
+            errlogPrintf("PVA I/O thread epoll_wait error: %d\n", errno);
+            epicsThreadSleep(1.0);
+        }
+
+        epicsTime now(epicsTime::getMonotonic());
+
+        for(int i = 0; i < nfds; i++) {
+            BlockingTCPTransportCodec *transport =
+                static_cast<BlockingTCPTransportCodec*>(events[i].data.ptr);
+
+            if(transport) {
+                // the rest of the pending output, then the send queue
+                if(events[i].events & EPOLLOUT)
+                    transport->ioSend();
+                // also on error or hangup, when reading fails and closes
+                if(events[i].events & ~EPOLLOUT)
+                    transport->ioRead(now);
+                updateEvents(transport);
+            } else {
+                uint64_t count;
+                if(::read(_wakeFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+                    errlogPrintf("PVA I/O thread wakeup error: %d\n", errno);
+            }
+        }
+
+        bool stopping = processRequests(now);
+
+        if(now - lastCheck >= checkPeriod) {
+            checkTimeouts(now);
+            lastCheck = now;
+        }
+
+        if(stopping) {
+            Guard G(_mutex);
+            if(_transports.empty() && _requests.empty()) {
+                // later removals are done by whoever closes
+                _stopped = true;
+                break;
+            }
+        }
+    }
+}
+
+bool IOLoop::waitSocket(SOCKET sock, bool forWrite, double timeout)
+{
+    pollfd fds;
+    fds.fd = sock;
+    fds.events = forWrite ? POLLOUT : POLLIN;
+    fds.revents = 0;
+
+    while(true) {
+        int ret = ::poll(&fds, 1, int(timeout*1000));
+        if(ret < 0 && errno == EINTR)
+            continue;
+        return ret > 0;
+    }
+}
+
+IOLoopGroup::shared_pointer IOLoopGroup::create(unsigned nThreads, const std::string& name)
+{
+    shared_pointer ret;
+
+    if(nThreads == 0u)
+        return ret;
+
+    ret.reset(new IOLoopGroup);
+    for(unsigned i = 0u; i < nThreads; i++) {
+        std::ostringstream loopName;
+        loopName << name << i;
+
+        IOLoop::shared_pointer loop(new IOLoop(loopName.str()));
+        ret->_loops.push_back(loop);
+        loop->start();
+    }
+    return ret;
+}
+
+#else // PVA_IO_LOOP
+
+IOLoop::IOLoop(const std::string& name)
+    :_stopping(true)
+    ,_stopped(true)
+    ,_pollFd(-1)
+    ,_wakeFd(-1)
+    ,_thread(*this, name.c_str(),
+             epicsThreadGetStackSize(epicsThreadStackSmall),
+             epicsThreadPriorityLow)
+{}
+
+IOLoop::~IOLoop() {}
+
+void IOLoop::start() {}
+
+bool IOLoop::add(std::tr1::shared_ptr<BlockingTCPTransportCodec> const &)
+{
+    return false;
+}
+
+void IOLoop::scheduleSend(BlockingTCPTransportCodec *) {}
+
+void IOLoop::detach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const &) {}
+
+void IOLoop::attach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const &) {}
+
+void IOLoop::remove(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport)
+{
+    transport->ioRemoved();
+}
+
+void IOLoop::stop() {}
+
+void IOLoop::run() {}
+
+bool IOLoop::waitSocket(SOCKET, bool, double)
+{
+    return false;
+}
+
+IOLoopGroup::shared_pointer IOLoopGroup::create(unsigned nThreads, const std::string& name)
+{
+    if(nThreads > 0u)
+        LOG(logLevelWarn, "EPICS_PVA_IO_THREADS is not supported on this target, "
+            "using threads for each connection");
+    return shared_pointer();
+}
+
+#endif // PVA_IO_LOOP
+
+IOLoopGroup::~IOLoopGroup()
+{
+    stop();
+}
+
+IOLoop::shared_pointer IOLoopGroup::next()
+{
+    size_t n = epics::atomic::increment(_next);
+    return _loops[n % _loops.size()];
+}
+
+void IOLoopGroup::stop()
+{
+    for(size_t i = 0u; i < _loops.size(); i++)
+        _loops[i]->stop();
+}
+
+}
+}
+}
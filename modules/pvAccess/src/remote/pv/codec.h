@@ -10,6 +10,7 @@
 #include <set>
 #include <map>
 #include <deque>
+#include <vector>
 
 #include <shareLib.h>
 #include <osiSock.h>
@@ -65,6 +66,8 @@ class ServerChannel;
 
 namespace detail {
 
+class IOLoop;
+
 template<typename T>
 class AtomicValue
 {
@@ -214,6 +217,28 @@ protected:
 
     virtual void setRxTimeout(bool ena) {}
 
+    /** Called by processRead(), with the header put back, for a message
+     *  which can't be buffered whole.
+     *  @returns true if another thread, which can wait for the rest of it,
+     *  takes over reading.  processRead() then returns.
+     */
+    virtual bool handOffMessage() { return false; }
+
+    /** Called by processRead() after each application message.
+     *  @returns true if the thread which took over with handOffMessage()
+     *  gives reading back.  processRead() then returns.
+     */
+    virtual bool handBackMessage() { return false; }
+
+    /** true if a whole message is in the receive buffer */
+    bool messageBuffered();
+
+    /** Send what the socket didn't take before.
+     *  @returns true once all of it is sent, false if the socket is full
+     *  and wait is false.
+     */
+    bool sendPending(bool wait);
+
     ReadMode _readMode;
     int8_t _version;
     int8_t _flags;
@@ -231,6 +256,19 @@ protected:
 
     fair_queue<TransportSender> _sendQueue;
 
+    /** processSendQueue() waits for more, rather than returning once
+     *  the queue is empty. */
+    bool _blockingProcessQueue;
+    /** processRead() buffers whole messages before handling them, where
+     *  they fit, rather than waiting in readPollOne() for the rest. */
+    bool _bufferMessages;
+    /** send() keeps what the socket doesn't take in _sendPending, rather
+     *  than waiting in sendBufferFull(). */
+    bool _bufferSends;
+    /** Output not yet taken by the socket, from _sendPendingPosition on */
+    std::vector<char> _sendPending;
+    std::size_t _sendPendingPosition;
+
 private:
 
     void processHeader();
@@ -238,6 +276,7 @@ private:
     void postProcessApplicationMessage();
     void processReadSegmented();
     bool readToBuffer(std::size_t requiredBytes, bool persistent);
+    void keepPending(epics::pvData::ByteBuffer *buffer);
     void endMessage(bool hasMoreSegments);
     void processSender(
         epics::pvAccess::TransportSender::shared_pointer const & sender);
@@ -287,7 +326,7 @@ public:
 
     virtual void readPollOne() OVERRIDE FINAL;
     virtual void writePollOne() OVERRIDE FINAL;
-    virtual void scheduleSend() OVERRIDE FINAL {}
+    virtual void scheduleSend() OVERRIDE FINAL;
     virtual void sendCompleted() OVERRIDE FINAL {}
     virtual void close() OVERRIDE FINAL;
     virtual void waitJoin() OVERRIDE FINAL;
@@ -391,14 +430,35 @@ public:
     virtual void sendSecurityPluginMessage(epics::pvData::PVStructure::const_shared_pointer const & data) OVERRIDE FINAL;
 
 private:
+    void createThreads();
     void receiveThread();
     void sendThread();
+    // the last of receiveThread() and sendThread() to hand back attaches
+    void ioThreadExit();
+
+    friend class IOLoop;
+
+    // called by the I/O thread, when there is one
+    void ioStart(const epicsTime& now);
+    void ioRead(const epicsTime& now);
+    void ioSend();
+    void ioDetached();
+    bool ioAttached(const epicsTime& now);
+    void ioRemoved();
+    bool ioIdle(const epicsTime& now) const;
+    void ioWait(bool forWrite);
+
+    double connectionTimeout();
 
 protected:
     virtual void setRxTimeout(bool ena) OVERRIDE FINAL;
 
     virtual void sendBufferFull(int tries) OVERRIDE FINAL;
 
+    virtual bool handOffMessage() OVERRIDE FINAL;
+
+    virtual bool handBackMessage() OVERRIDE FINAL;
+
     /**
      * Called from close(). after start of shutdown (isOpen()==false)
      * but before worker thread shutdown.
@@ -407,7 +467,21 @@ protected:
 
 private:
     AtomicValue<bool> _isOpen;
-    epics::pvData::Thread _readThread, _sendThread;
+    // with an I/O thread, these are only created by handOffMessage()
+    epics::auto_ptr<epics::pvData::Thread> _readThread, _sendThread;
+    std::tr1::shared_ptr<IOLoop> _ioLoop;
+    // the I/O thread has handed over to _readThread and _sendThread
+    AtomicValue<bool> _ioDetached;
+    // _readThread and _sendThread give back to the I/O thread
+    AtomicValue<bool> _ioHandBack;
+    // of _readThread and _sendThread, not yet done handing back
+    int _ioThreads;
+    AtomicValue<bool> _sendScheduled;
+    // EPOLLOUT is requested, I/O thread only
+    bool _ioPollOut;
+    epics::pvData::Event _ioRemoved;
+    epicsTime _lastRecv;
+    double _rxTimeout;
     const SOCKET _channel;
 protected:
     osiSockAddr _socketAddress;
@@ -0,0 +1,170 @@
+/**
+ * Copyright - See the COPYRIGHT that is included with this distribution.
+ * pvAccessCPP is distributed subject to a Software License Agreement found
+ * in file LICENSE that is included with this distribution.
+ */
+
+#ifndef IOLOOP_H
+#define IOLOOP_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef epicsExportSharedSymbols
+#   define ioLoopEpicsExportSharedSymbols
+#   undef epicsExportSharedSymbols
+#endif
+
+#include <osiSock.h>
+#include <epicsThread.h>
+#include <epicsTime.h>
+
+#include <pv/lock.h>
+#include <pv/sharedPtr.h>
+
+#ifdef ioLoopEpicsExportSharedSymbols
+#   define epicsExportSharedSymbols
+#       undef ioLoopEpicsExportSharedSymbols
+#endif
+
+namespace epics {
+namespace pvAccess {
+namespace detail {
+
+class BlockingTCPTransportCodec;
+
+/**
+ * One thread servicing the sockets of many TCP transports with epoll(),
+ * in place of a receive and a send thread for each transport.
+ *
+ * The thread reads from readable sockets, processes the send queues of
+ * transports which have something to send, and closes transports which
+ * have been inactive for longer than their receive timeout.
+ * Nothing here waits for a socket.  Output a socket doesn't take is kept
+ * by the transport until EPOLLOUT, and a transport receiving a message
+ * which can't be buffered whole is handed over to threads of its own
+ * until the message is through.
+ * Transports are added with add() and leave after Transport::close()
+ * calls remove().  The socket is destroyed by the I/O thread, after it
+ * is removed from the epoll set, to avoid a race with the re-use of
+ * the descriptor.
+ */
+class IOLoop :
+    public epicsThreadRunable,
+    public std::tr1::enable_shared_from_this<IOLoop>
+{
+public:
+    POINTER_DEFINITIONS(IOLoop);
+
+    IOLoop(const std::string& name);
+    virtual ~IOLoop();
+
+    /** Start servicing transport, which must have a non-blocking socket.
+     *  @returns false if the loop has been stopped.
+     */
+    bool add(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport);
+
+    /** Have the I/O thread process the send queue of transport. */
+    void scheduleSend(BlockingTCPTransportCodec *transport);
+
+    /** Stop servicing transport, and have it start threads of its own. */
+    void detach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport);
+
+    /** Service transport again, once the threads started by detach()
+     *  are done.
+     */
+    void attach(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport);
+
+    /** Stop servicing transport and destroy its socket.
+     *  Runs in the calling thread when the loop has been stopped.
+     */
+    void remove(std::tr1::shared_ptr<BlockingTCPTransportCodec> const & transport);
+
+    bool isCurrentThread() const {
+        return _thread.isCurrentThread();
+    }
+
+    /** Close all transports and wait for the thread to exit,
+     *  unless called from the I/O thread itself.
+     */
+    void stop();
+
+    /** Wait until sock is readable, or writable.  Only a fallback for
+     *  reads and writes on non-blocking sockets which must complete.
+     *  @returns false on timeout or error.
+     */
+    static bool waitSocket(SOCKET sock, bool forWrite, double timeout);
+
+    virtual void run();
+
+private:
+    friend class IOLoopGroup;
+
+    enum Op { opAdd, opSend, opDetach, opAttach, opRemove };
+
+    struct Request {
+        Op op;
+        BlockingTCPTransportCodec *transport;
+        std::tr1::shared_ptr<BlockingTCPTransportCodec> ref;
+    };
+
+    void start();
+    void post(Op op, BlockingTCPTransportCodec *transport,
+              std::tr1::shared_ptr<BlockingTCPTransportCodec> const & ref);
+    bool processRequests(const epicsTime& now);
+    bool watch(BlockingTCPTransportCodec *transport,
+               std::tr1::shared_ptr<BlockingTCPTransportCodec> const & ref);
+    void updateEvents(BlockingTCPTransportCodec *transport);
+    void checkTimeouts(const epicsTime& now);
+
+    typedef std::map<BlockingTCPTransportCodec*,
+                     std::tr1::shared_ptr<BlockingTCPTransportCodec> > transports_t;
+
+    // guarded by _mutex
+    mutable epics::pvData::Mutex _mutex;
+    std::vector<Request> _requests;
+    bool _stopping, _stopped;
+
+    // I/O thread only
+    transports_t _transports;
+
+    int _pollFd, _wakeFd;
+    epicsThread _thread;
+};
+
+/**
+ * The I/O threads of a client or server context.
+ *
+ * Created from $EPICS_PVA_IO_THREADS ($EPICS_PVAS_IO_THREADS for servers).
+ * With 0, or where epoll() isn't available, create() returns NULL and each
+ * transport keeps a receive and a send thread of its own.
+ */
+class IOLoopGroup {
+public:
+    POINTER_DEFINITIONS(IOLoopGroup);
+
+    static shared_pointer create(unsigned nThreads, const std::string& name);
+
+    ~IOLoopGroup();
+
+    /** The loop to service a new transport, round robin. */
+    IOLoop::shared_pointer next();
+
+    /** Close the remaining transports and stop the threads. */
+    void stop();
+
+    size_t size() const { return _loops.size(); }
+
+private:
+    IOLoopGroup() :_next(0u) {}
+
+    std::vector<IOLoop::shared_pointer> _loops;
+    size_t _next;
+};
+
+}
+}
+}
+
+#endif // IOLOOP_H
@@ -43,6 +43,10 @@ namespace pvAccess {
 class TransportRegistry;
 class ClientChannelImpl;
 
+namespace detail {
+class IOLoopGroup;
+}
+
 enum QoS {
     /**
      * Default behavior.
@@ -292,8 +296,13 @@ public:
 
     virtual TransportRegistry* getTransportRegistry() = 0;
 
-
-
+    /**
+     * I/O threads servicing the TCP transports of this context.
+     * @return NULL when each transport has a receive and a send thread.
+     */
+    virtual std::tr1::shared_ptr<detail::IOLoopGroup> getIOLoops() {
+        return std::tr1::shared_ptr<detail::IOLoopGroup>();
+    }
 
     virtual Configuration::const_shared_pointer getConfiguration() = 0;
 
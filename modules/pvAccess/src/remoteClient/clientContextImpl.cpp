@@ -30,6 +30,7 @@
 #include <pv/hexDump.h>
 #include <pv/remote.h>
 #include <pv/codec.h>
+#include <pv/ioLoop.h>
 #include <pv/channelSearchManager.h>
 #include <pv/serializationHelper.h>
 #include <pv/channelSearchManager.h>
@@ -3959,6 +3960,7 @@ public:
     InternalClientContextImpl(const Configuration::shared_pointer& conf) :
         m_addressList(""), m_autoAddressList(true), m_connectionTimeout(30.0f), m_beaconPeriod(15.0f),
         m_broadcastPort(PVA_BROADCAST_PORT), m_receiveBufferSize(MAX_TCP_RECV),
+        m_ioThreads(0),
         m_lastCID(0x10203040),
         m_lastIOID(0x80706050),
         m_version("pvAccess Client", "cpp",
@@ -3994,6 +3996,11 @@ public:
         return &m_transportRegistry;
     }
 
+    virtual std::tr1::shared_ptr<epics::pvAccess::detail::IOLoopGroup> getIOLoops() OVERRIDE FINAL
+    {
+        return m_ioLoops;
+    }
+
     virtual Transport::shared_pointer getSearchTransport() OVERRIDE FINAL
     {
         return m_searchTransport;
@@ -4023,6 +4030,7 @@ public:
         out << "BEACON_PERIOD      : " << m_beaconPeriod << std::endl;
         out << "BROADCAST_PORT     : " << m_broadcastPort << std::endl;;
         out << "RCV_BUFFER_SIZE    : " << m_receiveBufferSize << std::endl;
+        out << "IO_THREADS         : " << m_ioThreads << std::endl;
         out << "STATE              : ";
         switch (m_contextState)
         {
@@ -4086,6 +4094,10 @@ public:
 
         if (transportCount)
             LOG(logLevelDebug, "PVA client context destroyed with %u transport(s) active.", (unsigned)transportCount);
+
+        // closes any remaining transports
+        if (m_ioLoops)
+            m_ioLoops->stop();
     }
 
     virtual ~InternalClientContextImpl()
@@ -4115,12 +4127,14 @@ private:
         m_beaconPeriod = m_configuration->getPropertyAsFloat("EPICS_PVA_BEACON_PERIOD", m_beaconPeriod);
         m_broadcastPort = m_configuration->getPropertyAsInteger("EPICS_PVA_BROADCAST_PORT", m_broadcastPort);
         m_receiveBufferSize = m_configuration->getPropertyAsInteger("EPICS_PVA_MAX_ARRAY_BYTES", m_receiveBufferSize);
+        m_ioThreads = m_configuration->getPropertyAsInteger("EPICS_PVA_IO_THREADS", m_ioThreads);
     }
 
     void internalInitialize() {
 
         osiSockAttach();
         m_timer.reset(new Timer("pvAccess-client timer", lowPriority));
+        m_ioLoops = epics::pvAccess::detail::IOLoopGroup::create(m_ioThreads > 0 ? unsigned(m_ioThreads) : 0u, "PVA-io");
         InternalClientContextImpl::shared_pointer thisPointer(internal_from_this());
         // stores weak_ptr
         m_connector.reset(new BlockingTCPConnector(thisPointer, m_receiveBufferSize, m_connectionTimeout));
@@ -4453,6 +4467,17 @@ private:
      */
     int m_receiveBufferSize;
 
+    /**
+     * Number of I/O threads servicing all TCP connections,
+     * 0 for a receive and a send thread per connection.
+     */
+    int m_ioThreads;
+
+    /**
+     * I/O threads, if any.
+     */
+    std::tr1::shared_ptr<epics::pvAccess::detail::IOLoopGroup> m_ioLoops;
+
     /**
      * Timer.
      */
@@ -51,6 +51,7 @@ public:
     Transport::shared_pointer getSearchTransport() OVERRIDE FINAL;
     Configuration::const_shared_pointer getConfiguration() OVERRIDE FINAL;
     TransportRegistry* getTransportRegistry() OVERRIDE FINAL;
+    std::tr1::shared_ptr<detail::IOLoopGroup> getIOLoops() OVERRIDE FINAL;
 
     virtual void newServerDetected() OVERRIDE FINAL;
 
@@ -172,8 +173,19 @@ private:
      */
     epics::pvData::int32 _receiveBufferSize;
 
+    /**
+     * Number of I/O threads servicing all TCP connections,
+     * 0 for a receive and a send thread per connection.
+     */
+    epics::pvData::int32 _ioThreads;
+
     epics::pvData::Timer::shared_pointer _timer;
 
+    /**
+     * I/O threads, if any.
+     */
+    std::tr1::shared_ptr<detail::IOLoopGroup> _ioLoops;
+
     /**
      * UDP transports needed to receive channel searches.
      */
@@ -16,6 +16,7 @@
 #include <pv/logger.h>
 #include <pv/serverContextImpl.h>
 #include <pv/codec.h>
+#include <pv/ioLoop.h>
 #include <pv/security.h>
 
 using namespace std;
@@ -39,6 +40,7 @@ ServerContextImpl::ServerContextImpl():
     _broadcastPort(PVA_BROADCAST_PORT),
     _serverPort(PVA_SERVER_PORT),
     _receiveBufferSize(MAX_TCP_RECV),
+    _ioThreads(0),
     _timer(new Timer("PVAS timers", lowerPriority)),
     _beaconEmitter(),
     _acceptor(),
@@ -146,6 +148,9 @@ void ServerContextImpl::loadConfiguration()
     _receiveBufferSize = config->getPropertyAsInteger("EPICS_PVA_MAX_ARRAY_BYTES", _receiveBufferSize);
     _receiveBufferSize = config->getPropertyAsInteger("EPICS_PVAS_MAX_ARRAY_BYTES", _receiveBufferSize);
 
+    _ioThreads = config->getPropertyAsInteger("EPICS_PVA_IO_THREADS", _ioThreads);
+    _ioThreads = config->getPropertyAsInteger("EPICS_PVAS_IO_THREADS", _ioThreads);
+
     if(_channelProviders.empty()) {
         std::string providers = config->getPropertyAsString("EPICS_PVAS_PROVIDER_NAMES", PVACCESS_DEFAULT_PROVIDER);
 
@@ -249,6 +254,9 @@ ServerContextImpl::getCurrentConfig()
     SET("EPICS_PVAS_MAX_ARRAY_BYTES", getReceiveBufferSize());
     SET("EPICS_PVA_MAX_ARRAY_BYTES", getReceiveBufferSize());
 
+    SET("EPICS_PVAS_IO_THREADS", _ioThreads);
+    SET("EPICS_PVA_IO_THREADS", _ioThreads);
+
     SET("EPICS_PVAS_PROVIDER_NAMES", providerName.str());
 
 #undef SET
@@ -273,6 +281,8 @@ void ServerContextImpl::initialize()
     // we create reference cycles here which are broken by our shutdown() method,
     _responseHandler.reset(new ServerResponseHandler(thisServerContext));
 
+    _ioLoops = detail::IOLoopGroup::create(_ioThreads > 0 ? unsigned(_ioThreads) : 0u, "PVAS-io");
+
     _acceptor.reset(new BlockingTCPAcceptor(thisServerContext, _responseHandler, _ifaceAddr, _receiveBufferSize));
     _serverPort = ntohs(_acceptor->getBindAddress()->ia.sin_port);
 
@@ -349,6 +359,12 @@ void ServerContextImpl::shutdown()
     // this will also destroy all channels
     _transportRegistry.clear();
 
+    if (_ioLoops)
+    {
+        _ioLoops->stop();
+        _ioLoops.reset();
+    }
+
     // drop timer queue
     LEAK_CHECK(_timer, "_timer")
     _timer.reset();
@@ -381,6 +397,7 @@ void ServerContextImpl::printInfo(ostream& str, int lvl)
         SHOW(EPICS_PVAS_BEACON_PERIOD)
         SHOW(EPICS_PVAS_BROADCAST_PORT)
         SHOW(EPICS_PVAS_SERVER_PORT)
+        SHOW(EPICS_PVAS_IO_THREADS)
         SHOW(EPICS_PVAS_PROVIDER_NAMES)
 #undef SHOW
 
@@ -519,6 +536,11 @@ epics::pvAccess::TransportRegistry* ServerContextImpl::getTransportRegistry()
     return &_transportRegistry;
 }
 
+std::tr1::shared_ptr<detail::IOLoopGroup> ServerContextImpl::getIOLoops()
+{
+    return _ioLoops;
+}
+
 Channel::shared_pointer ServerContextImpl::getChannel(pvAccessID /*id*/)
 {
     // not used
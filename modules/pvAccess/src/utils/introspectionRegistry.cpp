@@ -4,6 +4,8 @@
  * in file LICENSE that is included with this distribution.
  */
 
+#include <algorithm>
+
 #define epicsExportSharedSymbols
 #include <pv/introspectionRegistry.h>
 #include <pv/serializationHelper.h>
@@ -34,12 +36,12 @@ void IntrospectionRegistry::reset()
 {
     _pointer = 1;
     _registry.clear();
+    _index.clear();
 }
 
 int16 IntrospectionRegistry::registerIntrospectionInterface(FieldConstPtr const & field, bool& existing)
 {
     int16 key;
-    // TODO this is slow
     if(registryContainsValue(field, key))
     {
         existing = true;
@@ -48,23 +50,56 @@ int16 IntrospectionRegistry::registerIntrospectionInterface(FieldConstPtr const
     {
         existing = false;
         key = _pointer++;
-        _registry[key] = field;
+        FieldConstPtr& entry = _registry[key];
+        if(entry) // keys wrapped around, forget the old one
+            _index.erase(entry.get());
+        entry = field;
+        _index[field.get()] = key;
     }
     return key;
 }
 
-// TODO slow !!!!
 bool IntrospectionRegistry::registryContainsValue(FieldConstPtr const & field, int16& key)
 {
-    for(registryMap_t::reverse_iterator registryRIter = _registry.rbegin(); registryRIter != _registry.rend(); registryRIter++)
-    {
-        if(*(field.get()) == *(registryRIter->second))
-        {
-            key = registryRIter->first;
-            return true;
+    // Fields are unique in FieldCreate's cache, so equal means same pointer
+    registryIndex_t::const_iterator it(_index.find(field.get()));
+    if(it == _index.end())
+        return false;
+    key = it->second;
+    return true;
+}
+
+bool IntrospectionRegistry::leafOnly(Structure const & structure)
+{
+    FieldConstPtrArray const & fields = structure.getFields();
+    for(size_t i=0, N=fields.size(); i<N; i++) {
+        const Type type = fields[i]->getType();
+        if(type!=scalar && type!=scalarArray)
+            return false;
+    }
+    return true;
+}
+
+void IntrospectionRegistry::serializeStructure(Structure const & structure, ByteBuffer* buffer, SerializableControl* control)
+{
+    int byteOrder = EPICS_BYTE_ORDER;
+    if(buffer->reverse<int16>())
+        byteOrder = EPICS_BYTE_ORDER==EPICS_ENDIAN_BIG ? EPICS_ENDIAN_LITTLE : EPICS_ENDIAN_BIG;
+
+    const std::vector<epicsUInt8>& encoded = structure.getSerialized(byteOrder);
+    const char *cur = (const char*)&encoded[0];
+    size_t count = encoded.size();
+
+    while(count) {
+        const size_t n = std::min(count, buffer->getRemaining());
+        if(n==0) {
+            control->flushSerializeBuffer();
+            continue;
         }
+        buffer->put(cur, 0, n);
+        cur += n;
+        count -= n;
     }
-    return false;
 }
 
 void IntrospectionRegistry::serialize(FieldConstPtr const & field, ByteBuffer* buffer, SerializableControl* control)
@@ -96,7 +131,13 @@ void IntrospectionRegistry::serialize(FieldConstPtr const & field, ByteBuffer* b
             }
         }
 
-        field->serialize(buffer, control);
+        // nested structures and unions go through the registry again,
+        // so that they are only sent once on each connection
+        if (field->getType() == structure &&
+                leafOnly(static_cast<Structure const &>(*field)))
+            serializeStructure(static_cast<Structure const &>(*field), buffer, control);
+        else
+            field->serialize(buffer, control);
     }
 }
 
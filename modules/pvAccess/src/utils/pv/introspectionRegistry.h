@@ -35,6 +35,7 @@ namespace epics {
 namespace pvAccess {
 
 typedef std::map<const short,epics::pvData::FieldConstPtr> registryMap_t;
+typedef std::map<const epics::pvData::Field*,epics::pvData::int16> registryIndex_t;
 
 
 /**
@@ -58,8 +59,6 @@ private:
      * Registers introspection interface and get it's ID. Always OUTGOING.
      * If it is already registered only preassigned ID is returned.
      *
-     * TODO !!!!!!this can get very slow in large maps. We need to change this !!!!!!
-     *
      * @param field introspection interface to register
      *
      * @return id of given introspection interface
@@ -104,6 +103,8 @@ public:
 
 private:
     registryMap_t _registry;
+    // reverse of _registry, for outgoing interfaces
+    registryIndex_t _index;
     epics::pvData::int16 _pointer;
 
     /**
@@ -112,6 +113,18 @@ private:
     static epics::pvData::FieldCreatePtr _fieldCreate;
 
     bool registryContainsValue(epics::pvData::FieldConstPtr const & field, epics::pvData::int16& key);
+
+    /**
+     * True if a Structure has only scalar and scalar array fields, so that
+     * its cached encoding is what serialize() would write field by field.
+     */
+    static bool leafOnly(epics::pvData::Structure const & structure);
+
+    /**
+     * Writes the full description of a leaf only Structure from its
+     * cached encoding.  The same bytes are then sent on every connection.
+     */
+    static void serializeStructure(epics::pvData::Structure const & structure, epics::pvData::ByteBuffer* buffer, epics::pvData::SerializableControl* control);
 };
 
 }
@@ -6,9 +6,12 @@
 #include <epicsUnitTest.h>
 #include <testMain.h>
 #include <pv/byteBuffer.h>
+#include <pv/pvData.h>
 
 #include <pv/codec.h>
 #include <pv/current_function.h>
+#include <pv/introspectionRegistry.h>
+#include <pv/standardField.h>
 
 using namespace epics::pvData;
 using namespace epics::pvAccess::detail;
@@ -104,6 +107,8 @@ public:
         _readPayload(false),
         _disconnected(false),
         _forcePayloadRead(-1),
+        _directDeserialized(false),
+        _directDeserializeCount(0),
         _readBuffer(new ByteBuffer(receiveBufferSize)),
         _writeBuffer(sendBufferSize),
         _dummyAddress()
@@ -219,7 +224,18 @@ public:
         PVAMessage caMessage(_version, _flags,
                              _command, _payloadSize);
 
-        if (_readPayload && _payloadSize > 0)
+        if (_pvArray)
+        {
+            // payload is a serialized array, possibly segmented
+            _pvArray->deserialize(&_socketBuffer, this);
+        }
+        else if (!_directArray.empty())
+        {
+            // payload is an array, possibly segmented
+            _directDeserialized = AbstractCodec::directDeserialize(
+                &_socketBuffer, &_directArray[0], _directArray.size(), 1);
+        }
+        else if (_readPayload && _payloadSize > 0)
         {
             // no fragmentation supported by this implementation
             std::size_t toRead =
@@ -334,7 +350,13 @@ public:
         char* deserializeTo,
         std::size_t elementCount,
         std::size_t elementSize)  {
-        return false;
+        if (!_pvArray)
+            return false;
+        bool done = AbstractCodec::directDeserialize(existingBuffer,
+            deserializeTo, elementCount, elementSize);
+        if (done)
+            _directDeserializeCount++;
+        return done;
     }
 
     std::tr1::shared_ptr<const Field>
@@ -400,6 +422,10 @@ public:
     bool _readPayload;
     bool _disconnected;
     int _forcePayloadRead;
+    std::vector<char> _directArray;
+    bool _directDeserialized;
+    PVScalarArray::shared_pointer _pvArray;
+    std::size_t _directDeserializeCount;
 
     epics::auto_ptr<epics::pvData::ByteBuffer> _readBuffer;
     epics::pvData::ByteBuffer _writeBuffer;
@@ -427,12 +453,39 @@ protected:
 };
 
 
+// Both ends of one connection's type cache
+struct RegistryControl : public SerializableControl, public DeserializableControl
+{
+    IntrospectionRegistry out, in;
+
+    void flushSerializeBuffer() {
+        testAbort("RegistryControl buffer too small");
+    }
+    void ensureBuffer(std::size_t) {}
+    bool directSerialize(ByteBuffer *, const char *, std::size_t, std::size_t) {
+        return false;
+    }
+    void cachedSerialize(std::tr1::shared_ptr<const Field> const & field,
+                         ByteBuffer *buffer) {
+        out.serialize(field, buffer, this);
+    }
+
+    void ensureData(std::size_t) {}
+    bool directDeserialize(ByteBuffer *, char *, std::size_t, std::size_t) {
+        return false;
+    }
+    std::tr1::shared_ptr<const Field> cachedDeserialize(ByteBuffer *buffer) {
+        return in.deserialize(buffer, this);
+    }
+};
+
+
 class CodecTest {
 
 public:
 
     int runAllTest() {
-        testPlan(5883);
+        testPlan(5906);
         testHeaderProcess();
         testInvalidHeaderMagic();
         testInvalidHeaderSegmentedInNormal();
@@ -444,6 +497,9 @@ public:
         //testSegmentedInvalidInBetweenFlagsMessage();
         testSegmentedMessageAlignment();
         testSegmentedSplitMessage();
+        testDirectDeserialize();
+        testDirectDeserializeSwapped<PVIntArray>();
+        testDirectDeserializeSwapped<PVDoubleArray>();
         testStartMessage();
         testStartMessageNonEmptyPayload();
         testStartMessageNormalAlignment();
@@ -461,6 +517,7 @@ public:
         testDefaultModes();
         testEnqueueSendRequestExceptionThrown();
         testBlockingProcessQueueTest();
+        testIntrospectionRegistry();
         return testDone();
     }
 
@@ -1469,6 +1526,149 @@ private:
     }
 
 
+    void testDirectDeserialize()
+    {
+        testDiag("BEGIN TEST %s:", CURRENT_FUNCTION);
+        TestCodec codec(DEFAULT_BUFFER_SIZE,DEFAULT_BUFFER_SIZE);
+
+        // more than fits the receive buffer, in two segments
+        const int32_t payloadSize1 = 40000, payloadSize2 = 30000;
+        codec._readBuffer.reset(new ByteBuffer(payloadSize1 + payloadSize2 + 64));
+        codec._directArray.resize(payloadSize1 + payloadSize2);
+
+        int32_t c = 0;
+
+        // 1st
+        codec._readBuffer->put(PVA_MAGIC);
+        codec._readBuffer->put(PVA_CLIENT_PROTOCOL_REVISION);
+        codec._readBuffer->put((int8_t)0x90);
+        codec._readBuffer->put((int8_t)0x01);
+        codec._readBuffer->putInt(payloadSize1);
+
+        for (int32_t i = 0; i < payloadSize1; i++)
+            codec._readBuffer->put((int8_t)(c++ * 7));
+
+        // control in between
+        codec._readBuffer->put(PVA_MAGIC);
+        codec._readBuffer->put(PVA_CLIENT_PROTOCOL_REVISION);
+        codec._readBuffer->put((int8_t)0x81);
+        codec._readBuffer->put((int8_t)0xEE);
+        codec._readBuffer->putInt(0xDDCCBBAA);
+
+        // 2nd (last)
+        codec._readBuffer->put(PVA_MAGIC);
+        codec._readBuffer->put(PVA_CLIENT_PROTOCOL_REVISION);
+        codec._readBuffer->put((int8_t)0xA0);
+        codec._readBuffer->put((int8_t)0x01);
+        codec._readBuffer->putInt(payloadSize2);
+
+        for (int32_t i = 0; i < payloadSize2; i++)
+            codec._readBuffer->put((int8_t)(c++ * 7));
+
+        codec._readBuffer->flip();
+
+        codec.processRead();
+
+        testOk(codec._invalidDataStreamCount == 0,
+               "%s: codec._invalidDataStreamCount == 0",
+               CURRENT_FUNCTION);
+        testOk(codec._closedCount == 0,
+               "%s: codec._closedCount == 0", CURRENT_FUNCTION);
+        testOk(codec._receivedControlMessages.size() == 1,
+               "%s: codec._receivedControlMessages.size() == 1 ",
+               CURRENT_FUNCTION);
+        testOk(codec._receivedAppMessages.size() == 1,
+               "%s: codec._receivedAppMessages.size() == 1",
+               CURRENT_FUNCTION);
+        testOk(codec._readPollOneCount == 0,
+               "%s: codec._readPollOneCount == 0", CURRENT_FUNCTION);
+        testOk(codec._directDeserialized,
+               "%s: codec._directDeserialized", CURRENT_FUNCTION);
+        testOk(codec._readBuffer->getRemaining() == 0,
+               "%s: codec._readBuffer->getRemaining() == 0", CURRENT_FUNCTION);
+
+        bool match = true;
+        for (int32_t i = 0; i < c; i++)
+            match &= codec._directArray[i] == (char)(i * 7);
+        testOk(match, "%s: array received", CURRENT_FUNCTION);
+    }
+
+
+    template<typename PVT>
+    void testDirectDeserializeSwapped()
+    {
+        typedef typename PVT::value_type value_type;
+
+        testDiag("BEGIN TEST %s: %s", CURRENT_FUNCTION,
+                 ScalarTypeFunc::name(PVT::typeCode));
+        TestCodec codec(DEFAULT_BUFFER_SIZE,DEFAULT_BUFFER_SIZE);
+
+        // the peer sends in the byte order which this host doesn't use
+        const int byteOrder = EPICS_BYTE_ORDER == EPICS_ENDIAN_BIG ?
+            EPICS_ENDIAN_LITTLE : EPICS_ENDIAN_BIG;
+        codec.setByteOrder(byteOrder);
+
+        // 80000 bytes, split in the middle of an element
+        const int32_t count = 80000 / sizeof(value_type);
+        const int32_t payloadSize = 5 + count * sizeof(value_type);
+        const int32_t payloadSize1 = 40003;
+        const int32_t payloadSize2 = payloadSize - payloadSize1;
+
+        ByteBuffer payload(payloadSize, byteOrder);
+        payload.putByte((int8_t)-2);
+        payload.putInt(count);
+        for (int32_t i = 0; i < count; i++)
+            payload.put<value_type>((value_type)(i * 1001 - 5000000));
+        payload.flip();
+
+        codec._readBuffer.reset(new ByteBuffer(payloadSize + 64, byteOrder));
+
+        // 1st
+        codec._readBuffer->put(PVA_MAGIC);
+        codec._readBuffer->put(PVA_CLIENT_PROTOCOL_REVISION);
+        codec._readBuffer->put((int8_t)(0x10 | (byteOrder == EPICS_ENDIAN_BIG ? 0x80 : 0x00)));
+        codec._readBuffer->put((int8_t)0x01);
+        codec._readBuffer->putInt(payloadSize1);
+        for (int32_t i = 0; i < payloadSize1; i++)
+            codec._readBuffer->putByte(payload.getByte());
+
+        // 2nd (last)
+        codec._readBuffer->put(PVA_MAGIC);
+        codec._readBuffer->put(PVA_CLIENT_PROTOCOL_REVISION);
+        codec._readBuffer->put((int8_t)(0x20 | (byteOrder == EPICS_ENDIAN_BIG ? 0x80 : 0x00)));
+        codec._readBuffer->put((int8_t)0x01);
+        codec._readBuffer->putInt(payloadSize2);
+        for (int32_t i = 0; i < payloadSize2; i++)
+            codec._readBuffer->putByte(payload.getByte());
+
+        codec._readBuffer->flip();
+
+        typename PVT::shared_pointer pvArray(
+            getPVDataCreate()->createPVScalarArray<PVT>());
+        codec._pvArray = pvArray;
+
+        codec.processRead();
+
+        testOk(codec._invalidDataStreamCount == 0,
+               "%s: codec._invalidDataStreamCount == 0",
+               CURRENT_FUNCTION);
+        testOk(codec._receivedAppMessages.size() == 1,
+               "%s: codec._receivedAppMessages.size() == 1",
+               CURRENT_FUNCTION);
+        testOk(codec._directDeserializeCount == 1,
+               "%s: codec._directDeserializeCount == 1", CURRENT_FUNCTION);
+        testOk(codec._readBuffer->getRemaining() == 0,
+               "%s: codec._readBuffer->getRemaining() == 0", CURRENT_FUNCTION);
+
+        typename PVT::const_svector value(pvArray->view());
+        bool match = value.size() == (size_t)count;
+        for (int32_t i = 0; match && i < count; i++)
+            match = value[i] == (value_type)(i * 1001 - 5000000);
+        testOk(match, "%s: %d swapped elements received",
+               CURRENT_FUNCTION, count);
+    }
+
+
     void testStartMessage()
     {
         testDiag("BEGIN TEST %s:", CURRENT_FUNCTION);
@@ -2914,6 +3114,44 @@ private:
         thr.exitWait();
     }
 
+    void testIntrospectionRegistry()
+    {
+        testDiag("BEGIN TEST %s:", CURRENT_FUNCTION);
+
+        RegistryControl control;
+        ByteBuffer buffer(DEFAULT_BUFFER_SIZE);
+        StructureConstPtr type1(getStandardField()->scalar(pvDouble, "alarm,timeStamp"));
+        StructureConstPtr type2(getStandardField()->scalar(pvInt, "alarm,timeStamp"));
+        std::vector<epicsUInt8> full2;
+        serializeToVector(type2.get(), EPICS_BYTE_ORDER, full2);
+
+        control.cachedSerialize(type1, &buffer);
+        std::size_t size1 = buffer.getPosition();
+        control.cachedSerialize(type2, &buffer);
+        std::size_t size2 = buffer.getPosition() - size1;
+        control.cachedSerialize(type1, &buffer);
+        std::size_t size3 = buffer.getPosition() - size1 - size2;
+
+        testOk(size2 < full2.size(),
+               "Nested types already sent go by ID (%u < %u bytes)",
+               (unsigned)size2, (unsigned)full2.size());
+        testOk(size3 == 3u, "Second time only the ID (%u bytes)", (unsigned)size3);
+
+        buffer.flip();
+        testOk1(control.cachedDeserialize(&buffer) == type1);
+        testOk1(control.cachedDeserialize(&buffer) == type2);
+
+        // a structure without nested types is sent from its cached encoding
+        IntrospectionRegistry registry;
+        StructureConstPtr alarm(getStandardField()->alarm());
+        const std::vector<epicsUInt8>& encoded(alarm->getSerialized(EPICS_BYTE_ORDER));
+        buffer.clear();
+        registry.serialize(alarm, &buffer, &control);
+        testOk(buffer.getPosition() == 3u + encoded.size() &&
+               memcmp(buffer.getBuffer() + 3, &encoded[0], encoded.size()) == 0,
+               "Leaf only structure sent from its cached encoding");
+    }
+
 private:
 
     AtomicValue<bool> _processTreadExited;
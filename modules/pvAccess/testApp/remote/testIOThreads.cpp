@@ -0,0 +1,262 @@
+/*
+ * Copyright information and license terms for this software can be
+ * found in the file LICENSE that is included with the distribution
+ */
+
+/* TCP connections served by threads of their own, or by the epoll I/O
+ * threads: arrays larger than the receive buffer, and a client which
+ * stops reading.
+ */
+
+#include <string.h>
+
+#include <epicsEvent.h>
+#include <epicsThread.h>
+
+#include <pv/pvUnitTest.h>
+#include <testMain.h>
+
+#include <pv/epicsException.h>
+#include <pv/serverContext.h>
+#include <pva/client.h>
+#include <pva/sharedstate.h>
+
+namespace pvd = epics::pvData;
+namespace pva = epics::pvAccess;
+
+namespace {
+
+const pvd::StructureConstPtr bigType(pvd::getFieldCreate()->createFieldBuilder()
+                                     ->addArray("value", pvd::pvDouble)
+                                     ->createStructure());
+
+const pvd::StructureConstPtr smallType(pvd::getFieldCreate()->createFieldBuilder()
+                                       ->add("value", pvd::pvDouble)
+                                       ->createStructure());
+
+// 8 MB, much more than the receive buffer and the socket buffers
+const size_t bigCount = 1024u*1024u;
+
+pvd::shared_vector<const double> bigArray(double k)
+{
+    pvd::shared_vector<double> ret(bigCount);
+    for(size_t i=0; i<bigCount; i++)
+        ret[i] = k*1e7 + i;
+    return pvd::freeze(ret);
+}
+
+// the k of a bigArray(), or -1 if any element is wrong
+double arrayValue(const pvd::PVStructure& root)
+{
+    pvd::shared_vector<const double> value(root.getSubFieldT<pvd::PVDoubleArray>("value")->view());
+    if(value.size()!=bigCount)
+        return -1.0;
+    double k = value[0]/1e7;
+    for(size_t i=0; i<bigCount; i++) {
+        if(value[i]!=k*1e7 + i)
+            return -1.0;
+    }
+    return k;
+}
+
+size_t nConnectionThreads;
+
+void countConnectionThreads(epicsThreadId id)
+{
+    char name[16];
+    epicsThreadGetName(id, name, sizeof(name));
+    if(strcmp(name, "TCP-rx")==0 || strcmp(name, "TCP-tx")==0)
+        nConnectionThreads++;
+}
+
+// the receive and send threads of all connections
+size_t connectionThreads()
+{
+    nConnectionThreads = 0u;
+    epicsThreadMap(&countConnectionThreads);
+    return nConnectionThreads;
+}
+
+struct Server {
+    std::tr1::shared_ptr<pvas::StaticProvider> prov;
+    pvas::SharedPV::shared_pointer big, small;
+    pva::ServerContext::shared_pointer server;
+
+    explicit Server(const char *ioThreads)
+        :prov(new pvas::StaticProvider("test"))
+        ,big(pvas::SharedPV::buildMailbox())
+        ,small(pvas::SharedPV::buildMailbox())
+    {
+        big->open(bigType);
+        small->open(smallType);
+        prov->add("big", big);
+        prov->add("small", small);
+
+        post(1.0);
+        {
+            pvd::PVStructurePtr inst(pvd::getPVDataCreate()->createPVStructure(smallType));
+            pvd::BitSet changed;
+            pvd::PVDoublePtr value(inst->getSubFieldT<pvd::PVDouble>("value"));
+            value->put(42.0);
+            changed.set(value->getFieldOffset());
+            small->post(*inst, changed);
+        }
+
+        server = pva::ServerContext::create(pva::ServerContext::Config()
+                                            .config(pva::ConfigurationBuilder()
+                                                    .add("EPICS_PVA_IO_THREADS", ioThreads)
+                                                    .add("EPICS_PVAS_INTF_ADDR_LIST", "127.0.0.1")
+                                                    .add("EPICS_PVA_ADDR_LIST", "127.0.0.1")
+                                                    .add("EPICS_PVA_AUTO_ADDR_LIST","0")
+                                                    .add("EPICS_PVA_SERVER_PORT", "0")
+                                                    .add("EPICS_PVA_BROADCAST_PORT", "0")
+                                                    .push_map()
+                                                    .build())
+                                            .provider(prov->provider()));
+    }
+
+    ~Server()
+    {
+        server.reset();
+        big->close();
+        small->close();
+    }
+
+    void post(double k)
+    {
+        pvd::PVStructurePtr inst(pvd::getPVDataCreate()->createPVStructure(bigType));
+        pvd::BitSet changed;
+        pvd::PVDoubleArrayPtr value(inst->getSubFieldT<pvd::PVDoubleArray>("value"));
+        value->replace(bigArray(k));
+        changed.set(value->getFieldOffset());
+        big->post(*inst, changed);
+    }
+
+    pvac::ClientProvider client(const char *ioThreads)
+    {
+        return pvac::ClientProvider("pva", pva::ConfigurationBuilder()
+                                    .push_config(server->getCurrentConfig())
+                                    .add("EPICS_PVA_IO_THREADS", ioThreads)
+                                    .push_map()
+                                    .build());
+    }
+};
+
+void testLargeArray(const char *ioThreads)
+{
+    testDiag("Arrays larger than the receive buffer, EPICS_PVA_IO_THREADS=%s", ioThreads);
+    bool ioLoop = strcmp(ioThreads, "0")!=0;
+    size_t before = connectionThreads();
+    try {
+        Server serv(ioThreads);
+        pvac::ClientProvider cli(serv.client(ioThreads));
+        pvac::ClientChannel big(cli.connect("big"));
+
+        big.put().set("value", bigArray(2.0)).exec(10.0);
+        testEqual(arrayValue(*big.get(10.0)), 2.0);
+
+        testDiag("Again on the same connection");
+        big.put().set("value", bigArray(3.0)).exec(10.0);
+        testEqual(arrayValue(*big.get(10.0)), 3.0);
+
+        pvac::ClientChannel small(cli.connect("small"));
+        testEqual(small.get(5.0)->getSubFieldT<pvd::PVDouble>("value")->get(), 42.0);
+
+        if(ioLoop) {
+            // both ends hand back to their I/O thread after each array
+            size_t after = connectionThreads();
+            for(unsigned i=0u; i<50u && after > before; i++) {
+                epicsThreadSleep(0.1);
+                after = connectionThreads();
+            }
+            testOk(after <= before, "Connection threads %u -> %u after the arrays",
+                   unsigned(before), unsigned(after));
+        } else {
+            testSkip(1, "Threads for each connection");
+        }
+
+    }catch(std::exception& e){
+        PRINT_EXCEPTION(e);
+        testAbort("Unexpected exception: %s", e.what());
+    }
+}
+
+// stops the receive thread of its client in the first update
+struct StallingMonitor : public pvac::ClientChannel::MonitorCallback
+{
+    epicsEvent stalled, release, update;
+    bool first;
+
+    StallingMonitor() :first(true) {}
+    virtual ~StallingMonitor() {}
+
+    virtual void monitorEvent(const pvac::MonitorEvent& evt) OVERRIDE FINAL
+    {
+        if(evt.event!=pvac::MonitorEvent::Data)
+            return;
+        if(first) {
+            first = false;
+            stalled.signal();
+            release.wait();
+        }
+        update.signal();
+    }
+};
+
+void testStalledReader(const char *ioThreads)
+{
+    testDiag("A client which stops reading, EPICS_PVA_IO_THREADS=%s", ioThreads);
+    try {
+        Server serv(ioThreads);
+        pvac::ClientProvider stalling(serv.client("0")),
+                             other(serv.client(ioThreads));
+        pvac::ClientChannel big(stalling.connect("big"));
+        StallingMonitor cb;
+        pvac::Monitor mon(big.monitor(&cb));
+
+        testOk(cb.stalled.wait(10.0), "First update arrived");
+
+        // far more than the socket buffers take
+        for(unsigned k=2u; k<=5u; k++)
+            serv.post(k);
+        epicsThreadSleep(0.5);
+
+        testDiag("Other clients are served meanwhile");
+        pvac::ClientChannel small(other.connect("small"));
+        testEqual(small.get(5.0)->getSubFieldT<pvd::PVDouble>("value")->get(), 42.0);
+
+        cb.release.signal();
+
+        double last = -2.0;
+        for(unsigned i=0u; i<20u && last!=5.0; i++) {
+            while(mon.poll()) {
+                double k = arrayValue(*mon.root);
+                if(k < last)
+                    last = -1.0;
+                else
+                    last = k;
+            }
+            if(last!=5.0)
+                cb.update.wait(0.5);
+        }
+        testEqual(last, 5.0);
+
+        mon.cancel();
+    }catch(std::exception& e){
+        PRINT_EXCEPTION(e);
+        testAbort("Unexpected exception: %s", e.what());
+    }
+}
+
+} // namespace
+
+MAIN(testIOThreads)
+{
+    testPlan(14);
+    // threads for each connection, then epoll I/O threads
+    testLargeArray("0");
+    testLargeArray("1");
+    testStalledReader("0");
+    testStalledReader("1");
+    return testDone();
+}
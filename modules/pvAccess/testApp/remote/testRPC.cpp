@@ -106,15 +106,14 @@ void testRPCFail(const pva::ChannelProvider::shared_pointer& cli_prov)
     }
 }
 
-} // namespace
-
-MAIN(testRPC)
+void testRPCServer(const char *ioThreads)
 {
-    testPlan(3);
+    testDiag("With EPICS_PVA_IO_THREADS=%s", ioThreads);
     try {
         pva::Configuration::shared_pointer conf(pva::ConfigurationBuilder()
                                                 //.push_env()
                                                 //.add("EPICS_PVA_DEBUG", "3")
+                                                .add("EPICS_PVA_IO_THREADS", ioThreads)
                                                 .add("EPICS_PVAS_INTF_ADDR_LIST", "127.0.0.1")
                                                 .add("EPICS_PVA_ADDR_LIST", "127.0.0.1")
                                                 .add("EPICS_PVA_AUTO_ADDR_LIST","0")
@@ -153,5 +152,15 @@ MAIN(testRPC)
         PRINT_EXCEPTION(e);
         testAbort("Unexpected exception: %s", e.what());
     }
+}
+
+} // namespace
+
+MAIN(testRPC)
+{
+    testPlan(6);
+    // threads for each connection, then epoll I/O threads
+    testRPCServer("0");
+    testRPCServer("2");
     return testDone();
 }
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <map>
 #include <string>
 #include <cstdio>
 #include <stdexcept>
@@ -35,6 +36,18 @@ namespace epics { namespace pvData {
 
 size_t Field::num_instances;
 
+namespace {
+// Structure::getSerialized() results, in little and big endian byte order.
+// Kept here rather than in Structure to leave its layout unchanged.
+struct StructureEncoding {
+    std::vector<epicsUInt8> order[2];
+};
+typedef std::map<const Structure*, StructureEncoding> encodings_t;
+}
+
+// guarded by FieldCreate::mutex, created with the FieldCreate
+static encodings_t *structureEncodings;
+
 
 struct Field::Helper {
     static unsigned hash(Field *fld) {
@@ -550,6 +563,10 @@ Structure::Structure (
 Structure::~Structure()
 {
     cacheCleanup();
+
+    const FieldCreatePtr& create(getFieldCreate());
+    Lock G(create->mutex);
+    structureEncodings->erase(this);
 }
 
 
@@ -658,6 +675,29 @@ void Structure::deserialize(ByteBuffer* /*buffer*/, DeserializableControl* /*con
     throw std::runtime_error("not valid operation, use FieldCreate::deserialize instead");
 }
 
+const std::vector<epicsUInt8>& Structure::getSerialized(int byteOrder) const
+{
+    const FieldCreatePtr& create(getFieldCreate());
+    const int idx = byteOrder==EPICS_ENDIAN_BIG ? 1 : 0;
+    {
+        Lock G(create->mutex);
+        // map entries don't move, so this stays valid until ~Structure
+        std::vector<epicsUInt8>& ret = (*structureEncodings)[this].order[idx];
+        if(!ret.empty())
+            return ret;
+    }
+
+    // never empty once computed.  Racing callers may both do this.
+    std::vector<epicsUInt8> encoded;
+    serializeToVector(this, byteOrder, encoded);
+
+    Lock G(create->mutex);
+    std::vector<epicsUInt8>& ret = (*structureEncodings)[this].order[idx];
+    if(ret.empty())
+        ret.swap(encoded);
+    return ret;
+}
+
 std::tr1::shared_ptr<PVStructure> Structure::build() const
 {
     return getPVDataCreate()->createPVStructure(std::tr1::static_pointer_cast<const Structure>(shared_from_this()));
@@ -1610,6 +1650,7 @@ static epicsThreadOnceId field_factory_once = EPICS_THREAD_ONCE_INIT;
 static void field_factory_init(void*)
 {
     try {
+        structureEncodings = new encodings_t;
         field_factory_s = new detail::field_factory;
     }catch(std::exception& e){
         std::cerr<<"Error initializing getFieldCreate() : "<<e.what()<<"\n";
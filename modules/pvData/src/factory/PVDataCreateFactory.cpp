@@ -320,16 +320,24 @@ void PVValueArray<T>::deserialize(ByteBuffer *pbuffer,
                 this->getArray()->getMaximumCapacity() :
                 SerializeHelper::readSize(pbuffer, pcontrol);
 
-    svector nextvalue(thaw(value));
-    nextvalue.resize(size); // TODO: avoid copy of stuff we will then overwrite
+    // re-use the storage if no one else references it,
+    // but don't copy old values which will be overwritten
+    svector nextvalue;
+    if (value.unique())
+        nextvalue = thaw(value);
+    if (nextvalue.capacity() < size)
+        nextvalue.clear();
+    nextvalue.resize(size);
 
     T* cur = nextvalue.data();
 
-    // try to avoid deserializing from the buffer
-    // this is only possible if we do not need to do endian-swapping
-    if (!pbuffer->reverse<T>())
-        if (pcontrol->directDeserialize(pbuffer, (char*)cur, size, sizeof(T)))
-        {
+    // try to avoid deserializing from the buffer.
+    // the control copies bytes as received, swap them in place if necessary
+    if (pcontrol->directDeserialize(pbuffer, (char*)cur, size, sizeof(T)))
+    {
+        if (pbuffer->reverse<T>())
+            epics::pvData::swapArray<T>(cur, cur, size);
+        value = freeze(nextvalue);
         // inform about the change?
         PVField::postPut();
         return;
@@ -12,6 +12,10 @@
 #include <stdexcept>
 #include <algorithm>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
 #include <epicsMutex.h>
 
 #define epicsExportSharedSymbols
@@ -41,6 +45,25 @@
 // so the last word should always have a bit set when the set is not empty
 #define CHECK_POST() assert(words.empty() || words.back()!=0)
 
+// use the population count instruction when the target is known to have one.
+// GCC otherwise calls a table driven helper, slower than the code below.
+#if defined(__GNUC__) && (defined(__POPCNT__) || defined(__aarch64__))
+#  define BITSET_POPCOUNT(X) ((uint32)__builtin_popcountll(X))
+#endif
+
+namespace {
+using epics::pvData::uint64;
+
+// the count of one-bits in each byte of x
+inline uint64 byteCounts(uint64 x)
+{
+    // HD, Figure 5-2
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    return (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+}
+}
+
 namespace epics { namespace pvData {
 
     BitSet::shared_pointer BitSet::create(uint32 nbits)
@@ -138,9 +161,16 @@ namespace epics { namespace pvData {
     }
 
     uint32 BitSet::numberOfTrailingZeros(uint64 i) {
+        if (i == 0) return 64;
+#if defined(__GNUC__)
+        return (uint32)__builtin_ctzll(i);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long idx;
+        _BitScanForward64(&idx, i);
+        return (uint32)idx;
+#else
         // HD, Figure 5-14
         uint32 x, y;
-        if (i == 0) return 64;
         uint32 n = 63;
         y = (uint32)i; if (y != 0) { n = n -32; x = y; } else x = (uint32)(i>>32);
         y = x <<16; if (y != 0) { n = n -16; x = y; }
@@ -148,34 +178,38 @@ namespace epics { namespace pvData {
         y = x << 4; if (y != 0) { n = n - 4; x = y; }
         y = x << 2; if (y != 0) { n = n - 2; x = y; }
         return n - ((x << 1) >> 31);
+#endif
     }
 
     uint32 BitSet::bitCount(uint64 i) {
-        // HD, Figure 5-14
-        i = i - ((i >> 1) & 0x5555555555555555LL);
-        i = (i & 0x3333333333333333LL) + ((i >> 2) & 0x3333333333333333LL);
-        i = (i + (i >> 4)) & 0x0f0f0f0f0f0f0f0fLL;
+#ifdef BITSET_POPCOUNT
+        return BITSET_POPCOUNT(i);
+#else
+        // HD, Figure 5-2
+        i = byteCounts(i);
         i = i + (i >> 8);
         i = i + (i >> 16);
         i = i + (i >> 32);
         return (uint32)(i & 0x7f);
+#endif
      }
 
     int32 BitSet::nextSetBit(uint32 fromIndex) const {
 
-        uint32 u = WORD_INDEX(fromIndex);
-        if (u >= words.size())
+        const size_t nwords = words.size();
+        size_t u = WORD_INDEX(fromIndex);
+        if (u >= nwords)
             return -1;
 
-        uint64 word = words[u] & (WORD_MASK << (fromIndex % BITS_PER_WORD));
+        const uint64 *w = &words[0];
+        uint64 word = w[u] & (WORD_MASK << (fromIndex % BITS_PER_WORD));
 
-        while (true) {
-            if (word != 0)
-                return (u * BITS_PER_WORD) + numberOfTrailingZeros(word);
-            if (++u == words.size())
+        while (word == 0) {
+            if (++u == nwords)
                 return -1;
-            word = words[u];
+            word = w[u];
         }
+        return (int32)(u * BITS_PER_WORD + numberOfTrailingZeros(word));
     }
 
     int32 BitSet::nextClearBit(uint32 fromIndex) const {
@@ -201,9 +235,26 @@ namespace epics { namespace pvData {
     }
 
     uint32 BitSet::cardinality() const {
+        const size_t n = words.size();
+        if (n == 0)
+            return 0;
+        const uint64 *w = &words[0];
         uint32 sum = 0;
-        for (uint32 i = 0; i < words.size(); i++)
-            sum += bitCount(words[i]);
+#ifdef BITSET_POPCOUNT
+        for (size_t i = 0; i < n; i++)
+            sum += BITSET_POPCOUNT(w[i]);
+#else
+        // add the per byte counts of up to 31 words (each <= 8*31 = 248)
+        // before summing the bytes.
+        for (size_t i = 0; i < n; ) {
+            const size_t end = std::min(n, i + 31u);
+            uint64 acc = 0;
+            for (; i < end; i++)
+                acc += byteCounts(w[i]);
+            acc = (acc & 0x00ff00ff00ff00ffULL) + ((acc >> 8) & 0x00ff00ff00ff00ffULL);
+            sum += (uint32)((acc * 0x0001000100010001ULL) >> 48);
+        }
+#endif
         return sum;
     }
 
@@ -232,8 +283,11 @@ namespace epics { namespace pvData {
         // the result length will be <= the shorter of the two inputs
         words.resize(std::min(words.size(), set.words.size()), 0);
 
+        // through pointers, so that the compiler can vectorize
+        uint64 *dst = words.empty() ? NULL : &words[0];
+        const uint64 *src = set.words.empty() ? NULL : &set.words[0];
         for(size_t i=0, e=words.size(); i<e; i++)
-            words[i] &= set.words[i];
+            dst[i] &= src[i];
 
         recalculateWordsInUse();
         return *this;
@@ -247,8 +301,10 @@ namespace epics { namespace pvData {
         words.resize(std::max(words.size(), set.words.size()), 0);
 
         // since we expand w/ zeros, then iterate using the size of the other vector
+        uint64 *dst = words.empty() ? NULL : &words[0];
+        const uint64 *src = set.words.empty() ? NULL : &set.words[0];
         for(size_t i=0, e=set.words.size(); i<e; i++)
-            words[i] |= set.words[i];
+            dst[i] |= src[i];
 
         CHECK_POST();
         return *this;
@@ -258,8 +314,10 @@ namespace epics { namespace pvData {
         // result length will <= the longer of the two inputs
         words.resize(std::max(words.size(), set.words.size()), 0);
 
+        uint64 *dst = words.empty() ? NULL : &words[0];
+        const uint64 *src = set.words.empty() ? NULL : &set.words[0];
         for(size_t i=0, e=set.words.size(); i<e; i++)
-            words[i] ^= set.words[i];
+            dst[i] ^= src[i];
 
         recalculateWordsInUse();
         return *this;
@@ -328,8 +386,7 @@ namespace epics { namespace pvData {
         flusher->ensureBuffer(len);
 
         n = len / 8;
-        for (uint32 i = 0; i < n; i++)
-            buffer->putLong(words[i]);
+        buffer->putArray(&words[0], n);
 
         if (n < words.size())
             for (uint64 x = words[words.size() - 1]; x != 0; x >>= 8)
@@ -348,15 +405,13 @@ namespace epics { namespace pvData {
 
         control->ensureData(bytes);
 
-        uint32 i = 0;
-        uint32 longs = bytes / 8;
-        while (i < longs)
-            words[i++] = buffer->getLong();
+        uint32 i = bytes / 8;
+        buffer->getArray(&words[0], i);
 
         for (uint32 j = i; j < wordsInUse; j++)
             words[j] = 0;
 
-        for (uint32 remaining = (bytes - longs * 8), j = 0; j < remaining; j++)
+        for (uint32 remaining = (bytes - i * 8), j = 0; j < remaining; j++)
             words[i] |= (buffer->getByte() & 0xffLL) << (8 * j);
 
         recalculateWordsInUse(); // Sender shouldn't add extra zero bytes, but don't fail it it does
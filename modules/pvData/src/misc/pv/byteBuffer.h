@@ -216,6 +216,44 @@ EPICS_ALWAYS_INLINE T swap(T val)
                     detail::asInt<T>::to(val)));
 }
 
+namespace detail {
+template<typename T, std::size_t N = sizeof(T)>
+struct swapArray {
+    static void op(char *dst, const char *src, std::size_t count)
+    {
+        for(std::size_t i=0; i<count; i++) {
+            store_unaligned(dst+i*N, pvData::swap<T>(load_unaligned<T>(src+i*N)));
+        }
+    }
+};
+#ifdef EPICS_SWAP_ARRAY
+template<typename T>
+struct swapArray<T, 2> {
+    static EPICS_ALWAYS_INLINE void op(char *dst, const char *src, std::size_t count)
+    { epicsSwap16Array(dst, src, count); }
+};
+template<typename T>
+struct swapArray<T, 4> {
+    static EPICS_ALWAYS_INLINE void op(char *dst, const char *src, std::size_t count)
+    { epicsSwap32Array(dst, src, count); }
+};
+template<typename T>
+struct swapArray<T, 8> {
+    static EPICS_ALWAYS_INLINE void op(char *dst, const char *src, std::size_t count)
+    { epicsSwap64Array(dst, src, count); }
+};
+#endif
+} // namespace detail
+
+//! Unconditional byte order swap of @a count elements.
+//! @a dst and @a src may be the same, or unaligned.
+template<typename T>
+EPICS_ALWAYS_INLINE void swapArray(void *dst, const void *src, std::size_t count)
+{
+    detail::swapArray<T>::op(static_cast<char*>(dst),
+                             static_cast<const char*>(src), count);
+}
+
 #define is_aligned(POINTER, BYTE_COUNT) \
     (((std::size_t)(POINTER)) % (BYTE_COUNT) == 0)
 
@@ -790,9 +828,7 @@ private:
         assert(n<=getRemaining());
 
         if (reverse<T>()) {
-            for(std::size_t i=0; i<count; i++) {
-                detail::store_unaligned(_position+i*sizeof(T), swap<T>(values[i]));
-            }
+            swapArray<T>(_position, values, count);
         } else {
             memcpy(_position, values, n);
         }
@@ -806,9 +842,7 @@ private:
         assert(n<=getRemaining());
 
         if (reverse<T>()) {
-            for(std::size_t i=0; i<count; i++) {
-                values[i] = swap<T>(detail::load_unaligned<T>(_position+i*sizeof(T)));
-            }
+            swapArray<T>(values, _position, count);
         } else {
             memcpy(values, _position, n);
         }
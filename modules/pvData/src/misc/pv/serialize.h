@@ -112,6 +112,8 @@ namespace epics { namespace pvData {
          * This should only be used for arrays of primitive types.
          * i.e. boolean, byte,..., double.
          * It cannot be called for string, structure, or union arrays.
+         * The elements are copied as received, in the byte order of
+         * existingBuffer, and are swapped by the caller if necessary.
          * @param existingBuffer the existing buffer from the caller.
          * @param deserializeTo location of data.
          * @param elementCount number of elements.
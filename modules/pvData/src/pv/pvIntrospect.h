@@ -836,6 +836,17 @@ public:
     //! @version Added after 7.0.0
     std::tr1::shared_ptr<PVStructure> build() const;
 
+    /**
+     * The serialized form of this Structure, as serializeToVector() would
+     * give, with all nested introspection written out in full.
+     * It is computed on first use for each byte order, then kept for
+     * the lifetime of this Structure.
+     * @param byteOrder EPICS_ENDIAN_LITTLE or EPICS_ENDIAN_BIG
+     * @return The encoding, valid while this Structure exists.
+     * @version Added after 8.0.6
+     */
+    const std::vector<epicsUInt8>& getSerialized(int byteOrder) const;
+
 protected:
     Structure(StringArray const & fieldNames, FieldConstPtrArray const & fields, std::string const & id = defaultId());
 private:
@@ -1398,6 +1409,7 @@ private:
 
     struct Helper;
     friend class Field;
+    friend class Structure;
     EPICS_NOT_COPYABLE(FieldCreate)
 };
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright information and license terms for this software can be
+ * found in the file LICENSE that is included with the distribution
+ */
+// Time the BitSet operations used for change tracking of large structures
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <testMain.h>
+#include <epicsUnitTest.h>
+#include <epicsTime.h>
+
+#include <pv/current_function.h>
+#include <pv/bitSet.h>
+#include <pv/byteBuffer.h>
+#include <pv/serialize.h>
+#include <pv/pvIntrospect.h>
+
+namespace {
+
+namespace pvd = epics::pvData;
+
+// the number of fields of a large NTTable
+const pvd::uint32 nbits = 4096;
+const size_t nloops = 10000;
+
+struct TimeIt {
+    epicsTime m_start;
+    const char *m_name;
+    TimeIt(const char *name) :m_start(epicsTime::getMonotonic()), m_name(name) {}
+    ~TimeIt() {
+        double diff = epicsTime::getMonotonic() - m_start;
+        testDiag("%-16s %8.1f ns per operation", m_name, diff*1e9/nloops);
+    }
+};
+
+// one in every 'every' bits set, on average
+void fill(pvd::BitSet& set, unsigned every)
+{
+    set.clear();
+    for(pvd::uint32 i=0; i<nbits; i++) {
+        if(rand()%every == 0)
+            set.set(i);
+    }
+    set.set(nbits-1);
+}
+
+struct SerializableControlImpl : public pvd::SerializableControl {
+    virtual void flushSerializeBuffer() {}
+    virtual void ensureBuffer(std::size_t) {}
+    virtual bool directSerialize(pvd::ByteBuffer*, const char*, std::size_t, std::size_t) { return false; }
+    virtual void cachedSerialize(std::tr1::shared_ptr<const pvd::Field> const & field, pvd::ByteBuffer* buffer)
+    { field->serialize(buffer, this); }
+};
+
+struct DeserializableControlImpl : public pvd::DeserializableControl {
+    virtual void ensureData(size_t) {}
+    virtual bool directDeserialize(pvd::ByteBuffer*, char*, std::size_t, std::size_t) { return false; }
+    virtual std::tr1::shared_ptr<const pvd::Field> cachedDeserialize(pvd::ByteBuffer* buffer)
+    { return pvd::getFieldCreate()->deserialize(buffer, this); }
+};
+
+void measure(unsigned every)
+{
+    testDiag("%s %u bits, 1 in %u set", CURRENT_FUNCTION, (unsigned)nbits, every);
+
+    pvd::BitSet A, B, C;
+    fill(A, every);
+    fill(B, every);
+    size_t sum = 0;
+
+    {
+        TimeIt T("operator|=");
+        for(size_t n=0; n<nloops; n++) {
+            C = A;
+            C |= B;
+        }
+    }
+    {
+        TimeIt T("operator&=");
+        for(size_t n=0; n<nloops; n++) {
+            C = A;
+            C &= B;
+        }
+    }
+    {
+        TimeIt T("operator^=");
+        for(size_t n=0; n<nloops; n++) {
+            C = A;
+            C ^= B;
+        }
+    }
+    {
+        TimeIt T("cardinality");
+        for(size_t n=0; n<nloops; n++)
+            sum += A.cardinality();
+    }
+    {
+        TimeIt T("nextSetBit loop");
+        for(size_t n=0; n<nloops; n++) {
+            for(pvd::int32 i=A.nextSetBit(0); i>=0; i=A.nextSetBit(i+1))
+                sum += i;
+        }
+    }
+
+    std::vector<char> storage(nbits/8u + 16u);
+    SerializableControlImpl flusher;
+    DeserializableControlImpl control;
+
+    for(int order=0; order<2; order++) {
+        pvd::ByteBuffer buf(&storage[0], storage.size(),
+                            order ? EPICS_ENDIAN_BIG : EPICS_ENDIAN_LITTLE);
+        testDiag("%s endian", order ? "big" : "little");
+        {
+            TimeIt T("serialize");
+            for(size_t n=0; n<nloops; n++) {
+                buf.clear();
+                A.serialize(&buf, &flusher);
+            }
+        }
+        {
+            TimeIt T("deserialize");
+            for(size_t n=0; n<nloops; n++) {
+                buf.flip();
+                C.deserialize(&buf, &control);
+            }
+        }
+        testDiag("round trip %s", C==A ? "ok" : "FAILED");
+    }
+
+    testDiag("checksum %zu", sum);
+}
+
+} // namespace
+
+MAIN(performBitSet) {
+    testPlan(0);
+    measure(2u);
+    measure(64u);
+    return testDone();
+}
@@ -849,11 +849,29 @@ void testFromString(int byteOrder)
     testOk1(_data->getSubFieldT<PVString>("Y")->get()=="testing");
 }
 
+void testSerializedStructure(int byteOrder)
+{
+    testDiag("testSerializedStructure(%d)", byteOrder);
+
+    StructureConstPtr type = getStandardField()->scalar(pvDouble, "alarm,timeStamp,display");
+
+    std::vector<epicsUInt8> expected;
+    serializeToVector(type.get(), byteOrder, expected);
+
+    const std::vector<epicsUInt8>& encoded = type->getSerialized(byteOrder);
+    testOk1(encoded==expected);
+    testOk1(&encoded==&type->getSerialized(byteOrder));
+
+    ByteBuffer buf((char*)&encoded[0], encoded.size(), byteOrder);
+    FieldConstPtr field(getFieldCreate()->deserialize(&buf, control));
+    testOk1(field==type);
+}
+
 } // end namespace
 
 MAIN(testSerialization) {
 
-    testPlan(234);
+    testPlan(240);
 
     flusher = new SerializableControlImpl();
     control = new DeserializableControlImpl();
@@ -880,6 +898,9 @@ MAIN(testSerialization) {
     testFromString(EPICS_ENDIAN_BIG);
     testFromString(EPICS_ENDIAN_LITTLE);
 
+    testSerializedStructure(EPICS_ENDIAN_BIG);
+    testSerializedStructure(EPICS_ENDIAN_LITTLE);
+
     delete buffer;
     delete control;
     delete flusher;